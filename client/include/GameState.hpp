@@ -33,6 +33,8 @@
 #include "ECS/LevelLoader.hpp"
 #include "Animation/AnimationModule.hpp"
 #include "Renderer/IRenderer.hpp"
+#include "Core/AssetLoader.hpp"
+#include "SnapshotBuffer.hpp"
 
 #include <memory>
 #include <string>
@@ -70,16 +72,6 @@ namespace RType {
             float deltaTime = 0.0f;
         };
 
-        // Entity interpolation state for smooth rendering of remote entities
-        struct InterpolationState {
-            float prevX = 0.0f;
-            float prevY = 0.0f;
-            float targetX = 0.0f;
-            float targetY = 0.0f;
-            float interpTime = 0.0f;
-            float interpDuration = 1.0f / 60.0f;
-        };
-
         class InGameState : public IState {
         public:
             InGameState(GameStateMachine& machine, GameContext& context, uint32_t seed, const std::string& levelPath = "assets/levels/level1.json");
@@ -93,6 +85,7 @@ namespace RType {
         private:
             // Level loading
             void loadLevel(const std::string& levelPath);
+            void buildSpriteAtlas();
             void initializeFromLevel();
 
             // Player System (Keane)
@@ -161,6 +154,14 @@ namespace RType {
             // Level transition
             void UpdateLevelTransition(float dt);
             void LoadNextLevel();
+
+            // Background level loading: JSON parse and image decode run on the
+            // asset loader threads, uploads happen in completions on this thread
+            void StartLevelLoad(const std::string& levelPath, int levelNumber, Core::AssetPriority priority);
+            void OnLevelDataParsed(uint32_t generation, ECS::LevelData level, Core::AssetPriority priority);
+            bool TakeLoadedLevel(int levelNumber);
+            // Starts loading a level unless it is already loading or loaded
+            void PrefetchLevel(int levelNumber, Core::AssetPriority priority);
         private:
             GameStateMachine& m_machine;
             GameContext& m_context;
@@ -240,8 +241,8 @@ namespace RType {
             static constexpr size_t MAX_INPUT_HISTORY = 120;
             static constexpr float PREDICTION_SPEED = 200.0f;
 
-            // Entity interpolation for remote entities
-            std::unordered_map<uint32_t, InterpolationState> m_interpolationStates;
+            // Snapshot history for remote entities, rendered with an adaptive playout delay
+            network::SnapshotBuffer m_snapshotBuffer;
 
             // Player ships tracking (network entities → ECS entities)
             std::unordered_map<uint32_t, RType::ECS::Entity> m_networkEntityMap;
@@ -369,6 +370,20 @@ namespace RType {
             RType::ECS::CreatedEntities m_levelEntities;
             std::string m_currentLevelPath = "assets/levels/level1.json";
 
+            struct PendingLevelLoad {
+                int levelNumber = 0;
+                uint32_t generation = 0;        // Completions of an older load are ignored
+                bool ready = false;             // Parsed, every texture uploaded, fonts loaded
+                bool failed = false;
+                size_t texturesPending = 0;
+                RType::ECS::LevelData data;
+                RType::ECS::LoadedAssets assets;
+            };
+            PendingLevelLoad m_pendingLevel;
+            // Declared after m_renderer so its workers are joined before the renderer goes away
+            std::unique_ptr<Core::AssetLoader> m_assetLoader;
+            static constexpr size_t MAX_ASSET_UPLOADS_PER_FRAME = 4;
+
             bool m_bossWarningActive = false;
             bool m_bossWarningTriggered = false;
             float m_bossWarningTimer = 0.0f;
@@ -10,6 +10,7 @@
 #include "ECS/Components/TextLabel.hpp"
 #include "ECS/Component.hpp"
 #include "Core/Logger.hpp"
+#include "ComponentReplication.hpp"
 
 using namespace RType::ECS;
 
@@ -116,17 +117,13 @@ namespace RType {
                 
             }
 
-            activePowerUps.hasFireRateBoost = (entityState.powerUpFlags & PowerUpFlags::POWERUP_FIRE_RATE_BOOST) != 0;
-            activePowerUps.hasSpreadShot = (entityState.powerUpFlags & PowerUpFlags::POWERUP_SPREAD_SHOT) != 0;
-            activePowerUps.hasLaserBeam = (entityState.powerUpFlags & PowerUpFlags::POWERUP_LASER_BEAM) != 0;
-            activePowerUps.hasShield = (entityState.powerUpFlags & PowerUpFlags::POWERUP_SHIELD) != 0;
-
-            float speedMult = static_cast<float>(entityState.speedMultiplier) / 10.0f;
-            activePowerUps.speedMultiplier = speedMult;
+            // Called with the whole merged state, for new ships as well as updates
+            constexpr uint8_t fields = DELTA_POWERUP | DELTA_WEAPON;
+            Replication::ApplyComponents<ActivePowerUps>(m_registry, playerEntity, entityState, fields);
 
             if (m_registry.HasComponent<Controllable>(playerEntity)) {
                 auto& controllable = m_registry.GetComponent<Controllable>(playerEntity);
-                controllable.speed = 200.0f * speedMult;
+                controllable.speed = 200.0f * activePowerUps.speedMultiplier;
             }
 
             WeaponType weaponType = static_cast<WeaponType>(entityState.weaponType);
@@ -175,17 +172,12 @@ namespace RType {
                 }
             }
 
-            float fireRate = static_cast<float>(entityState.fireRate) / 10.0f;
-
             if (weaponType != WeaponType::STANDARD) {
-                if (m_registry.HasComponent<WeaponSlot>(playerEntity)) {
-                    auto& weaponSlot = m_registry.GetComponent<WeaponSlot>(playerEntity);
-                    weaponSlot.type = weaponType;
-                    weaponSlot.fireRate = fireRate;
-                } else {
+                if (!m_registry.HasComponent<WeaponSlot>(playerEntity)) {
                     int damage = (weaponType == WeaponType::LASER) ? 40 : 20;
-                    m_registry.AddComponent<WeaponSlot>(playerEntity, WeaponSlot(weaponType, fireRate, damage));
+                    m_registry.AddComponent<WeaponSlot>(playerEntity, WeaponSlot(weaponType, 0.0f, damage));
                 }
+                Replication::ApplyComponents<WeaponSlot>(m_registry, playerEntity, entityState, fields);
                 activePowerUps.hasSpreadShot = (weaponType == WeaponType::SPREAD);
                 activePowerUps.hasLaserBeam = (weaponType == WeaponType::LASER);
             } else {
@@ -196,9 +188,8 @@ namespace RType {
                 activePowerUps.hasLaserBeam = false;
             }
 
-            if (!m_registry.HasComponent<WeaponSlot>(playerEntity) && m_registry.HasComponent<Shooter>(playerEntity)) {
-                auto& shooter = m_registry.GetComponent<Shooter>(playerEntity);
-                shooter.fireRate = fireRate;
+            if (!m_registry.HasComponent<WeaponSlot>(playerEntity)) {
+                Replication::ApplyComponents<Shooter>(m_registry, playerEntity, entityState, fields);
             }
 
             constexpr float SHIELD_DURATION_SECONDS = 5.0f;
@@ -483,6 +474,7 @@ namespace RType {
             }
 
             m_networkEntityMap.clear();
+            m_snapshotBuffer.Clear();
             m_obstacleColliderEntities.clear();
             m_obstacleIdToCollider.clear();
             m_playerNameLabels.clear();
@@ -12,6 +12,8 @@
 #include "Core/Logger.hpp"
 #include "ECS/PlayerFactory.hpp"
 #include "Animation/AnimationTypes.hpp"
+#include "Renderer/TextureAtlas.hpp"
+#include <filesystem>
 
 using namespace RType::ECS;
 using namespace Animation;
@@ -40,10 +42,21 @@ namespace RType {
                      m_shootMusic = m_context.audio->LoadMusic("../assets/sounds/players_shoot.flac");
                 }
 
-                m_powerUpSound = m_context.audio->LoadSound("assets/sounds/powerup.flac");
-                if (m_powerUpSound == Audio::INVALID_SOUND_ID) {
-                    m_powerUpSound = m_context.audio->LoadSound("../assets/sounds/powerup.flac");
-                }
+                // Decoded on a loader thread alongside the level textures, ready once loadLevel() returns
+                if (!m_assetLoader) {
+                    m_assetLoader = std::make_unique<Core::AssetLoader>();
+                }
+                auto audio = m_context.audio;
+                m_assetLoader->Enqueue([this, audio]() -> Core::AssetLoader::Completion {
+                    auto samples = std::make_shared<Audio::SoundSamples>();
+                    bool decoded = audio->DecodeSound("assets/sounds/powerup.flac", *samples) ||
+                                   audio->DecodeSound("../assets/sounds/powerup.flac", *samples);
+                    return [this, audio, samples, decoded]() {
+                        if (decoded) {
+                            m_powerUpSound = audio->CreateSoundFromSamples(*samples);
+                        }
+                    };
+                });
                 m_powerUpMusic = m_context.audio->LoadMusic("assets/sounds/powerup.flac");
                 if (m_powerUpMusic == Audio::INVALID_MUSIC_ID) {
                     m_powerUpMusic = m_context.audio->LoadMusic("../assets/sounds/powerup.flac");
@@ -113,6 +126,7 @@ namespace RType {
                 m_playerNameMap[static_cast<uint64_t>(player.number)] = player.name;
             }
 
+            buildSpriteAtlas();
             loadLevel(m_currentLevelPath);
             createSystems();
 
@@ -133,9 +147,27 @@ namespace RType {
             Core::Logger::Info("[GameState] Initialization complete");
         }
 
+        void InGameState::buildSpriteAtlas() {
+            // Ships, projectiles, power-ups and boss sprites share a few atlas pages so
+            // their sprites batch together; later LoadTexture calls return atlas views
+            std::vector<std::string> directories;
+            for (const char* directory : {"assets/spaceships", "assets/projectiles", "assets/powerups", "assets/boss"}) {
+                directories.push_back(std::filesystem::exists(directory) ? directory : std::string("../") + directory);
+            }
+
+            std::size_t packed = m_renderer->BuildTextureAtlas(Renderer::TextureAtlasBuilder::CollectImages(directories));
+            Core::Logger::Info("[GameState] {} sprite textures packed into the atlas", packed);
+        }
+
         void InGameState::loadLevel(const std::string& levelPath) {
-            m_levelData = ECS::LevelLoader::LoadFromFile(levelPath);
-            m_levelAssets = ECS::LevelLoader::LoadAssets(m_levelData, m_renderer.get());
+            // Decode the level textures in parallel on the loader threads, then wait:
+            // the first frame needs them all
+            StartLevelLoad(levelPath, m_levelProgress.currentLevelNumber, Core::AssetPriority::Critical);
+            m_assetLoader->WaitIdle();
+            if (!TakeLoadedLevel(m_levelProgress.currentLevelNumber)) {
+                m_levelData = ECS::LevelLoader::LoadFromFile(levelPath);
+                m_levelAssets = ECS::LevelLoader::LoadAssets(m_levelData, m_renderer.get());
+            }
             Core::Logger::Info("[GameState] Loaded level '{}' with {} textures, {} obstacle definitions", m_levelData.name, m_levelAssets.textures.size(), m_levelData.obstacles.size());
 
             // Load explosion spritesheet for death animations
@@ -12,6 +12,7 @@
 #include "Core/Logger.hpp"
 #include "ECS/PowerUpFactory.hpp"
 #include "Animation/AnimationModule.hpp"
+#include "ComponentReplication.hpp"
 #include <algorithm>
 
 using namespace RType::ECS;
@@ -20,12 +21,14 @@ using namespace Animation;
 namespace RType {
     namespace Client {
 
-        void InGameState::OnServerStateUpdate(uint32_t /*tick*/, const std::vector<network::EntityState>& entities, const std::vector<network::InputAck>& inputAcks) {
+        void InGameState::OnServerStateUpdate(uint32_t tick, const std::vector<network::EntityState>& entities, const std::vector<network::InputAck>& inputAcks) {
 
             if (m_context.networkClient) {
                 m_serverScrollOffset = m_context.networkClient->GetLastScrollOffset();
             }
 
+            m_snapshotBuffer.OnSnapshotReceived(tick, std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+
             for (const auto& ack : inputAcks) {
                 if (ack.playerHash == m_context.playerHash) {
                     ReconcileWithServer(ack);
@@ -566,6 +569,9 @@ namespace RType {
                     }
                 } else {
                     auto ecsEntity = it->second;
+                    const uint8_t changedFields = m_context.networkClient
+                        ? m_context.networkClient->GetChangedFields(entityState.entityId)
+                        : network::Replication::EntitySchema::ALL_FIELDS;
 
                     if (type == network::EntityType::BULLET) {
                         bool contaminated = false;
@@ -631,8 +637,10 @@ namespace RType {
                             continue;
                         }
 
+                        // Obstacles arrive in level space, the header scroll offset places them
+                        const float worldX = entityState.x + m_serverScrollOffset;
                         auto& colliderPos = m_registry.GetComponent<Position>(colliderEntity);
-                        colliderPos.x = entityState.x;
+                        colliderPos.x = worldX;
                         colliderPos.y = entityState.y;
 
                         if (m_registry.HasComponent<Scrollable>(colliderEntity)) {
@@ -645,7 +653,7 @@ namespace RType {
                                 m_registry.IsEntityAlive(metadata.visualEntity) &&
                                 m_registry.HasComponent<Position>(metadata.visualEntity)) {
                                 auto& visualPos = m_registry.GetComponent<Position>(metadata.visualEntity);
-                                visualPos.x = entityState.x - metadata.offsetX;
+                                visualPos.x = worldX - metadata.offsetX;
                                 visualPos.y = entityState.y - metadata.offsetY;
 
                                 if (m_registry.HasComponent<Scrollable>(metadata.visualEntity)) {
@@ -661,31 +669,13 @@ namespace RType {
                         if (type == network::EntityType::PLAYER && ecsEntity == m_localPlayerEntity) {
 
                         } else {
-                            auto& pos = m_registry.GetComponent<Position>(ecsEntity);
                             bool useInterpolation = (type == network::EntityType::PLAYER ||
                                                      type == network::EntityType::ENEMY ||
                                                      type == network::EntityType::BOSS);
                             if (useInterpolation && m_isNetworkSession) {
-                                auto interpIt = m_interpolationStates.find(entityState.entityId);
-                                if (interpIt == m_interpolationStates.end()) {
-                                    InterpolationState state;
-                                    state.prevX = pos.x;
-                                    state.prevY = pos.y;
-                                    state.targetX = entityState.x;
-                                    state.targetY = entityState.y;
-                                    state.interpTime = 0.0f;
-                                    state.interpDuration = 1.0f / 60.0f;
-                                    m_interpolationStates[entityState.entityId] = state;
-                                } else {
-                                    interpIt->second.prevX = pos.x;
-                                    interpIt->second.prevY = pos.y;
-                                    interpIt->second.targetX = entityState.x;
-                                    interpIt->second.targetY = entityState.y;
-                                    interpIt->second.interpTime = 0.0f;
-                                }
+                                m_snapshotBuffer.PushEntityState(tick, entityState);
                             } else {
-                                pos.x = entityState.x;
-                                pos.y = entityState.y;
+                                network::Replication::ApplyComponents<Position>(m_registry, ecsEntity, entityState, changedFields);
                             }
                         }
 
@@ -696,11 +686,7 @@ namespace RType {
                         }
                     }
 
-                    if (m_registry.HasComponent<Velocity>(ecsEntity)) {
-                        auto& vel = m_registry.GetComponent<Velocity>(ecsEntity);
-                        vel.dx = entityState.vx;
-                        vel.dy = entityState.vy;
-                    }
+                    network::Replication::ApplyComponents<Velocity, ScoreValue>(m_registry, ecsEntity, entityState, changedFields);
 
                     if (type == network::EntityType::PLAYER) {
                         for (size_t i = 0; i < MAX_PLAYERS; i++) {
@@ -725,9 +711,6 @@ namespace RType {
 
                     if (m_registry.HasComponent<Health>(ecsEntity)) {
                         auto& health = m_registry.GetComponent<Health>(ecsEntity);
-                        int newHealth = static_cast<int>(entityState.health);
-                        if (newHealth < 0)
-                            newHealth = 0;
 
                         bool playerIsDead = false;
                         size_t playerIndex = MAX_PLAYERS;
@@ -754,7 +737,8 @@ namespace RType {
                                 m_playersHUD[playerIndex].health = 0;
                             }
                         } else {
-                            health.current = newHealth;
+                            network::Replication::ApplyComponents<Health>(m_registry, ecsEntity, entityState, changedFields);
+                            const int newHealth = health.current;
 
                             if (isPlayerEntity && playerIndex < MAX_PLAYERS) {
                                 // Player dies when health reaches 0 (all 300 HP gone)
@@ -804,6 +788,9 @@ namespace RType {
                             m_bossWarningActive = true;
                             m_bossWarningTriggered = true;
                             m_bossWarningTimer = 0.0f;
+
+                            // The fight lasts far longer than a level load: fetch the next one now
+                            PrefetchLevel(m_levelProgress.currentLevelNumber + 1, Core::AssetPriority::Low);
                         }
 
                         if (!m_bossHealthBar.active && entityState.x < 1300.0f) {
@@ -834,6 +821,7 @@ namespace RType {
                     m_networkEntityMap.erase(it);
                 }
                 m_bulletFlagsMap.erase(entityId);
+                m_snapshotBuffer.RemoveEntity(entityId);
             }
 
             for (auto it = m_networkEntityMap.begin(); it != m_networkEntityMap.end();) {
@@ -956,6 +944,7 @@ namespace RType {
                     }
                     it = m_networkEntityMap.erase(it);
                     m_bulletFlagsMap.erase(networkId);
+                    m_snapshotBuffer.RemoveEntity(networkId);
                 } else {
                     ++it;
                 }
@@ -1052,6 +1041,11 @@ namespace RType {
             m_levelProgress.currentLevelNumber = static_cast<int>(completedLevel);
             m_levelProgress.nextLevelNumber = static_cast<int>(nextLevel);
 
+            // Usually already loaded during the boss fight; otherwise load it while the fade-out plays
+            if (m_levelProgress.currentLevelNumber < m_levelProgress.totalLevels) {
+                PrefetchLevel(m_levelProgress.nextLevelNumber, Core::AssetPriority::High);
+            }
+
             Core::Logger::Info("[InGameState] Transition started - staying in GameState, network stays active");
         }
 
@@ -14,6 +14,11 @@ namespace RType {
     namespace Client {
 
         void InGameState::UpdateLevelTransition(float dt) {
+            // A few uploads per frame so a background level load never stalls rendering
+            if (m_assetLoader) {
+                m_assetLoader->Poll(MAX_ASSET_UPLOADS_PER_FRAME);
+            }
+
             if (m_levelProgress.transitionPhase == TransitionPhase::NONE) {
                 return;
             }
@@ -35,8 +40,10 @@ namespace RType {
 
                 case TransitionPhase::LOADING: {
                     const float LOADING_DURATION = 2.0f;
+                    const bool nextLevelLoaded = m_pendingLevel.levelNumber != m_levelProgress.nextLevelNumber ||
+                                                 m_pendingLevel.ready || m_pendingLevel.failed;
 
-                    if (m_levelProgress.transitionTimer >= LOADING_DURATION) {
+                    if (m_levelProgress.transitionTimer >= LOADING_DURATION && nextLevelLoaded) {
                         if (m_levelProgress.currentLevelNumber >= m_levelProgress.totalLevels) {
                             m_levelProgress.allLevelsComplete = true;
                             m_levelProgress.transitionPhase = TransitionPhase::NONE;
@@ -230,8 +237,12 @@ namespace RType {
             m_currentLevelPath = levelPath;
 
             try {
-                m_levelData = ECS::LevelLoader::LoadFromFile(levelPath);
-                m_levelAssets = ECS::LevelLoader::LoadAssets(m_levelData, m_renderer.get());
+                if (!TakeLoadedLevel(m_levelProgress.nextLevelNumber)) {
+                    Core::Logger::Warning("[Transition] Level {} was not preloaded, loading synchronously",
+                                          m_levelProgress.nextLevelNumber);
+                    m_levelData = ECS::LevelLoader::LoadFromFile(levelPath);
+                    m_levelAssets = ECS::LevelLoader::LoadAssets(m_levelData, m_renderer.get());
+                }
 
                 m_levelEntities = ECS::LevelLoader::CreateEntities(m_registry, m_levelData, m_levelAssets, m_renderer.get());
                 m_backgroundEntities = m_levelEntities.backgrounds;
@@ -299,5 +310,102 @@ namespace RType {
             }
         }
 
+        void InGameState::StartLevelLoad(const std::string& levelPath, int levelNumber, Core::AssetPriority priority) {
+            if (!m_assetLoader) {
+                m_assetLoader = std::make_unique<Core::AssetLoader>();
+            }
+
+            const uint32_t generation = m_pendingLevel.generation + 1;
+            m_pendingLevel = PendingLevelLoad{};
+            m_pendingLevel.levelNumber = levelNumber;
+            m_pendingLevel.generation = generation;
+            m_assetLoader->ResetProgress();
+
+            Core::Logger::Info("[Transition] Loading level {} in the background from '{}'", levelNumber, levelPath);
+
+            m_assetLoader->Enqueue([this, levelPath, generation, priority]() -> Core::AssetLoader::Completion {
+                auto level = std::make_shared<ECS::LevelData>();
+                try {
+                    *level = ECS::LevelLoader::LoadFromFile(levelPath);
+                } catch (const std::exception& e) {
+                    Core::Logger::Error("[Transition] Failed to parse '{}': {}", levelPath, e.what());
+                    return [this, generation]() {
+                        if (m_pendingLevel.generation == generation) {
+                            m_pendingLevel.failed = true;
+                        }
+                    };
+                }
+                return [this, level, generation, priority]() {
+                    OnLevelDataParsed(generation, std::move(*level), priority);
+                };
+            }, priority);
+        }
+
+        void InGameState::OnLevelDataParsed(uint32_t generation, ECS::LevelData level, Core::AssetPriority priority) {
+            if (m_pendingLevel.generation != generation) {
+                return;
+            }
+
+            m_pendingLevel.data = std::move(level);
+            m_pendingLevel.texturesPending = m_pendingLevel.data.textures.size();
+
+            auto finish = [this]() {
+                ECS::LevelLoader::LoadFonts(m_pendingLevel.data, m_renderer.get(), m_pendingLevel.assets);
+                m_pendingLevel.ready = true;
+                Core::Logger::Info("[Transition] Level {} ready: {} textures",
+                                  m_pendingLevel.levelNumber, m_pendingLevel.assets.textures.size());
+            };
+
+            if (m_pendingLevel.texturesPending == 0) {
+                finish();
+                return;
+            }
+
+            const Renderer::IRenderer* renderer = m_renderer.get();
+            for (const auto& [key, path] : m_pendingLevel.data.textures) {
+                m_assetLoader->Enqueue([this, renderer, key = key, path = path, generation, finish]() -> Core::AssetLoader::Completion {
+                    auto decoded = std::make_shared<ECS::DecodedTexture>();
+                    const bool decodedOk = ECS::LevelLoader::DecodeTexture(renderer, path, *decoded);
+
+                    return [this, key, path, decoded, decodedOk, generation, finish]() {
+                        if (m_pendingLevel.generation != generation) {
+                            return;
+                        }
+                        if (decodedOk) {
+                            ECS::LevelLoader::UploadTexture(key, *decoded, m_renderer.get(), m_pendingLevel.assets);
+                        } else {
+                            Core::Logger::Warning("Failed to load texture '{}' from '{}'", key, path);
+                        }
+                        if (--m_pendingLevel.texturesPending == 0) {
+                            finish();
+                        }
+                    };
+                }, priority);
+            }
+        }
+
+        void InGameState::PrefetchLevel(int levelNumber, Core::AssetPriority priority) {
+            if (levelNumber > m_levelProgress.totalLevels) {
+                return;
+            }
+            if (m_pendingLevel.levelNumber == levelNumber && !m_pendingLevel.failed) {
+                return;
+            }
+            StartLevelLoad("assets/levels/level" + std::to_string(levelNumber) + ".json", levelNumber, priority);
+        }
+
+        bool InGameState::TakeLoadedLevel(int levelNumber) {
+            if (m_pendingLevel.levelNumber != levelNumber || !m_pendingLevel.ready) {
+                return false;
+            }
+
+            m_levelData = std::move(m_pendingLevel.data);
+            m_levelAssets = std::move(m_pendingLevel.assets);
+            const uint32_t generation = m_pendingLevel.generation;
+            m_pendingLevel = PendingLevelLoad{};
+            m_pendingLevel.generation = generation;
+            return true;
+        }
+
     }
 }
@@ -578,6 +578,19 @@ namespace RType {
                 fullScreen.position = Renderer::Vector2(0.0f, 0.0f);
                 fullScreen.size = Renderer::Vector2(1280.0f, 720.0f);
                 m_renderer->DrawRectangle(fullScreen, Renderer::Color(0.0f, 0.0f, 0.0f, 1.0f));
+
+                if (m_assetLoader) {
+                    const float progress = m_assetLoader->GetProgress().Fraction();
+
+                    Renderer::Rectangle barBackground;
+                    barBackground.position = Renderer::Vector2(440.0f, 600.0f);
+                    barBackground.size = Renderer::Vector2(400.0f, 8.0f);
+                    m_renderer->DrawRectangle(barBackground, Renderer::Color(0.2f, 0.2f, 0.2f, 1.0f));
+
+                    Renderer::Rectangle barForeground = barBackground;
+                    barForeground.size.x = barBackground.size.x * progress;
+                    m_renderer->DrawRectangle(barForeground, Renderer::Color(0.8f, 0.8f, 0.8f, 1.0f));
+                }
             }
         }
 
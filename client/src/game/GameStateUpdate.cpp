@@ -294,43 +294,58 @@ namespace RType {
 
                 bool blocked = false;
                 for (auto& collider : m_obstacleColliderEntities) {
+                    if (blocked) {
+                        break;
+                    }
                     if (!m_registry.IsEntityAlive(collider) ||
                         !m_registry.HasComponent<Position>(collider) ||
-                        !m_registry.HasComponent<BoxCollider>(collider))
+                        !m_registry.HasComponent<CompoundCollider>(collider))
                         continue;
                     const auto& obstPos = m_registry.GetComponent<Position>(collider);
-                    const auto& obstBox = m_registry.GetComponent<BoxCollider>(collider);
-
-                    bool wouldCollide =
-                        newX < obstPos.x + obstBox.width &&
-                        newX + playerW > obstPos.x &&
-                        newY < obstPos.y + obstBox.height &&
-                        newY + playerH > obstPos.y;
-
-                    if (wouldCollide) {
-                        blocked = true;
-                        float overlapLeft = (newX + playerW) - obstPos.x;
-                        float overlapRight = (obstPos.x + obstBox.width) - newX;
-                        float overlapTop = (newY + playerH) - obstPos.y;
-                        float overlapBottom = (obstPos.y + obstBox.height) - newY;
-
-                        float minOverlapX = std::min(overlapLeft, overlapRight);
-                        float minOverlapY = std::min(overlapTop, overlapBottom);
-
-                        if (minOverlapX < minOverlapY) {
-                            if (overlapLeft < overlapRight) {
-                                newX = obstPos.x - playerW - 0.5f;
-                            } else {
-                                newX = obstPos.x + obstBox.width + 0.5f;
-                            }
-                        } else {
-                            if (overlapTop < overlapBottom) {
-                                newY = obstPos.y - playerH - 0.5f;
+                    const auto& compound = m_registry.GetComponent<CompoundCollider>(collider);
+
+                    // Whole obstacle first, its boxes only when the bound is touched
+                    const auto& bound = compound.bound;
+                    if (newX >= obstPos.x + bound.x + bound.width || newX + playerW <= obstPos.x + bound.x ||
+                        newY >= obstPos.y + bound.y + bound.height || newY + playerH <= obstPos.y + bound.y) {
+                        continue;
+                    }
+
+                    for (const auto& obstBox : compound.boxes) {
+                        const float boxX = obstPos.x + obstBox.x;
+                        const float boxY = obstPos.y + obstBox.y;
+
+                        bool wouldCollide =
+                            newX < boxX + obstBox.width &&
+                            newX + playerW > boxX &&
+                            newY < boxY + obstBox.height &&
+                            newY + playerH > boxY;
+
+                        if (wouldCollide) {
+                            blocked = true;
+                            float overlapLeft = (newX + playerW) - boxX;
+                            float overlapRight = (boxX + obstBox.width) - newX;
+                            float overlapTop = (newY + playerH) - boxY;
+                            float overlapBottom = (boxY + obstBox.height) - newY;
+
+                            float minOverlapX = std::min(overlapLeft, overlapRight);
+                            float minOverlapY = std::min(overlapTop, overlapBottom);
+
+                            if (minOverlapX < minOverlapY) {
+                                if (overlapLeft < overlapRight) {
+                                    newX = boxX - playerW - 0.5f;
+                                } else {
+                                    newX = boxX + obstBox.width + 0.5f;
+                                }
                             } else {
-                                newY = obstPos.y + obstBox.height + 0.5f;
+                                if (overlapTop < overlapBottom) {
+                                    newY = boxY - playerH - 0.5f;
+                                } else {
+                                    newY = boxY + obstBox.height + 0.5f;
+                                }
                             }
+                            break;
                         }
-                        break;
                     }
                 }
 
@@ -467,47 +482,41 @@ namespace RType {
             }
 
             if (m_isNetworkSession) {
+                m_snapshotBuffer.Update(dt);
+                double renderTime = m_snapshotBuffer.GetRenderTime(
+                    std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+
                 std::vector<uint32_t> toRemove;
-                for (auto& [networkId, interpState] : m_interpolationStates) {
-                    auto entityIt = m_networkEntityMap.find(networkId);
-                    if (entityIt == m_networkEntityMap.end()) {
-                        toRemove.push_back(networkId);
+                for (auto& [networkId, ecsEntity] : m_networkEntityMap) {
+                    if (!m_snapshotBuffer.HasEntity(networkId)) {
                         continue;
                     }
-
-                    ECS::Entity entity = entityIt->second;
-                    if (!m_registry.IsEntityAlive(entity)) {
+                    if (!m_registry.IsEntityAlive(ecsEntity)) {
                         toRemove.push_back(networkId);
                         continue;
                     }
-
-                    if (!m_registry.HasComponent<Position>(entity)) {
+                    if (ecsEntity == m_localPlayerEntity || !m_registry.HasComponent<Position>(ecsEntity)) {
                         continue;
                     }
 
-                    interpState.interpTime += dt;
-                    float t = interpState.interpTime / interpState.interpDuration;
-                    if (t > 1.0f) {
-                        t = 1.0f;
+                    auto& pos = m_registry.GetComponent<Position>(ecsEntity);
+                    if (!m_snapshotBuffer.Sample(networkId, renderTime, pos.x, pos.y)) {
+                        continue;
                     }
 
-                    auto& pos = m_registry.GetComponent<Position>(entity);
-                    pos.x = interpState.prevX + (interpState.targetX - interpState.prevX) * t;
-                    pos.y = interpState.prevY + (interpState.targetY - interpState.prevY) * t;
-
-                    if (m_registry.HasComponent<Player>(entity)) {
-                        UpdatePlayerNameLabelPosition(entity, pos.x, pos.y);
+                    if (m_registry.HasComponent<Player>(ecsEntity)) {
+                        UpdatePlayerNameLabelPosition(ecsEntity, pos.x, pos.y);
                     }
                 }
                 for (uint32_t id : toRemove) {
-                    m_interpolationStates.erase(id);
+                    m_snapshotBuffer.RemoveEntity(id);
                 }
 
                 for (auto& [networkId, ecsEntity] : m_networkEntityMap) {
                     if (!m_registry.IsEntityAlive(ecsEntity)) continue;
                     if (!m_registry.HasComponent<Position>(ecsEntity)) continue;
                     if (!m_registry.HasComponent<Velocity>(ecsEntity)) continue;
-                    if (m_interpolationStates.count(networkId) > 0) continue;
+                    if (m_snapshotBuffer.HasEntity(networkId)) continue;
                     if (ecsEntity == m_localPlayerEntity) continue;
 
                     auto& pos = m_registry.GetComponent<Position>(ecsEntity);
@@ -125,6 +125,10 @@ namespace RType {
 
                 auto gameClient = std::make_shared<network::GameClient>(
                     m_context.networkModule.get(), serverIp, udpPort, localPlayer);
+                std::vector<uint8_t> snapshotDictionary;
+                if (network::LoadBinaryFile("assets/network/snapshot.dict", snapshotDictionary)) {
+                    gameClient->SetCompressionDictionary(snapshotDictionary);
+                }
                 if (gameClient->ConnectToServer()) {
                     m_context.networkClient = gameClient;
                     m_machine.ChangeState(std::make_unique<InGameState>(m_machine, m_context, seed));
@@ -2,7 +2,9 @@
 
 #include <unordered_map>
 #include <memory>
+#include <vector>
 #include "Animation/IAnimation.hpp"
+#include "Core/AssetLoader.hpp"
 
 namespace Animation {
 
@@ -41,17 +43,37 @@ namespace Animation {
         std::size_t GetFrameIndexAtTime(AnimationClipId clipId,
                                         float time,
                                         bool looping) const override;
+        void AdvanceClips(ClipCursor* cursors, std::size_t count, float deltaTime) const override;
 
         // Bulk Loading
         void LoadAnimationsFromManifest(const std::string& manifestPath) override;
+        // Same result, with the manifest and each clip file parsed by loader jobs.
+        // The clips are created together, in manifest order, by the Poll() that
+        // runs the last completion; the module must outlive the pending jobs.
+        void LoadAnimationsFromManifestAsync(const std::string& manifestPath, RType::Core::AssetLoader& loader,
+                                             RType::Core::AssetPriority priority = RType::Core::AssetPriority::Normal);
         void UnloadAll() override;
 
         // Utility
         AnimationClipId GetClipByName(const std::string& name) const override;
 
+        // File parsing only, no module state touched: safe to run on a loader
+        // thread, with CreateClip() called on the results afterwards
+        static bool ParseClipFile(const std::string& path, AnimationClipConfig& config);
+        static std::vector<AnimationClipConfig> ParseManifest(const std::string& manifestPath);
+        static std::vector<std::string> ParseManifestClipPaths(const std::string& manifestPath);
+
     private:
+        // Clip compiled at creation into immutable lookup tables
+        struct CompiledClip {
+            AnimationClipConfig config;
+            float duration = 0.0f;
+            float uniformFrameDuration = 0.0f; // > 0 when every frame lasts the same, enables O(1) lookup
+            std::vector<float> frameEnds;      // Prefix sums of frame durations
+        };
+
         // Internal storage
-        std::unordered_map<AnimationClipId, AnimationClipConfig> m_clips;
+        std::unordered_map<AnimationClipId, CompiledClip> m_clips;
         std::unordered_map<std::string, AnimationClipId> m_clipNameToId;
 
         // ID generation
@@ -61,7 +83,11 @@ namespace Animation {
         RType::Core::Engine* m_engine = nullptr;
 
         // Helper functions
-        float CalculateClipDuration(const AnimationClipConfig& config) const;
+        const CompiledClip* FindClip(AnimationClipId clipId) const;
+        static void AppendGridFrames(const GridLayout& layout, AnimationClipConfig& config);
+        static void CompileClip(CompiledClip& clip);
+        static float NormalizeTime(const CompiledClip& clip, float time, bool looping);
+        static std::size_t FrameIndexAt(const CompiledClip& clip, float normalizedTime);
     };
 
 }
@@ -36,6 +36,19 @@ namespace Animation {
         AnimationClipConfig() = default;
     };
 
+    // Playback state of one sprite, advanced in bulk by IAnimation::AdvanceClips
+    struct ClipCursor {
+        AnimationClipId clipId = INVALID_CLIP_ID;
+        float time = 0.0f;
+        float playbackSpeed = 1.0f;
+        bool looping = false;
+
+        // Outputs
+        bool finished = false;            // Non-looping clip reached its end during this step
+        std::size_t frameIndex = 0;
+        const FrameDef* frame = nullptr;  // nullptr if the clip is unknown or has no duration
+    };
+
     struct GridLayout {
         std::uint32_t columns = 1;
         std::uint32_t rows = 1;
@@ -55,6 +55,10 @@ namespace Animation {
                                                 float time,
                                                 bool looping) const = 0;
 
+        // Advance every cursor by deltaTime * playbackSpeed, wrapping or clamping
+        // to the clip duration, and resolve the frame each one lands on
+        virtual void AdvanceClips(ClipCursor* cursors, std::size_t count, float deltaTime) const = 0;
+
         // Load multiple animations from a manifest JSON file
         virtual void LoadAnimationsFromManifest(const std::string& manifestPath) = 0;
 
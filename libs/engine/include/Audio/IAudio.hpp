@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 #include "Core/Module.hpp"
 #include "Math/Types.hpp"
 
@@ -27,6 +28,13 @@ namespace Audio {
         bool loop = false;
     };
 
+    // PCM samples decoded off the main thread by DecodeSound
+    struct SoundSamples {
+        std::vector<std::int16_t> samples;  // Interleaved
+        std::uint32_t channelCount = 0;
+        std::uint32_t sampleRate = 0;
+    };
+
     struct ListenerProperties {
         Math::Vector2 position{0.0f, 0.0f};
         Math::Vector2 forward{0.0f, -1.0f};
@@ -48,6 +56,11 @@ namespace Audio {
         virtual SoundId LoadSound(const std::string& path) = 0;
         virtual void UnloadSound(SoundId soundId) = 0;
 
+        // Decode a sound file into memory without touching the device. Safe to call from worker threads.
+        virtual bool DecodeSound(const std::string& path, SoundSamples& samples) const = 0;
+        // Register samples produced by DecodeSound (main thread)
+        virtual SoundId CreateSoundFromSamples(const SoundSamples& samples) = 0;
+
         virtual MusicId LoadMusic(const std::string& path) = 0;
         virtual void UnloadMusic(MusicId musicId) = 0;
 
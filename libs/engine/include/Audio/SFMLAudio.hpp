@@ -24,6 +24,8 @@ namespace Audio {
 
         SoundId LoadSound(const std::string& path) override;
         void UnloadSound(SoundId soundId) override;
+        bool DecodeSound(const std::string& path, SoundSamples& samples) const override;
+        SoundId CreateSoundFromSamples(const SoundSamples& samples) override;
 
         MusicId LoadMusic(const std::string& path) override;
         void UnloadMusic(MusicId musicId) override;
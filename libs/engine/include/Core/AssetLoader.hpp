@@ -0,0 +1,95 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RType {
+    namespace Core {
+
+        enum class AssetPriority : std::uint8_t {
+            Critical = 0,
+            High = 1,
+            Normal = 2,
+            Low = 3
+        };
+
+        // Background asset pipeline. A job runs its expensive part (file I/O,
+        // image/audio decode, JSON parsing) on a worker thread and returns a
+        // completion that Poll() later runs on the owning (main) thread, where
+        // GPU uploads and engine state changes are safe. Jobs are started in
+        // priority order, FIFO within a priority.
+        class AssetLoader {
+        public:
+            using Completion = std::function<void()>;
+            using Job = std::function<Completion()>;
+
+            struct Progress {
+                std::uint32_t submitted = 0;
+                std::uint32_t completed = 0;  // Completions already run by Poll()
+
+                float Fraction() const {
+                    return submitted == 0 ? 1.0f : static_cast<float>(completed) / static_cast<float>(submitted);
+                }
+                bool Done() const { return completed == submitted; }
+            };
+
+            // 0 threads picks hardware_concurrency - 1, at least one
+            explicit AssetLoader(std::size_t threadCount = 0);
+            ~AssetLoader();
+
+            AssetLoader(const AssetLoader&) = delete;
+            AssetLoader& operator=(const AssetLoader&) = delete;
+
+            void Enqueue(Job job, AssetPriority priority = AssetPriority::Normal);
+
+            // Run up to maxCompletions finished jobs on the calling thread (0 = all ready).
+            // Completions may enqueue further jobs. Returns the number run.
+            std::size_t Poll(std::size_t maxCompletions = 0);
+
+            // Block until every submitted job has finished and its completion has run
+            void WaitIdle();
+
+            // Counts since the last ResetProgress(), for loading screens
+            Progress GetProgress() const;
+            void ResetProgress();
+            bool IsIdle() const;
+
+            std::size_t GetThreadCount() const { return m_workers.size(); }
+
+        private:
+            struct QueuedJob {
+                AssetPriority priority = AssetPriority::Normal;
+                std::uint64_t sequence = 0;
+                Job job;
+
+                bool operator<(const QueuedJob& other) const {
+                    // The heap top is the largest element: lowest priority value, then oldest
+                    if (priority != other.priority) {
+                        return priority > other.priority;
+                    }
+                    return sequence > other.sequence;
+                }
+            };
+
+            void WorkerLoop();
+
+            std::vector<std::thread> m_workers;
+            std::vector<QueuedJob> m_jobs;  // Max-heap on QueuedJob::operator<
+            std::deque<Completion> m_completions;
+            std::uint64_t m_nextSequence = 0;
+            std::uint32_t m_running = 0;
+            Progress m_progress;
+            bool m_stopping = false;
+
+            mutable std::mutex m_mutex;
+            std::condition_variable m_jobAvailable;
+            std::condition_variable m_completionAvailable;
+        };
+
+    }
+}
@@ -27,6 +27,10 @@ namespace ECS {
 
         Animation::IAnimation* m_animation;
         std::vector<Entity> m_entitiesToDestroy;
+
+        // Scratch buffers reused every frame for the batched clip update
+        std::vector<Entity> m_animatedEntities;
+        std::vector<Animation::ClipCursor> m_cursors;
     };
 
 }
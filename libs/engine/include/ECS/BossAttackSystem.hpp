@@ -9,6 +9,7 @@
 
 #include "ISystem.hpp"
 #include "Registry.hpp"
+#include "SimulationRng.hpp"
 #include <cmath>
 
 namespace RType {
@@ -22,6 +23,7 @@ namespace RType {
             const char* GetName() const override { return "BossAttackSystem"; }
 
             void Update(Registry& registry, float deltaTime) override;
+            void SetRng(SimulationRng* rng) { m_rng = rng ? rng : &m_ownRng; }
 
         private:
             void CreateFanSpray(Registry& registry, Entity bossEntity, float bossX, float bossY);
@@ -33,6 +35,9 @@ namespace RType {
             void CreateSecondAttackSpray(Registry& registry, Entity bossEntity, float bossX, float bossY);
             void CreateContinuousFire(Registry& registry, Entity bossEntity, float bossX, float bossY);
             void CreateMine(Registry& registry, Entity bossEntity, float bossX, float bossY);
+
+            SimulationRng m_ownRng;
+            SimulationRng* m_rng = &m_ownRng;
         };
 
     }
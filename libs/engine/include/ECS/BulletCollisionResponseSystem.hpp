@@ -10,6 +10,8 @@
 #include "ISystem.hpp"
 #include "Registry.hpp"
 #include "Component.hpp"
+#include <unordered_map>
+#include <cstdint>
 
 namespace RType {
     namespace ECS {
@@ -30,6 +32,9 @@ namespace RType {
 
         private:
             EffectFactory* m_effectFactory = nullptr;
+            // Per-instance so that consecutive rooms in one process start from the same state
+            std::unordered_map<uint64_t, float> m_lastBeamDamageTime;
+            float m_totalTime = 0.0f;
         };
 
     }
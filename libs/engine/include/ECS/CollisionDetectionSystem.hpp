@@ -23,10 +23,16 @@ namespace RType {
             void Update(Registry& registry, float deltaTime) override;
 
             static bool CheckCollision(Registry& registry, Entity a, Entity b);
+            // Position in world space; LevelSpace entities are shifted by the registry scroll offset
+            static Position GetWorldPosition(const Registry& registry, Entity entity);
+            // World-space box of entity touching other: its BoxCollider, or the first
+            // CompoundCollider box overlapping other. False when nothing touches.
+            static bool GetContactBox(const Registry& registry, Entity entity, Entity other,
+                                      CompoundCollider::Box& box);
         private:
             void ClearCollisionEvents(Registry& registry);
             std::vector<Entity> GetCollidableEntities(Registry& registry);
-            bool ShouldCollide(Registry& registry, Entity a, Entity b);
+            static bool ShouldCollide(const ComponentPool<CollisionLayer>& layers, Entity a, Entity b);
 
             static bool CheckCircleCircle(float x1, float y1, float r1,
                                           float x2, float y2, float r2);
@@ -36,6 +42,9 @@ namespace RType {
 
             static bool CheckCircleAABB(float cx, float cy, float radius,
                                         float bx, float by, float bw, float bh);
+
+            // Whether the collider of entity overlaps a world-space box
+            static bool OverlapsBox(const Registry& registry, Entity entity, const CompoundCollider::Box& box);
         };
 
     }
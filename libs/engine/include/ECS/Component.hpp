@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <string>
 #include <cstring>
 #include <cstdint>
@@ -16,7 +19,28 @@
 namespace RType {
 
     namespace ECS {
-        using ComponentID = std::type_index;
+        // Dense per-type index into the registry's pool array, handed out on
+        // first use of a component type. Stable for the run, not across runs.
+        using ComponentID = std::size_t;
+
+        namespace Detail {
+            inline ComponentID NextComponentID() {
+                static std::atomic<ComponentID> counter{0};
+                return counter.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            template <typename T>
+            ComponentID ComponentIDOf() {
+                static const ComponentID id = NextComponentID();
+                return id;
+            }
+        }
+
+        // const Position and Position share an id, as they shared a typeid
+        template <typename T>
+        ComponentID GetComponentID() {
+            return Detail::ComponentIDOf<std::remove_cv_t<std::remove_reference_t<T>>>();
+        }
 
         struct IComponent {
             virtual ~IComponent() = default;
@@ -78,6 +102,36 @@ namespace RType {
                 : width(width), height(height) {}
         };
 
+        // Several boxes sharing one entity, e.g. the colliders of an obstacle.
+        // Boxes are relative to Position; collision tests the bound first.
+        struct CompoundCollider : public IComponent {
+            struct Box {
+                float x = 0.0f;
+                float y = 0.0f;
+                float width = 0.0f;
+                float height = 0.0f;
+            };
+
+            std::vector<Box> boxes;
+            Box bound;
+
+            CompoundCollider() = default;
+
+            void AddBox(float x, float y, float width, float height) {
+                if (boxes.empty()) {
+                    bound = {x, y, width, height};
+                } else {
+                    const float right = std::max(bound.x + bound.width, x + width);
+                    const float bottom = std::max(bound.y + bound.height, y + height);
+                    bound.x = std::min(bound.x, x);
+                    bound.y = std::min(bound.y, y);
+                    bound.width = right - bound.x;
+                    bound.height = bottom - bound.y;
+                }
+                boxes.push_back({x, y, width, height});
+            }
+        };
+
         struct Controllable : public IComponent {
             float speed = 200.0f;
 
@@ -330,6 +384,11 @@ namespace RType {
         struct ObstacleVisual : public IComponent {
         };
 
+        // Static level geometry: Position is in level space and never written per tick.
+        // The world position is Position.x + Registry::GetScrollOffset(), see GetWorldPosition.
+        struct LevelSpace : public IComponent {
+        };
+
         // Stable network identifier for server->client entity mirroring.
         // IMPORTANT: This must live on the entity as a component, because raw ECS entity IDs are recycled.
         // If we instead map "ECS entity id -> network id" in a hash map, then destroying and reusing an
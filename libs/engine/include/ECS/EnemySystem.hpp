@@ -2,7 +2,7 @@
 
 #include "ISystem.hpp"
 #include "Renderer/IRenderer.hpp"
-#include <random>
+#include "SimulationRng.hpp"
 
 namespace RType {
 
@@ -18,6 +18,7 @@ namespace RType {
             const char* GetName() const override { return "EnemySystem"; }
 
             void SpawnRandomEnemy(Registry& registry);
+            void SetRng(SimulationRng* rng) { m_rng = rng ? rng : &m_ownRng; }
             static void DestroyEnemiesOffScreen(Registry& registry, float screenWidth);
             static void ApplyMovementPattern(Registry& registry, Entity enemy, float /* deltaTime */);
         private:
@@ -26,7 +27,8 @@ namespace RType {
             float m_screenHeight;
             float m_spawnTimer = 0.0f;
             float m_spawnInterval = 3.0f;
-            std::mt19937 m_rng;
+            SimulationRng m_ownRng;
+            SimulationRng* m_rng = &m_ownRng;
         };
 
     }
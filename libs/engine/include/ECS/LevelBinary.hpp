@@ -0,0 +1,136 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LevelBinary - Precompiled flat level format
+*/
+
+#pragma once
+
+#include "LevelLoader.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace RType {
+
+    namespace ECS {
+
+        // On-disk layout of a compiled level (.rlvl). Every section is a flat array
+        // of fixed-size records addressed by offset from the start of the file, so
+        // a mapped file is read in place. Strings live in one table and are
+        // referenced by offset and length. Obstacles and enemies keep the order
+        // LevelLoader gives them (sorted by x), which also fixes obstacle ids.
+        namespace LevelBinary {
+
+            constexpr char MAGIC[4] = {'R', 'L', 'V', 'L'};
+            constexpr uint32_t VERSION = 1;
+            constexpr const char* EXTENSION = ".rlvl";
+
+            struct StringRef {
+                uint32_t offset = 0;
+                uint32_t length = 0;
+            };
+
+            struct Section {
+                uint32_t offset = 0;
+                uint32_t count = 0;
+            };
+
+            struct TextureRecord {
+                StringRef key;
+                StringRef path;
+            };
+
+            struct FontRecord {
+                StringRef key;
+                StringRef path;
+                uint32_t size = 16;
+            };
+
+            struct ObstacleRecord {
+                StringRef texture;
+                float x = 0.0f;
+                float y = 0.0f;
+                float scaleWidth = 0.0f;
+                float scaleHeight = 0.0f;
+                float scrollSpeed = 0.0f;
+                int32_t layer = 0;
+                uint32_t firstCollider = 0;
+                uint32_t colliderCount = 0;
+            };
+
+            struct ColliderRecord {
+                float x = 0.0f;
+                float y = 0.0f;
+                float width = 0.0f;
+                float height = 0.0f;
+            };
+
+            struct EnemyRecord {
+                StringRef type;
+                float x = 0.0f;
+                float y = 0.0f;
+            };
+
+            struct SpawnRecord {
+                float x = 0.0f;
+                float y = 0.0f;
+            };
+
+            struct BackgroundRecord {
+                StringRef texture;
+                float scrollSpeed = 0.0f;
+                int32_t copies = 0;
+                int32_t layer = 0;
+            };
+
+            struct BossRecord {
+                StringRef texture;
+                float x = 0.0f;
+                float y = 0.0f;
+                float width = 0.0f;
+                float height = 0.0f;
+                int32_t health = 0;
+                float scrollSpeed = 0.0f;
+                int32_t attackPattern = 0;
+                uint32_t bossId = 0;
+            };
+
+            struct FileHeader {
+                char magic[4] = {MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3]};
+                uint32_t version = VERSION;
+                uint32_t fileSize = 0;
+                uint32_t hasBoss = 0;
+                StringRef name;
+                BackgroundRecord background;
+                BossRecord boss;
+                Section strings;  // count is in bytes
+                Section textures;
+                Section fonts;
+                Section obstacles;
+                Section colliders;
+                Section enemies;
+                Section playerSpawns;
+            };
+
+            // Flat image of a level, ready to be written to disk
+            std::vector<uint8_t> Compile(const LevelData& level);
+
+            // Rebuild a level from a compiled image; false if the image is
+            // truncated, from another version or has out-of-range references
+            bool Decode(const uint8_t* data, std::size_t size, LevelData& level);
+
+            // Map a compiled file and decode it; false if missing or invalid
+            bool LoadFile(const std::string& path, LevelData& level);
+            bool SaveFile(const LevelData& level, const std::string& path);
+
+            // "assets/levels/level1.json" -> "assets/levels/level1.rlvl"
+            std::string CompiledPath(const std::string& jsonPath);
+
+        }
+
+    }
+
+}
@@ -111,6 +111,12 @@ namespace RType {
             std::unordered_map<std::string, Renderer::FontId> fonts;
         };
 
+        // Level texture decoded to CPU memory, waiting for its GPU upload
+        struct DecodedTexture {
+            std::string path;  // Path the image was actually read from
+            Renderer::ImageData image;
+        };
+
         struct CreatedEntities {
             std::vector<Entity> backgrounds;
             std::vector<Entity> obstacleVisuals;
@@ -121,8 +127,11 @@ namespace RType {
 
         class LevelLoader {
         public:
+            // Prefers the compiled .rlvl next to the JSON (see LevelBinary) unless
+            // it is missing, invalid or older than the JSON
             static LevelData LoadFromFile(const std::string& path);
             static LevelData LoadFromString(const std::string& jsonString);
+            static bool LoadCompiled(const std::string& jsonPath, LevelData& level);
 
             static std::string SerializeToString(const LevelData& level);
             static void SaveToFile(const LevelData& level, const std::string& path);
@@ -131,6 +140,23 @@ namespace RType {
                 const LevelData& level,
                 Renderer::IRenderer* renderer);
 
+            // Split form of LoadAssets for background loading: DecodeTexture reads
+            // and decodes one level texture and is safe on any thread, the other
+            // two touch the renderer and must run on the main thread.
+            static bool DecodeTexture(
+                const Renderer::IRenderer* renderer,
+                const std::string& path,
+                DecodedTexture& decoded);
+            static bool UploadTexture(
+                const std::string& key,
+                const DecodedTexture& decoded,
+                Renderer::IRenderer* renderer,
+                LoadedAssets& assets);
+            static void LoadFonts(
+                const LevelData& level,
+                Renderer::IRenderer* renderer,
+                LoadedAssets& assets);
+
             static CreatedEntities CreateEntities(
                 Registry& registry,
                 const LevelData& level,
@@ -141,9 +167,34 @@ namespace RType {
                 Registry& registry,
                 const LevelData& level);
 
+            // Single-element forms of CreateServerEntities, used by LevelStreamer.
+            // shiftX moves the element along x from its level position; an obstacle
+            // with colliders takes the id obstacleIdCounter and increments it. A
+            // levelSpace obstacle does not scroll itself but follows the registry
+            // scroll offset (see LevelSpace).
+            static Entity SpawnServerObstacle(
+                Registry& registry,
+                const ObstacleDef& obstacle,
+                float shiftX,
+                uint32_t& obstacleIdCounter,
+                CreatedEntities& entities,
+                bool levelSpace = false);
+            static Entity SpawnServerEnemy(
+                Registry& registry,
+                const EnemyDef& enemy,
+                float shiftX,
+                CreatedEntities& entities);
+            static Entity SpawnServerBoss(
+                Registry& registry,
+                const BossDef& boss,
+                float shiftX,
+                CreatedEntities& entities);
+
             static const std::vector<PlayerSpawnDef>& GetPlayerSpawns(const LevelData& level);
-        private:
             static EnemyType ParseEnemyType(const std::string& typeStr);
+            // All colliders of an obstacle as one shape, relative to the obstacle position
+            static CompoundCollider MakeObstacleCollider(const ObstacleDef& obstacle);
+        private:
 
             static void CreateBackgrounds(
                 Registry& registry,
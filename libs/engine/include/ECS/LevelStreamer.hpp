@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LevelStreamer - Scroll-window activation of level content
+*/
+
+#pragma once
+
+#include "LevelLoader.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace RType {
+
+    namespace ECS {
+
+        // Default distance past the right edge of the screen at which level
+        // content is spawned. 1280 + 640 is also where BossSystem catches a
+        // scrolling boss, so the boss arrives exactly as it did before streaming.
+        constexpr float DEFAULT_STREAM_LOOKAHEAD = 640.0f;
+
+        // Server-side replacement for CreateServerEntities: level content is
+        // sorted into a timeline by the time it reaches screenWidth + lookahead
+        // and only spawned then, at the position it would have scrolled to.
+        // Despawning behind the screen stays with ScrollingSystem and
+        // EnemySystem. Obstacle ids match CreateServerEntities.
+        //
+        // The streamer also owns the level scroll: the registry scroll offset is
+        // background speed * level time, and obstacles moving at that speed are
+        // spawned as LevelSpace geometry that is never written again.
+        class LevelStreamer {
+        public:
+            explicit LevelStreamer(float lookahead = DEFAULT_STREAM_LOOKAHEAD);
+
+            // Build the timeline for a level and spawn what is already in the window
+            void Start(Registry& registry, const LevelData& level);
+            void Clear();
+
+            // Start split in two: Prepare only builds the timeline and touches no
+            // registry, so it can run on a loader thread while the current level
+            // plays; Begin then spawns the first window on the tick thread
+            void Prepare(const LevelData& level);
+            void Begin(Registry& registry);
+            bool HasBoss() const { return m_boss.has_value(); }
+
+            // Advance level time and the registry scroll offset;
+            // call after ScrollingSystem moved existing content
+            void Update(Registry& registry, float deltaTime);
+
+            bool IsExhausted() const { return m_cursor >= m_timeline.size(); }
+            std::size_t GetPendingCount() const { return m_timeline.size() - m_cursor; }
+            std::size_t GetTimelineSize() const { return m_timeline.size(); }
+            double GetElapsed() const { return m_elapsed; }
+            float GetScrollSpeed() const { return m_scrollSpeed; }
+            float GetScrollOffset() const { return static_cast<float>(m_scrollSpeed * m_elapsed); }
+            // Everything spawned so far this level; entities may since have been destroyed
+            const CreatedEntities& GetSpawned() const { return m_spawned; }
+
+            // Level time at which an element starting at x and moving at speed
+            // (negative towards the player) crosses windowEdge
+            static float ActivationTime(float x, float speed, float windowEdge);
+
+        private:
+            enum class ItemKind : uint8_t {
+                OBSTACLE,
+                ENEMY,
+                BOSS
+            };
+
+            struct TimelineItem {
+                float activationTime = 0.0f;
+                float speed = 0.0f;
+                bool levelSpace = false;
+                ItemKind kind = ItemKind::OBSTACLE;
+                std::size_t index = 0;
+                uint32_t obstacleId = 0;
+            };
+
+            void Activate(Registry& registry);
+
+            float m_lookahead;
+            std::string m_levelName;
+            float m_scrollSpeed = BackgroundDef{}.scrollSpeed;
+            double m_elapsed = 0.0;  // Accumulated in double so long levels do not drift
+            std::size_t m_cursor = 0;
+            std::vector<TimelineItem> m_timeline;
+            std::vector<ObstacleDef> m_obstacles;
+            std::vector<EnemyDef> m_enemies;
+            std::optional<BossDef> m_boss;
+            CreatedEntities m_spawned;
+        };
+
+    }
+
+}
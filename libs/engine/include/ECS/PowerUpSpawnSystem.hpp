@@ -9,7 +9,7 @@
 
 #include "ISystem.hpp"
 #include "Renderer/IRenderer.hpp"
-#include <random>
+#include "SimulationRng.hpp"
 
 namespace RType {
     namespace ECS {
@@ -33,6 +33,7 @@ namespace RType {
 
             void SetSpawnInterval(float interval) { m_spawnInterval = interval; }
             void SetEffectFactory(const EffectFactory* effectFactory) { m_effectFactory = effectFactory; }
+            void SetRng(SimulationRng* rng) { m_rng = rng ? rng : &m_ownRng; }
 
         private:
             Renderer::IRenderer* m_renderer;
@@ -41,7 +42,8 @@ namespace RType {
             float m_spawnTimer = 0.0f;
             float m_spawnInterval = 5.0f;
             const EffectFactory* m_effectFactory = nullptr;
-            std::mt19937 m_rng;
+            SimulationRng m_ownRng;
+            SimulationRng* m_rng = &m_ownRng;
         };
 
     }
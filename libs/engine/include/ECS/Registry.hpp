@@ -5,10 +5,11 @@
 #include "SparseArray.hpp"
 #include <unordered_map>
 #include <unordered_set>
+#include <algorithm>
+#include <bitset>
 #include <memory>
 #include <vector>
 #include <stdexcept>
-#include <typeindex>
 #include <sstream>
 #include <string>
 #include <functional>
@@ -17,24 +18,44 @@ namespace RType {
 
     namespace ECS {
 
+        // Upper bound on distinct component types, the width of a Signature
+        constexpr std::size_t MAX_COMPONENTS = 128;
+
+        // One bit per component type (see GetComponentID) for each entity
+        using Signature = std::bitset<MAX_COMPONENTS>;
+
         class IComponentPool {
         public:
             virtual ~IComponentPool() = default;
             virtual bool Has(Entity entity) const = 0;
             virtual void Remove(Entity entity) = 0;
+            virtual void SetChangeTick(uint32_t tick) = 0;
+            virtual uint32_t GetChangeTick(Entity entity) const = 0;
         };
 
+        // Typed access needs no virtual call: the class is final, so calls
+        // through a ComponentPool<T> are resolved statically. Adding and
+        // removing go through the Registry, which keeps signatures in step.
+        // Mutable access stamps the component with the registry's change tick.
         template <typename T>
-        class ComponentPool : public IComponentPool {
+        class ComponentPool final : public IComponentPool {
         public:
-            T& Add(Entity entity, T&& component = T{});
             T& Get(Entity entity);
             const T& Get(Entity entity) const;
             bool Has(Entity entity) const override;
-            void Remove(Entity entity) override;
             std::vector<Entity> GetEntities() const;
+            // Tick of the last add or mutable access, 0 if never
+            uint32_t GetChangeTick(Entity entity) const override;
         private:
+            friend class Registry;
+
+            T& Add(Entity entity, T&& component = T{});
+            void Remove(Entity entity) override;
+            void SetChangeTick(uint32_t tick) override { m_tick = tick; }
+
             SparseArray<T> m_components;
+            std::vector<uint32_t> m_changeTicks;  // Indexed by entity
+            uint32_t m_tick = 0;
         };
 
         class Registry {
@@ -64,9 +85,65 @@ namespace RType {
             template <typename T>
             std::vector<Entity> GetEntitiesWithComponent() const;
             size_t GetEntityCount() const { return m_entityCount; }
+
+            template <typename... Ts>
+            static const Signature& MakeSignature();
+            const Signature& GetSignature(Entity entity) const;
+
+            // Whether entity has every one of Ts: a single mask compare
+            template <typename... Ts>
+            bool HasComponents(Entity entity) const;
+
+            // Entities having every one of Ts, in ascending order. The first call for
+            // a set of types builds a cached list; component adds, removes and entity
+            // destruction then update it in place instead of rescanning the pools.
+            // Building the list writes the cache, so queries are not safe to run
+            // concurrently, even on a const Registry: keep them on the thread that
+            // owns the registry, like every other call.
+            template <typename... Ts>
+            std::vector<Entity> GetEntitiesWithComponents() const;
+            // Same, for a signature only known at runtime
+            std::vector<Entity> GetEntitiesWithSignature(const Signature& signature) const;
+
+            // Change tracking. Adds and non-const access (GetComponent, or Get on a
+            // pool) stamp a component with the current tick; adds, removes and
+            // destruction also stamp the entity itself. Read through a const
+            // Registry to leave the stamps alone.
+            uint32_t GetChangeTick() const { return m_changeTick; }
+            void AdvanceChangeTick();
+
+            template <typename T>
+            bool ChangedSince(Entity entity, uint32_t tick) const;
+
+            // Whether any of Ts, or the entity's set of components, changed after tick
+            template <typename... Ts>
+            bool AnyChangedSince(Entity entity, uint32_t tick) const;
+            bool AnyChangedSince(Entity entity, const Signature& components, uint32_t tick) const;
+
+            // Entities having all of Ts where any of them changed after tick, ascending
+            template <typename... Ts>
+            std::vector<Entity> GetEntitiesChangedSince(uint32_t tick) const;
+
+            // Pool of one component type, created if needed. The reference stays
+            // valid for the registry's lifetime, so a system can fetch it once per
+            // update and skip the per-call lookup in its entity loop.
+            template <typename T>
+            ComponentPool<T>& GetComponentPool();
+
+            // Horizontal scroll of the level, added to the Position of LevelSpace entities
+            void SetScrollOffset(float offset) { m_scrollOffset = offset; }
+            float GetScrollOffset() const { return m_scrollOffset; }
         private:
+            struct Query {
+                Signature signature;
+                std::vector<Entity> entities;  // Sorted
+            };
+
             template <typename T>
             ComponentPool<T>* GetOrCreatePool();
+            const Query& GetQuery(const Signature& signature) const;
+            void OnComponentAdded(Entity entity, ComponentID id);
+            void OnComponentRemoved(Entity entity, ComponentID id);
             template <typename T>
             ComponentPool<T>* GetPool();
             template <typename T>
@@ -75,12 +152,25 @@ namespace RType {
             Entity m_nextEntityID;
             size_t m_entityCount;
             std::unordered_set<Entity> m_aliveEntities;
-            std::unordered_map<ComponentID, std::unique_ptr<IComponentPool>> m_componentPools;
+            std::vector<std::unique_ptr<IComponentPool>> m_componentPools;  // Indexed by ComponentID
             std::vector<Entity> m_freeEntityIds;
+            std::vector<Signature> m_signatures;  // Indexed by entity
+            std::vector<uint32_t> m_structureTicks;  // Indexed by entity
+            uint32_t m_changeTick = 1;
+            float m_scrollOffset = 0.0f;
+
+            // Cached multi-component queries; built lazily, hence mutable and unsynchronized
+            mutable std::vector<Query> m_queries;
+            mutable std::unordered_map<Signature, std::size_t> m_queryIndex;
+            mutable std::vector<std::vector<std::size_t>> m_queriesByComponent;  // ComponentID -> m_queries
         };
 
         template <typename T>
         T& ComponentPool<T>::Add(Entity entity, T&& component) {
+            if (entity >= m_changeTicks.size()) {
+                m_changeTicks.resize(entity + 1, 0);
+            }
+            m_changeTicks[entity] = m_tick;
             return m_components.insert_at(entity, std::move(component)).value();
         }
 
@@ -91,6 +181,7 @@ namespace RType {
                 oss << "Component '" << typeid(T).name() << "' not found for entity " << entity;
                 throw std::runtime_error(oss.str());
             }
+            m_changeTicks[entity] = m_tick;
             return m_components[entity].value();
         }
 
@@ -119,6 +210,11 @@ namespace RType {
             m_components.erase(entity);
         }
 
+        template <typename T>
+        uint32_t ComponentPool<T>::GetChangeTick(Entity entity) const {
+            return entity < m_changeTicks.size() && Has(entity) ? m_changeTicks[entity] : 0;
+        }
+
         template <typename T>
         std::vector<Entity> ComponentPool<T>::GetEntities() const {
             std::vector<Entity> entities;
@@ -142,7 +238,12 @@ namespace RType {
                 throw std::runtime_error(oss.str());
             }
             ComponentPool<T>* pool = GetOrCreatePool<T>();
-            return pool->Add(entity, std::forward<T>(component));
+            const bool added = !pool->Has(entity);
+            T& stored = pool->Add(entity, std::forward<T>(component));
+            if (added) {
+                OnComponentAdded(entity, GetComponentID<T>());
+            }
+            return stored;
         }
 
         template <typename T>
@@ -181,52 +282,102 @@ namespace RType {
             ComponentPool<T>* pool = GetPool<T>();
             if (pool) {
                 pool->Remove(entity);
+                OnComponentRemoved(entity, GetComponentID<T>());
             }
         }
 
         template <typename T>
         std::vector<Entity> Registry::GetEntitiesWithComponent() const {
+            return GetEntitiesWithComponents<T>();
+        }
+
+        template <typename... Ts>
+        const Signature& Registry::MakeSignature() {
+            static const Signature signature = [] {
+                Signature bits;
+                (bits.set(GetComponentID<Ts>()), ...);
+                return bits;
+            }();
+            return signature;
+        }
+
+        template <typename... Ts>
+        bool Registry::HasComponents(Entity entity) const {
+            const Signature& mask = MakeSignature<Ts...>();
+            return entity < m_signatures.size() && (m_signatures[entity] & mask) == mask;
+        }
+
+        template <typename... Ts>
+        std::vector<Entity> Registry::GetEntitiesWithComponents() const {
+            return GetEntitiesWithSignature(MakeSignature<Ts...>());
+        }
+
+        template <typename T>
+        bool Registry::ChangedSince(Entity entity, uint32_t tick) const {
             const ComponentPool<T>* pool = GetPool<T>();
-            if (!pool) {
-                return std::vector<Entity>();
+            return pool && pool->GetChangeTick(entity) > tick;
+        }
+
+        template <typename... Ts>
+        bool Registry::AnyChangedSince(Entity entity, uint32_t tick) const {
+            if (entity < m_structureTicks.size() && m_structureTicks[entity] > tick) {
+                return true;
             }
-            return pool->GetEntities();
+            return (ChangedSince<Ts>(entity, tick) || ...);
+        }
+
+        template <typename... Ts>
+        std::vector<Entity> Registry::GetEntitiesChangedSince(uint32_t tick) const {
+            std::vector<Entity> changed;
+            for (Entity entity : GetQuery(MakeSignature<Ts...>()).entities) {
+                if (AnyChangedSince<Ts...>(entity, tick)) {
+                    changed.push_back(entity);
+                }
+            }
+            return changed;
+        }
+
+        template <typename T>
+        ComponentPool<T>& Registry::GetComponentPool() {
+            return *GetOrCreatePool<T>();
         }
 
         template <typename T>
         ComponentPool<T>* Registry::GetOrCreatePool() {
-            ComponentID typeID = std::type_index(typeid(T));
-            auto it = m_componentPools.find(typeID);
-            if (it == m_componentPools.end()) {
-                auto pool = std::make_unique<ComponentPool<T>>();
-                ComponentPool<T>* poolPtr = pool.get();
-                m_componentPools[typeID] = std::move(pool);
-                return poolPtr;
+            const ComponentID id = GetComponentID<T>();
+            if (id >= MAX_COMPONENTS) {
+                std::ostringstream oss;
+                oss << "Component type '" << typeid(T).name() << "' exceeds MAX_COMPONENTS (" << MAX_COMPONENTS << ")";
+                throw std::runtime_error(oss.str());
+            }
+            if (id >= m_componentPools.size()) {
+                m_componentPools.resize(id + 1);
             }
-            return static_cast<ComponentPool<T>*>(it->second.get());
+            if (!m_componentPools[id]) {
+                m_componentPools[id] = std::make_unique<ComponentPool<T>>();
+                m_componentPools[id]->SetChangeTick(m_changeTick);
+            }
+            return static_cast<ComponentPool<T>*>(m_componentPools[id].get());
         }
 
         template <typename T>
         ComponentPool<T>* Registry::GetPool() {
-            ComponentID typeID = std::type_index(typeid(T));
-            auto it = m_componentPools.find(typeID);
-            if (it == m_componentPools.end()) {
+            const ComponentID id = GetComponentID<T>();
+            if (id >= m_componentPools.size()) {
                 return nullptr;
             }
-            return static_cast<ComponentPool<T>*>(it->second.get());
+            return static_cast<ComponentPool<T>*>(m_componentPools[id].get());
         }
 
         template <typename T>
         const ComponentPool<T>* Registry::GetPool() const {
-            ComponentID typeID = std::type_index(typeid(T));
-            auto it = m_componentPools.find(typeID);
-            if (it == m_componentPools.end()) {
+            const ComponentID id = GetComponentID<T>();
+            if (id >= m_componentPools.size()) {
                 return nullptr;
             }
-            return static_cast<const ComponentPool<T>*>(it->second.get());
+            return static_cast<const ComponentPool<T>*>(m_componentPools[id].get());
         }
 
-
     }
 
 }
\ No newline at end of file
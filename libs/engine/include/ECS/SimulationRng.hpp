@@ -0,0 +1,47 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SimulationRng - seeded random source shared by the systems of one room
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+
+namespace RType {
+    namespace ECS {
+
+        // Every gameplay random draw of a room goes through one of these, so a
+        // seed plus the recorded inputs reproduce the exact same run.
+        // Draws avoid std::*_distribution on purpose: their output is
+        // implementation-defined and would differ between standard libraries.
+        class SimulationRng {
+        public:
+            explicit SimulationRng(uint64_t seed = std::random_device{}()) { Reseed(seed); }
+
+            void Reseed(uint64_t seed) {
+                m_seed = seed;
+                m_engine.seed(static_cast<std::mt19937::result_type>(seed ^ (seed >> 32)));
+            }
+            uint64_t GetSeed() const { return m_seed; }
+
+            // Uniform in [min, max)
+            float NextFloat(float min, float max) {
+                const float unit = static_cast<float>(m_engine() >> 8) * (1.0f / 16777216.0f);
+                return min + unit * (max - min);
+            }
+
+            // Uniform in [min, max]
+            int NextInt(int min, int max) {
+                const uint32_t range = static_cast<uint32_t>(max - min) + 1u;
+                return min + static_cast<int>(m_engine() % range);
+            }
+        private:
+            std::mt19937 m_engine;
+            uint64_t m_seed = 0;
+        };
+
+    }
+}
@@ -4,6 +4,7 @@
 #include "Core/Platform.hpp"
 #include <cstdint>
 #include <string>
+#include <vector>
 #include "Core/Module.hpp"
 #include "Math/Types.hpp"
 
@@ -36,11 +37,25 @@ namespace Renderer {
         bool generateMipmaps = false;
     };
 
+    struct AtlasConfig {
+        std::uint32_t pageSize = 2048;
+        std::uint32_t maxImageSize = 1024;  // Larger images keep a texture of their own
+        std::uint32_t padding = 2;
+    };
+
+    // CPU-side decoded image, produced off the main thread by DecodeImage
+    struct ImageData {
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::vector<std::uint8_t> pixels;  // RGBA8, row-major; may be empty if the backend does not need them
+    };
+
     struct Transform2D {
         Vector2 position{0.0f, 0.0f};
         Vector2 scale{1.0f, 1.0f};
         float rotation = 0.0f;
         Vector2 origin{0.0f, 0.0f};
+        int layer = 0;  // Sprites queued in a frame are drawn by layer, lowest first
     };
 
     struct TextParams {
@@ -61,6 +76,9 @@ namespace Renderer {
     struct RenderStats {
         std::uint32_t drawCalls = 0;
         std::uint32_t textureSwitches = 0;
+        std::uint32_t batches = 0;     // Sprite batches flushed this frame
+        std::uint32_t sprites = 0;     // Sprites drawn through batches
+        std::uint32_t vertices = 0;    // Vertices submitted by sprite batches
     };
 
     enum class Key {
@@ -141,8 +159,24 @@ namespace Renderer {
         virtual TextureId LoadTexture(const std::string& path,
                                       const TextureConfig& config = TextureConfig{}) = 0;
         virtual void UnloadTexture(TextureId textureId) = 0;
+
+        // Decode an image file without touching the GPU. Safe to call from worker threads.
+        virtual bool DecodeImage(const std::string& path, ImageData& image) const = 0;
+
+        // Upload an image decoded by DecodeImage (main thread). The texture is cached
+        // under path exactly like LoadTexture, so later loads of the same file hit it.
+        virtual TextureId CreateTextureFromImage(const std::string& path, const ImageData& image,
+                                                 const TextureConfig& config = TextureConfig{}) = 0;
         virtual Vector2 GetTextureSize(TextureId textureId) const = 0;
 
+        // Pack image files into shared atlas pages. LoadTexture on a packed path
+        // then returns a view of its page: sizes and sprite regions stay relative
+        // to the original image, while the sprites of every packed image draw
+        // from one texture and batch together. Paths already loaded are skipped.
+        // Returns the number of images packed.
+        virtual std::size_t BuildTextureAtlas(const std::vector<std::string>& paths,
+                                              const AtlasConfig& config = AtlasConfig{}) = 0;
+
         virtual SpriteId CreateSprite(TextureId textureId, const Rectangle& region) = 0;
         virtual void DestroySprite(SpriteId spriteId) = 0;
 
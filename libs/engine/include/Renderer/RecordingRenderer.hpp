@@ -0,0 +1,187 @@
+#pragma once
+
+#include "IRenderer.hpp"
+#include "SpriteBatch.hpp"
+#include "ResourceCache.hpp"
+#include "TextureAtlas.hpp"
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace Renderer {
+
+    enum class DrawCommandType : std::uint8_t {
+        Clear,
+        Sprite,
+        Rectangle,
+        Text,
+        SetCamera,
+        ResetCamera
+    };
+
+    // One recorded call. Plain data so a frame's command list is a single
+    // contiguous vector; text lives in a shared per-frame buffer.
+    struct DrawCommand {
+        DrawCommandType type = DrawCommandType::Clear;
+        int layer = 0;
+        TextureId textureId = INVALID_TEXTURE_ID;
+        SpriteId spriteId = INVALID_SPRITE_ID;
+        FontId fontId = INVALID_FONT_ID;
+        Rectangle bounds{};  // Sprite/rectangle/text area in world units, camera view for SetCamera
+        Color color{};
+        std::uint32_t textOffset = 0;
+        std::uint32_t textLength = 0;
+    };
+
+    // Window-less IRenderer: records every draw call of a frame into a command
+    // list and computes the same batch statistics as SFMLRenderer, so render
+    // systems and client states can run and be measured without a display.
+    // Optionally rasterizes the frame into an RGBA8 image in memory.
+    class RecordingRenderer : public IRenderer {
+    public:
+        RecordingRenderer() = default;
+        ~RecordingRenderer() override = default;
+
+        const char* GetName() const override { return "RecordingRenderer"; }
+        RType::Core::ModulePriority GetPriority() const override {
+            return RType::Core::ModulePriority::High;
+        }
+        bool Initialize(RType::Core::Engine* engine) override;
+        void Shutdown() override;
+        void Update(float deltaTime) override;
+
+        bool CreateWindow(const WindowConfig& config) override;
+        void Destroy() override;
+        bool IsWindowOpen() const override { return m_windowOpen; }
+        void Resize(std::uint32_t width, std::uint32_t height) override;
+        void SetWindowTitle(const std::string& title) override { m_windowConfig.title = title; }
+
+        void BeginFrame() override;
+        void EndFrame() override;
+        void Clear(const Color& color) override;
+
+        // Textures are not decoded; PNG dimensions are read from the file header
+        TextureId LoadTexture(const std::string& path,
+                              const TextureConfig& config = TextureConfig{}) override;
+        void UnloadTexture(TextureId textureId) override;
+        bool DecodeImage(const std::string& path, ImageData& image) const override;
+        TextureId CreateTextureFromImage(const std::string& path, const ImageData& image,
+                                         const TextureConfig& config = TextureConfig{}) override;
+        Vector2 GetTextureSize(TextureId textureId) const override;
+        std::size_t BuildTextureAtlas(const std::vector<std::string>& paths,
+                                      const AtlasConfig& config = AtlasConfig{}) override;
+
+        SpriteId CreateSprite(TextureId textureId, const Rectangle& region) override;
+        void DestroySprite(SpriteId spriteId) override;
+        void SetSpriteRegion(SpriteId spriteId, const Rectangle& region) override;
+
+        void DrawSprite(SpriteId spriteId, const Transform2D& transform,
+                        const Color& tint = Color{}) override;
+        void DrawRectangle(const Rectangle& rectangle, const Color& color) override;
+
+        FontId LoadFont(const std::string& path, std::uint32_t characterSize) override;
+        void UnloadFont(FontId fontId) override;
+        void DrawText(FontId fontId, const std::string& text, const TextParams& params) override;
+
+        void SetCamera(const Camera2D& camera) override;
+        void ResetCamera() override;
+
+        RenderStats GetRenderStats() const override { return m_stats; }
+
+        // Returns the fixed step so that headless runs are deterministic
+        float GetDeltaTime() override { return m_fixedDeltaTime; }
+
+        bool IsKeyPressed(Key key) const override;
+        bool IsMouseButtonPressed(MouseButton button) const override;
+        Vector2 GetMousePosition() const override { return m_mousePosition; }
+
+        // Commands recorded since the last BeginFrame
+        const std::vector<DrawCommand>& GetCommands() const { return m_commands; }
+        std::string GetCommandText(const DrawCommand& command) const;
+        std::map<TextureId, std::uint32_t> CountSpritesByTexture() const;
+        std::map<int, std::uint32_t> CountSpritesByLayer() const;
+
+        // Give a texture real pixels (RGBA8, row-major) for the rasterizer;
+        // without them sprites are filled with their tint.
+        void SetTexturePixels(TextureId textureId, std::uint32_t width, std::uint32_t height,
+                              std::vector<std::uint32_t> pixels);
+
+        // Software rasterizer output, window-sized, cleared by Clear()
+        void SetRasterizationEnabled(bool enabled);
+        bool IsRasterizationEnabled() const { return m_rasterize; }
+        const std::vector<std::uint32_t>& GetFramebuffer() const { return m_framebuffer; }
+        std::uint32_t GetPixel(std::uint32_t x, std::uint32_t y) const;
+
+        // Number of texture loads served from the cache / read from disk
+        std::uint64_t GetTextureCacheHits() const { return m_textures.GetHits(); }
+        std::uint64_t GetTextureCacheMisses() const { return m_textures.GetMisses(); }
+        std::size_t GetLoadedTextureCount() const { return m_textures.Size(); }
+
+        // Texture a sprite draws from: an atlas page for sprites of packed images
+        TextureId GetSpriteTexture(SpriteId spriteId) const;
+
+        // Scripted input for driving client states
+        void SetFixedDeltaTime(float deltaTime) { m_fixedDeltaTime = deltaTime; }
+        void SetKeyPressed(Key key, bool pressed);
+        void SetMouseButtonPressed(MouseButton button, bool pressed);
+        void SetMousePosition(const Vector2& position) { m_mousePosition = position; }
+
+        static std::uint32_t PackColor(const Color& color);
+
+    private:
+        struct TextureData {
+            std::string path;
+            Vector2 size{0.0f, 0.0f};
+            std::uint32_t width = 0;
+            std::uint32_t height = 0;
+            std::vector<std::uint32_t> pixels;
+            // Views into an atlas page: sprites draw from the page, offset by atlasOffset
+            TextureId atlasPage = INVALID_TEXTURE_ID;
+            Vector2 atlasOffset{0.0f, 0.0f};
+        };
+
+        struct SpriteData {
+            TextureId textureId = INVALID_TEXTURE_ID;
+            Rectangle region{};
+            Vector2 atlasOffset{0.0f, 0.0f};
+        };
+
+        struct FontData {
+            std::string path;
+            std::uint32_t characterSize = 0;
+        };
+
+        static TextureData MakeTextureData(const std::string& path, const ImageData& image);
+        void FlushSprites();
+        void RasterizeBatches();
+        void FillRectangle(const Rectangle& rectangle, const Color& color);
+        void BlendPixel(std::uint32_t x, std::uint32_t y, std::uint32_t rgba);
+        Vector2 WorldToPixel(const Vector2& point) const;
+
+        WindowConfig m_windowConfig;
+        bool m_windowOpen = false;
+        Camera2D m_defaultCamera;
+        Camera2D m_camera;
+
+        ResourceCache<TextureId, TextureData> m_textures;
+        std::unordered_map<SpriteId, SpriteData> m_sprites;
+        SpriteId m_nextSpriteId = 1;
+        ResourceCache<FontId, FontData> m_fonts;
+        std::size_t m_atlasPageCount = 0;
+
+        std::vector<DrawCommand> m_commands;
+        std::string m_textBuffer;
+        SpriteBatch m_spriteBatch;
+        TextureId m_lastBatchTexture = INVALID_TEXTURE_ID;
+        RenderStats m_stats;
+
+        bool m_rasterize = false;
+        std::vector<std::uint32_t> m_framebuffer;
+
+        float m_fixedDeltaTime = 1.0f / 60.0f;
+        std::vector<bool> m_keys;
+        bool m_mouseButtons[3] = {false, false, false};
+        Vector2 m_mousePosition{0.0f, 0.0f};
+    };
+
+}
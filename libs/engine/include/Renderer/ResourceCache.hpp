@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include "Renderer/IRenderer.hpp"
+
+namespace Renderer {
+
+    // Canonical form of an asset path, so that "assets/a.png" and
+    // "./client/../assets/a.png" share one cache entry
+    inline std::string NormalizeAssetPath(const std::string& path) {
+        std::error_code error;
+        auto canonical = std::filesystem::weakly_canonical(std::filesystem::path(path), error);
+        return error ? path : canonical.string();
+    }
+
+    // Path-keyed, reference-counted store for loaded resources (textures,
+    // fonts). Loading the same key again hands back the existing id and takes
+    // a reference; the resource is evicted when its last reference is released.
+    // Id 0 is reserved as the invalid id.
+    template <typename Id, typename Resource>
+    class ResourceCache {
+    public:
+        // Id already loaded under key, with one more reference taken, or 0
+        Id Acquire(const std::string& key) {
+            auto it = m_keys.find(key);
+            if (it == m_keys.end()) {
+                m_misses++;
+                return Id{0};
+            }
+            m_entries[it->second].refCount++;
+            m_hits++;
+            return it->second;
+        }
+
+        // Store a freshly loaded resource with a single reference
+        Id Insert(const std::string& key, Resource resource) {
+            Id id = m_nextId++;
+            m_entries[id] = Entry{key, 1, std::move(resource)};
+            m_keys[key] = id;
+            return id;
+        }
+
+        // Drop one reference; returns true if the resource was evicted
+        bool Release(Id id) {
+            auto it = m_entries.find(id);
+            if (it == m_entries.end()) {
+                return false;
+            }
+            if (--it->second.refCount > 0) {
+                return false;
+            }
+            m_keys.erase(it->second.key);
+            m_entries.erase(it);
+            return true;
+        }
+
+        Resource* Get(Id id) {
+            auto it = m_entries.find(id);
+            return (it != m_entries.end()) ? &it->second.resource : nullptr;
+        }
+
+        const Resource* Get(Id id) const {
+            auto it = m_entries.find(id);
+            return (it != m_entries.end()) ? &it->second.resource : nullptr;
+        }
+
+        bool Contains(Id id) const { return m_entries.find(id) != m_entries.end(); }
+
+        // Id loaded under key without taking a reference or counting a hit, or 0
+        Id Find(const std::string& key) const {
+            auto it = m_keys.find(key);
+            return (it != m_keys.end()) ? it->second : Id{0};
+        }
+
+        std::uint32_t GetRefCount(Id id) const {
+            auto it = m_entries.find(id);
+            return (it != m_entries.end()) ? it->second.refCount : 0;
+        }
+
+        std::size_t Size() const { return m_entries.size(); }
+        std::uint64_t GetHits() const { return m_hits; }
+        std::uint64_t GetMisses() const { return m_misses; }
+
+        // Evict everything regardless of references; ids are not reused
+        void Clear() {
+            m_entries.clear();
+            m_keys.clear();
+        }
+
+    private:
+        struct Entry {
+            std::string key;
+            std::uint32_t refCount = 0;
+            Resource resource;
+        };
+
+        std::unordered_map<Id, Entry> m_entries;
+        std::unordered_map<std::string, Id> m_keys;
+        Id m_nextId = 1;
+        std::uint64_t m_hits = 0;
+        std::uint64_t m_misses = 0;
+    };
+
+    // Cache key of a texture: the same file loaded with other sampling settings is another texture
+    inline std::string TextureCacheKey(const std::string& path, const TextureConfig& config) {
+        return NormalizeAssetPath(path) + (config.smooth ? "|smooth" : "|sharp") +
+               (config.repeated ? "|repeated" : "");
+    }
+
+}
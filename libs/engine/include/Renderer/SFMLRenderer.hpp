@@ -1,6 +1,9 @@
 #pragma once
 
 #include "IRenderer.hpp"
+#include "SpriteBatch.hpp"
+#include "ResourceCache.hpp"
+#include "TextureAtlas.hpp"
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <unordered_map>
@@ -32,7 +35,12 @@ namespace Renderer {
         TextureId LoadTexture(const std::string& path,
                               const TextureConfig& config = TextureConfig{}) override;
         void UnloadTexture(TextureId textureId) override;
+        bool DecodeImage(const std::string& path, ImageData& image) const override;
+        TextureId CreateTextureFromImage(const std::string& path, const ImageData& image,
+                                         const TextureConfig& config = TextureConfig{}) override;
         Vector2 GetTextureSize(TextureId textureId) const override;
+        std::size_t BuildTextureAtlas(const std::vector<std::string>& paths,
+                                      const AtlasConfig& config = AtlasConfig{}) override;
 
         SpriteId CreateSprite(TextureId textureId, const Rectangle& region) override;
         void DestroySprite(SpriteId spriteId) override;
@@ -65,6 +73,11 @@ namespace Renderer {
         static sf::Vector2f ToSFMLVector(const Vector2& vec);
         static sf::IntRect ToSFMLRect(const Rectangle& rect);
         static sf::Keyboard::Key ToSFMLKey(Key key);
+        static std::shared_ptr<sf::Texture> CreateSFMLTexture(const ImageData& image, const TextureConfig& config);
+
+        // Draw the sprites queued since the last flush, one draw call per batch.
+        // Called before anything that must appear above them or changes the view.
+        void FlushSprites();
 
         std::unique_ptr<sf::RenderWindow> m_window;
         WindowConfig m_windowConfig;
@@ -72,13 +85,16 @@ namespace Renderer {
         struct TextureData {
             std::shared_ptr<sf::Texture> texture;
             TextureConfig config;
+            // Views into an atlas page share its texture; sprites draw from the page
+            TextureId atlasPage = INVALID_TEXTURE_ID;
+            Rectangle atlasRegion{};
         };
-        std::unordered_map<TextureId, TextureData> m_textures;
-        TextureId m_nextTextureId = 1;
+        ResourceCache<TextureId, TextureData> m_textures;
 
         struct SpriteData {
-            sf::Sprite sprite;
             TextureId textureId;
+            Rectangle region;
+            Vector2 atlasOffset{0.0f, 0.0f};
         };
         std::unordered_map<SpriteId, SpriteData> m_sprites;
         SpriteId m_nextSpriteId = 1;
@@ -87,8 +103,10 @@ namespace Renderer {
             std::shared_ptr<sf::Font> font;
             std::uint32_t characterSize;
         };
-        std::unordered_map<FontId, FontData> m_fonts;
-        FontId m_nextFontId = 1;
+        ResourceCache<FontId, FontData> m_fonts;
+        std::size_t m_atlasPageCount = 0;
+        // Decoded font files shared by every character size loaded from them
+        std::unordered_map<std::string, std::weak_ptr<sf::Font>> m_fontFiles;
 
         sf::View m_defaultView;
         sf::View m_currentView;
@@ -97,6 +115,9 @@ namespace Renderer {
         RType::Core::Engine* m_engine = nullptr;
 
         RenderStats m_stats;
+        SpriteBatch m_spriteBatch;
+        sf::VertexArray m_batchVertices{sf::Triangles};
+        TextureId m_lastBatchTexture = INVALID_TEXTURE_ID;
 
         sf::Clock m_clock;
         float m_lastDeltaTime = 0.0f;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Renderer/IRenderer.hpp"
+
+namespace Renderer {
+
+    struct BatchVertex {
+        Vector2 position{0.0f, 0.0f};
+        Vector2 texCoords{0.0f, 0.0f};  // In texture pixels
+        Color color{};
+    };
+
+    // Backend-independent sprite batcher: sprites queued during a frame are
+    // expanded into textured triangles, ordered by layer then texture, and
+    // grouped so that each run sharing a texture can be drawn in one call.
+    class SpriteBatch {
+    public:
+        static constexpr std::size_t VERTICES_PER_SPRITE = 6;
+
+        struct Batch {
+            TextureId textureId = INVALID_TEXTURE_ID;
+            std::size_t firstVertex = 0;
+            std::size_t vertexCount = 0;
+        };
+
+        // Queue a sprite showing the given texture region (pixels) with an SFML-style transform
+        void Add(TextureId textureId, const Rectangle& region,
+                 const Transform2D& transform, const Color& color);
+
+        // Sort queued sprites and rebuild the vertex and batch lists
+        void Build();
+
+        // Drop queued sprites and built batches; capacity is kept for the next frame
+        void Clear();
+
+        bool IsEmpty() const { return m_sprites.empty(); }
+        std::size_t GetSpriteCount() const { return m_sprites.size(); }
+        const std::vector<BatchVertex>& GetVertices() const { return m_vertices; }
+        const std::vector<Batch>& GetBatches() const { return m_batches; }
+
+    private:
+        struct QueuedSprite {
+            int layer = 0;
+            TextureId textureId = INVALID_TEXTURE_ID;
+            Vector2 corners[4];  // Top-left, top-right, bottom-right, bottom-left
+            Rectangle region;
+            Color color;
+        };
+
+        std::vector<QueuedSprite> m_sprites;
+        std::vector<std::size_t> m_order;
+        std::vector<BatchVertex> m_vertices;
+        std::vector<Batch> m_batches;
+    };
+
+}
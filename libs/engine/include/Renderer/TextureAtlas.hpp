@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Renderer/IRenderer.hpp"
+
+namespace Renderer {
+
+    // Where one packed image ended up
+    struct AtlasEntry {
+        std::string path;
+        std::size_t page = 0;
+        Rectangle region{};  // Pixels inside the page, padding excluded
+    };
+
+    // Packs many small images into a few large pages, so that sprites using
+    // any of them share a texture and end up in the same SpriteBatch batch.
+    // Shelf packing by decreasing height; every image is surrounded by
+    // `padding` copies of its own edge pixels so smooth sampling at a sprite
+    // border never picks up a neighbour.
+    class TextureAtlasBuilder {
+    public:
+        explicit TextureAtlasBuilder(const AtlasConfig& config = AtlasConfig{});
+
+        // Queue an image; refused if empty or larger than config.maxImageSize
+        bool Add(const std::string& path, ImageData image);
+
+        // Pack queued images into pages. Pages carry pixels only if the added images did.
+        void Build();
+
+        const std::vector<ImageData>& GetPages() const { return m_pages; }
+        const std::vector<AtlasEntry>& GetEntries() const { return m_entries; }
+
+        // Every .png below the given directories, sorted for a stable layout
+        static std::vector<std::string> CollectImages(const std::vector<std::string>& directories);
+
+    private:
+        struct PendingImage {
+            std::string path;
+            ImageData image;
+        };
+
+        void Blit(ImageData& page, const ImageData& image, std::uint32_t x, std::uint32_t y) const;
+
+        AtlasConfig m_config;
+        std::vector<PendingImage> m_images;
+        std::vector<ImageData> m_pages;
+        std::vector<AtlasEntry> m_entries;
+    };
+
+}
@@ -31,7 +31,9 @@ namespace Animation {
         }
 
         AnimationClipId id = m_nextClipId++;
-        m_clips[id] = config;
+        CompiledClip& clip = m_clips[id];
+        clip.config = config;
+        CompileClip(clip);
         m_clipNameToId[config.name] = id;
 
         return id;
@@ -49,43 +51,30 @@ namespace Animation {
         config.name = name;
         config.texturePath = texturePath;
         config.looping = looping;
+        AppendGridFrames(layout, config);
 
-        std::uint32_t totalFrames = layout.columns * layout.rows;
-        std::uint32_t frameCount = (layout.frameCount > 0) ?
-            std::min(layout.frameCount, totalFrames - layout.startFrame) :
-            totalFrames - layout.startFrame;
-
-        config.frames.reserve(frameCount);
-
-        for (std::uint32_t i = 0; i < frameCount; ++i) {
-            std::uint32_t frameIndex = layout.startFrame + i;
-            std::uint32_t col = frameIndex % layout.columns;
-            std::uint32_t row = frameIndex / layout.columns;
-
-            FrameDef frame;
-            frame.region.position.x = static_cast<float>(col) * layout.frameWidth;
-            frame.region.position.y = static_cast<float>(row) * layout.frameHeight;
-            frame.region.size.x = layout.frameWidth;
-            frame.region.size.y = layout.frameHeight;
-            frame.duration = layout.defaultDuration;
+        return CreateClip(config);
+    }
 
-            config.frames.push_back(frame);
+    AnimationClipId AnimationModule::LoadClipFromJson(const std::string& path) {
+        AnimationClipConfig config;
+        if (!ParseClipFile(path, config)) {
+            return INVALID_CLIP_ID;
         }
-
         return CreateClip(config);
     }
 
-    AnimationClipId AnimationModule::LoadClipFromJson(const std::string& path) {
+    bool AnimationModule::ParseClipFile(const std::string& path, AnimationClipConfig& config) {
         std::ifstream file(path);
         if (!file.is_open()) {
-            return INVALID_CLIP_ID;
+            return false;
         }
 
         try {
             nlohmann::json json;
             file >> json;
 
-            AnimationClipConfig config;
+            config = AnimationClipConfig{};
             config.name = json.value("name", "");
             config.texturePath = json.value("texture", "");
             config.looping = json.value("looping", false);
@@ -109,7 +98,13 @@ namespace Animation {
                     layout.frameHeight = json["frameHeight"].get<float>();
                 }
 
-                return CreateClipFromGrid(config.name, config.texturePath, layout, config.looping);
+                // Grid clips keep the default playback speed, as CreateClipFromGrid does
+                config.playbackSpeed = 1.0f;
+                if (layout.columns == 0 || layout.rows == 0) {
+                    return false;
+                }
+                AppendGridFrames(layout, config);
+                return !config.name.empty();
             }
 
             if (json.contains("frames")) {
@@ -125,37 +120,69 @@ namespace Animation {
                 }
             }
 
-            return CreateClip(config);
+            return true;
+
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+
+    std::vector<AnimationClipConfig> AnimationModule::ParseManifest(const std::string& manifestPath) {
+        std::vector<AnimationClipConfig> configs;
+        for (const auto& clipPath : ParseManifestClipPaths(manifestPath)) {
+            AnimationClipConfig config;
+            if (ParseClipFile(clipPath, config)) {
+                configs.push_back(std::move(config));
+            }
+        }
+        return configs;
+    }
+
+    std::vector<std::string> AnimationModule::ParseManifestClipPaths(const std::string& manifestPath) {
+        std::vector<std::string> clipPaths;
+
+        std::ifstream file(manifestPath);
+        if (!file.is_open()) {
+            return clipPaths;
+        }
+
+        try {
+            nlohmann::json json;
+            file >> json;
+
+            if (json.contains("clips")) {
+                for (const auto& clipPath : json["clips"]) {
+                    clipPaths.push_back(clipPath.get<std::string>());
+                }
+            }
 
         } catch (const std::exception&) {
-            return INVALID_CLIP_ID;
         }
+
+        return clipPaths;
     }
 
     void AnimationModule::DestroyClip(AnimationClipId clipId) {
         auto it = m_clips.find(clipId);
         if (it != m_clips.end()) {
-            m_clipNameToId.erase(it->second.name);
+            m_clipNameToId.erase(it->second.config.name);
             m_clips.erase(it);
         }
     }
 
     const AnimationClipConfig* AnimationModule::GetClipConfig(AnimationClipId clipId) const {
-        auto it = m_clips.find(clipId);
-        return (it != m_clips.end()) ? &it->second : nullptr;
+        const auto* clip = FindClip(clipId);
+        return clip ? &clip->config : nullptr;
     }
 
     float AnimationModule::GetClipDuration(AnimationClipId clipId) const {
-        const auto* config = GetClipConfig(clipId);
-        if (!config) {
-            return 0.0f;
-        }
-        return CalculateClipDuration(*config);
+        const auto* clip = FindClip(clipId);
+        return clip ? clip->duration : 0.0f;
     }
 
     std::size_t AnimationModule::GetClipFrameCount(AnimationClipId clipId) const {
-        const auto* config = GetClipConfig(clipId);
-        return config ? config->frames.size() : 0;
+        const auto* clip = FindClip(clipId);
+        return clip ? clip->config.frames.size() : 0;
     }
 
     bool AnimationModule::IsClipValid(AnimationClipId clipId) const {
@@ -165,71 +192,106 @@ namespace Animation {
     FrameDef AnimationModule::GetFrameAtTime(AnimationClipId clipId,
                                              float time,
                                              bool looping) const {
-        const auto* config = GetClipConfig(clipId);
-        if (!config || config->frames.empty()) {
+        const auto* clip = FindClip(clipId);
+        if (!clip || clip->config.frames.empty()) {
             return FrameDef{};
         }
 
-        std::size_t frameIndex = GetFrameIndexAtTime(clipId, time, looping);
-        if (frameIndex < config->frames.size()) {
-            return config->frames[frameIndex];
-        }
-
-        return config->frames.back();
+        return clip->config.frames[GetFrameIndexAtTime(clipId, time, looping)];
     }
 
     std::size_t AnimationModule::GetFrameIndexAtTime(AnimationClipId clipId,
                                                      float time,
                                                      bool looping) const {
-        const auto* config = GetClipConfig(clipId);
-        if (!config || config->frames.empty()) {
+        const auto* clip = FindClip(clipId);
+        if (!clip || clip->duration <= 0.0f) {
             return 0;
         }
 
-        float duration = CalculateClipDuration(*config);
-        if (duration <= 0.0f) {
-            return 0;
-        }
+        return FrameIndexAt(*clip, NormalizeTime(*clip, time, looping));
+    }
 
-        float normalizedTime = time;
-        if (looping) {
-            normalizedTime = std::fmod(time, duration);
-            if (normalizedTime < 0.0f) {
-                normalizedTime += duration;
+    void AnimationModule::AdvanceClips(ClipCursor* cursors, std::size_t count, float deltaTime) const {
+        // Sprites spawned together (explosions, bullets) tend to share a clip,
+        // so consecutive cursors usually hit the same table.
+        AnimationClipId cachedId = INVALID_CLIP_ID;
+        const CompiledClip* clip = nullptr;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            ClipCursor& cursor = cursors[i];
+            if (cursor.clipId != cachedId) {
+                cachedId = cursor.clipId;
+                clip = FindClip(cachedId);
             }
-        } else {
-            normalizedTime = std::clamp(time, 0.0f, duration);
-        }
 
-        float accumulated = 0.0f;
-        for (std::size_t i = 0; i < config->frames.size(); ++i) {
-            accumulated += config->frames[i].duration;
-            if (normalizedTime < accumulated) {
-                return i;
+            cursor.finished = false;
+            if (!clip || clip->duration <= 0.0f) {
+                cursor.frame = nullptr;
+                continue;
             }
-        }
 
-        return config->frames.size() - 1;
+            cursor.time += deltaTime * cursor.playbackSpeed;
+            if (cursor.time >= clip->duration) {
+                if (cursor.looping) {
+                    cursor.time = std::fmod(cursor.time, clip->duration);
+                } else {
+                    cursor.time = clip->duration;
+                    cursor.finished = true;
+                }
+            }
+
+            cursor.frameIndex = FrameIndexAt(*clip, NormalizeTime(*clip, cursor.time, cursor.looping));
+            cursor.frame = &clip->config.frames[cursor.frameIndex];
+        }
     }
 
     void AnimationModule::LoadAnimationsFromManifest(const std::string& manifestPath) {
-        std::ifstream file(manifestPath);
-        if (!file.is_open()) {
-            return;
+        for (const auto& config : ParseManifest(manifestPath)) {
+            CreateClip(config);
         }
+    }
 
-        try {
-            nlohmann::json json;
-            file >> json;
-
-            if (json.contains("clips")) {
-                for (const auto& clipPath : json["clips"]) {
-                    LoadClipFromJson(clipPath.get<std::string>());
+    void AnimationModule::LoadAnimationsFromManifestAsync(const std::string& manifestPath,
+                                                          RType::Core::AssetLoader& loader,
+                                                          RType::Core::AssetPriority priority) {
+        using RType::Core::AssetLoader;
+
+        loader.Enqueue([this, &loader, manifestPath, priority]() -> AssetLoader::Completion {
+            auto clipPaths = std::make_shared<std::vector<std::string>>(ParseManifestClipPaths(manifestPath));
+
+            return [this, &loader, clipPaths, priority]() {
+                // Completions run on the polling thread only, so the shared batch needs no lock
+                struct Batch {
+                    std::vector<AnimationClipConfig> configs;
+                    std::vector<bool> parsed;
+                    std::size_t pending = 0;
+                };
+                auto batch = std::make_shared<Batch>();
+                batch->configs.resize(clipPaths->size());
+                batch->parsed.resize(clipPaths->size(), false);
+                batch->pending = clipPaths->size();
+
+                for (std::size_t i = 0; i < clipPaths->size(); ++i) {
+                    loader.Enqueue([this, batch, i, path = (*clipPaths)[i]]() -> AssetLoader::Completion {
+                        auto config = std::make_shared<AnimationClipConfig>();
+                        const bool ok = ParseClipFile(path, *config);
+
+                        return [this, batch, i, config, ok]() {
+                            batch->configs[i] = std::move(*config);
+                            batch->parsed[i] = ok;
+                            if (--batch->pending > 0) {
+                                return;
+                            }
+                            for (std::size_t clip = 0; clip < batch->configs.size(); ++clip) {
+                                if (batch->parsed[clip]) {
+                                    CreateClip(batch->configs[clip]);
+                                }
+                            }
+                        };
+                    }, priority);
                 }
-            }
-
-        } catch (const std::exception&) {
-        }
+            };
+        }, priority);
     }
 
     void AnimationModule::UnloadAll() {
@@ -243,12 +305,74 @@ namespace Animation {
         return (it != m_clipNameToId.end()) ? it->second : INVALID_CLIP_ID;
     }
 
-    float AnimationModule::CalculateClipDuration(const AnimationClipConfig& config) const {
-        float duration = 0.0f;
-        for (const auto& frame : config.frames) {
-            duration += frame.duration;
+    const AnimationModule::CompiledClip* AnimationModule::FindClip(AnimationClipId clipId) const {
+        auto it = m_clips.find(clipId);
+        return (it != m_clips.end()) ? &it->second : nullptr;
+    }
+
+    void AnimationModule::AppendGridFrames(const GridLayout& layout, AnimationClipConfig& config) {
+        std::uint32_t totalFrames = layout.columns * layout.rows;
+        std::uint32_t frameCount = (layout.frameCount > 0) ?
+            std::min(layout.frameCount, totalFrames - layout.startFrame) :
+            totalFrames - layout.startFrame;
+
+        config.frames.reserve(config.frames.size() + frameCount);
+
+        for (std::uint32_t i = 0; i < frameCount; ++i) {
+            std::uint32_t frameIndex = layout.startFrame + i;
+            std::uint32_t col = frameIndex % layout.columns;
+            std::uint32_t row = frameIndex / layout.columns;
+
+            FrameDef frame;
+            frame.region.position.x = static_cast<float>(col) * layout.frameWidth;
+            frame.region.position.y = static_cast<float>(row) * layout.frameHeight;
+            frame.region.size.x = layout.frameWidth;
+            frame.region.size.y = layout.frameHeight;
+            frame.duration = layout.defaultDuration;
+
+            config.frames.push_back(frame);
+        }
+    }
+
+    void AnimationModule::CompileClip(CompiledClip& clip) {
+        const auto& frames = clip.config.frames;
+
+        clip.frameEnds.clear();
+        clip.frameEnds.reserve(frames.size());
+        float accumulated = 0.0f;
+        bool uniform = true;
+        for (const auto& frame : frames) {
+            accumulated += frame.duration;
+            clip.frameEnds.push_back(accumulated);
+            uniform = uniform && frame.duration == frames.front().duration;
+        }
+
+        clip.duration = accumulated;
+        clip.uniformFrameDuration = (uniform && !frames.empty()) ? frames.front().duration : 0.0f;
+    }
+
+    float AnimationModule::NormalizeTime(const CompiledClip& clip, float time, bool looping) {
+        if (!looping) {
+            return std::clamp(time, 0.0f, clip.duration);
         }
-        return duration;
+
+        float normalizedTime = std::fmod(time, clip.duration);
+        if (normalizedTime < 0.0f) {
+            normalizedTime += clip.duration;
+        }
+        return normalizedTime;
+    }
+
+    std::size_t AnimationModule::FrameIndexAt(const CompiledClip& clip, float normalizedTime) {
+        const std::size_t lastFrame = clip.frameEnds.size() - 1;
+
+        if (clip.uniformFrameDuration > 0.0f) {
+            float index = normalizedTime / clip.uniformFrameDuration;
+            return (index >= static_cast<float>(lastFrame)) ? lastFrame : static_cast<std::size_t>(index);
+        }
+
+        auto it = std::upper_bound(clip.frameEnds.begin(), clip.frameEnds.end(), normalizedTime);
+        return std::min(static_cast<std::size_t>(it - clip.frameEnds.begin()), lastFrame);
     }
 
 }
@@ -39,6 +39,34 @@ namespace Audio {
         m_soundBuffers.erase(soundId);
     }
 
+    bool SFMLAudio::DecodeSound(const std::string& path, SoundSamples& samples) const {
+        sf::InputSoundFile file;
+        if (!file.openFromFile(path)) {
+            return false;
+        }
+
+        samples.channelCount = file.getChannelCount();
+        samples.sampleRate = file.getSampleRate();
+        samples.samples.resize(static_cast<std::size_t>(file.getSampleCount()));
+        sf::Uint64 read = file.read(samples.samples.data(), samples.samples.size());
+        samples.samples.resize(static_cast<std::size_t>(read));
+        return true;
+    }
+
+    Audio::SoundId SFMLAudio::CreateSoundFromSamples(const SoundSamples& samples) {
+        sf::SoundBuffer buffer;
+        if (samples.samples.empty() ||
+            !buffer.loadFromSamples(samples.samples.data(), samples.samples.size(),
+                                    samples.channelCount, samples.sampleRate)) {
+            RType::Core::Logger::Warning("[SFMLAudio] Failed to create sound from decoded samples");
+            return INVALID_SOUND_ID;
+        }
+
+        SoundId id = m_nextSoundId++;
+        m_soundBuffers.emplace(id, std::move(buffer));
+        return id;
+    }
+
     Audio::MusicId SFMLAudio::LoadMusic(const std::string& path) {
         auto music = std::make_unique<sf::Music>();
         if (!music->openFromFile(path)) {
@@ -0,0 +1,139 @@
+#include "Core/AssetLoader.hpp"
+#include "Core/Logger.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace RType {
+    namespace Core {
+
+        AssetLoader::AssetLoader(std::size_t threadCount) {
+            if (threadCount == 0) {
+                unsigned int hardware = std::thread::hardware_concurrency();
+                threadCount = hardware > 1 ? hardware - 1 : 1;
+            }
+
+            m_workers.reserve(threadCount);
+            for (std::size_t i = 0; i < threadCount; ++i) {
+                m_workers.emplace_back(&AssetLoader::WorkerLoop, this);
+            }
+        }
+
+        AssetLoader::~AssetLoader() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_jobAvailable.notify_all();
+
+            for (auto& worker : m_workers) {
+                if (worker.joinable()) {
+                    worker.join();
+                }
+            }
+        }
+
+        void AssetLoader::Enqueue(Job job, AssetPriority priority) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_jobs.push_back(QueuedJob{priority, m_nextSequence++, std::move(job)});
+                std::push_heap(m_jobs.begin(), m_jobs.end());
+                m_progress.submitted++;
+            }
+            m_jobAvailable.notify_one();
+        }
+
+        std::size_t AssetLoader::Poll(std::size_t maxCompletions) {
+            std::size_t ran = 0;
+
+            while (maxCompletions == 0 || ran < maxCompletions) {
+                Completion completion;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (m_completions.empty()) {
+                        break;
+                    }
+                    completion = std::move(m_completions.front());
+                    m_completions.pop_front();
+                }
+
+                // Run outside the lock: completions upload to the GPU and may enqueue more work
+                if (completion) {
+                    try {
+                        completion();
+                    } catch (const std::exception& e) {
+                        Logger::Error("[AssetLoader] Completion failed: {}", e.what());
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_progress.completed++;
+                ran++;
+            }
+
+            return ran;
+        }
+
+        void AssetLoader::WaitIdle() {
+            while (true) {
+                Poll();
+
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_jobs.empty() && m_running == 0 && m_completions.empty()) {
+                    return;
+                }
+                m_completionAvailable.wait(lock, [this] {
+                    return !m_completions.empty() || (m_jobs.empty() && m_running == 0);
+                });
+            }
+        }
+
+        AssetLoader::Progress AssetLoader::GetProgress() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_progress;
+        }
+
+        void AssetLoader::ResetProgress() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::uint32_t outstanding = m_progress.submitted - m_progress.completed;
+            m_progress.submitted = outstanding;
+            m_progress.completed = 0;
+        }
+
+        bool AssetLoader::IsIdle() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_jobs.empty() && m_running == 0 && m_completions.empty();
+        }
+
+        void AssetLoader::WorkerLoop() {
+            while (true) {
+                Job job;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_jobAvailable.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+                    if (m_stopping) {
+                        return;
+                    }
+                    std::pop_heap(m_jobs.begin(), m_jobs.end());
+                    job = std::move(m_jobs.back().job);
+                    m_jobs.pop_back();
+                    m_running++;
+                }
+
+                Completion completion;
+                try {
+                    completion = job();
+                } catch (const std::exception& e) {
+                    Logger::Error("[AssetLoader] Job failed: {}", e.what());
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_completions.push_back(std::move(completion));
+                    m_running--;
+                }
+                m_completionAvailable.notify_all();
+            }
+        }
+
+    }
+}
@@ -28,6 +28,9 @@ namespace ECS {
     void AnimationSystem::UpdateSpriteAnimations(Registry& registry, float deltaTime) {
         auto entities = registry.GetEntitiesWithComponent<SpriteAnimation>();
 
+        m_animatedEntities.clear();
+        m_cursors.clear();
+
         for (Entity entity : entities) {
             if (!registry.IsEntityAlive(entity)) {
                 continue;
@@ -38,51 +41,55 @@ namespace ECS {
                 continue;
             }
 
-            float clipDuration = m_animation->GetClipDuration(anim.clipId);
-            if (clipDuration <= 0.0f) {
-                continue;
-            }
-
             bool regionUninitialized = (anim.currentRegion.size.x <= 0.0f || anim.currentRegion.size.y <= 0.0f);
-            if (regionUninitialized && anim.currentTime == 0.0f) {
-                auto firstFrame = m_animation->GetFrameAtTime(anim.clipId, 0.0f, anim.looping);
-                std::size_t firstFrameIndex = m_animation->GetFrameIndexAtTime(anim.clipId, 0.0f, anim.looping);
-                anim.currentFrameIndex = firstFrameIndex;
-                anim.currentRegion = firstFrame.region;
+            if (regionUninitialized && anim.currentTime == 0.0f && m_animation->GetClipDuration(anim.clipId) > 0.0f) {
+                anim.currentFrameIndex = m_animation->GetFrameIndexAtTime(anim.clipId, 0.0f, anim.looping);
+                anim.currentRegion = m_animation->GetFrameAtTime(anim.clipId, 0.0f, anim.looping).region;
                 if (registry.HasComponent<AnimatedSprite>(entity)) {
                     registry.GetComponent<AnimatedSprite>(entity).needsUpdate = true;
                 }
             }
 
-            anim.currentTime += deltaTime * anim.playbackSpeed;
-            if (anim.currentTime >= clipDuration) {
-                if (anim.looping) {
-                    anim.currentTime = std::fmod(anim.currentTime, clipDuration);
-                } else {
-                    anim.currentTime = clipDuration;
-                    anim.playing = false;
+            Animation::ClipCursor cursor;
+            cursor.clipId = anim.clipId;
+            cursor.time = anim.currentTime;
+            cursor.playbackSpeed = anim.playbackSpeed;
+            cursor.looping = anim.looping;
+            m_animatedEntities.push_back(entity);
+            m_cursors.push_back(cursor);
+        }
+
+        m_animation->AdvanceClips(m_cursors.data(), m_cursors.size(), deltaTime);
 
-                    if (anim.destroyOnComplete) {
-                        m_entitiesToDestroy.push_back(entity);
-                        continue;
-                    }
+        for (std::size_t i = 0; i < m_cursors.size(); ++i) {
+            const auto& cursor = m_cursors[i];
+            if (!cursor.frame) {
+                continue;
+            }
+
+            Entity entity = m_animatedEntities[i];
+            auto& anim = registry.GetComponent<SpriteAnimation>(entity);
+            anim.currentTime = cursor.time;
+
+            if (cursor.finished) {
+                anim.playing = false;
+                if (anim.destroyOnComplete) {
+                    m_entitiesToDestroy.push_back(entity);
+                    continue;
                 }
             }
 
-            auto frame = m_animation->GetFrameAtTime(anim.clipId, anim.currentTime, anim.looping);
-            std::size_t newFrameIndex = m_animation->GetFrameIndexAtTime(
-                anim.clipId, anim.currentTime, anim.looping);
-            
-            bool frameChanged = (newFrameIndex != anim.currentFrameIndex);
+            const auto& frame = *cursor.frame;
+            bool frameChanged = (cursor.frameIndex != anim.currentFrameIndex);
             if (frameChanged || frame.region.size.x > 0.0f) {
                 anim.currentRegion = frame.region;
-                anim.currentFrameIndex = newFrameIndex;
+                anim.currentFrameIndex = cursor.frameIndex;
 
                 if (!frame.eventName.empty() && registry.HasComponent<AnimationEvents>(entity)) {
                     auto& events = registry.GetComponent<AnimationEvents>(entity);
                     events.PushEvent(frame.eventName.c_str());
                 }
-                
+
                 if (registry.HasComponent<AnimatedSprite>(entity)) {
                     registry.GetComponent<AnimatedSprite>(entity).needsUpdate = true;
                 }
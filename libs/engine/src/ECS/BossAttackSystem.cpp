@@ -19,24 +19,16 @@ namespace RType {
     namespace ECS {
 
         void BossAttackSystem::Update(Registry& registry, float deltaTime) {
-            auto bosses = registry.GetEntitiesWithComponent<Boss>();
+            // Killed or still scrolling in: the boss holds fire
+            const Signature& idle = Registry::MakeSignature<BossKilled, Scrollable>();
+            auto bosses = registry.GetEntitiesWithComponents<Boss, BossAttack, Position>();
 
             for (auto bossEntity : bosses) {
                 if (!registry.IsEntityAlive(bossEntity)) {
                     continue;
                 }
 
-                if (registry.HasComponent<BossKilled>(bossEntity)) {
-                    continue;
-                }
-
-                if (registry.HasComponent<Scrollable>(bossEntity)) {
-                    continue;
-                }
-
-                if (!registry.HasComponent<BossAttack>(bossEntity) ||
-                    !registry.HasComponent<Position>(bossEntity) ||
-                    !registry.HasComponent<Boss>(bossEntity)) {
+                if ((registry.GetSignature(bossEntity) & idle).any()) {
                     continue;
                 }
 
@@ -175,7 +167,7 @@ namespace RType {
             
 
             float vx, vy;
-            int trajectory = rand() % 3;
+            int trajectory = m_rng->NextInt(0, 2);
             const float speed = 70.0f;
 
             switch(trajectory) {
@@ -364,11 +356,11 @@ namespace RType {
         void BossAttackSystem::CreateMine(Registry& registry, Entity bossEntity, float bossX, float bossY) {
             const float minX = bossX + 200.0f;
             const float maxX = bossX + 600.0f;
-            float spawnX = minX + (static_cast<float>(rand()) / RAND_MAX) * (maxX - minX);
+            float spawnX = m_rng->NextFloat(minX, maxX);
 
             const float minY = 100.0f;
             const float maxY = 650.0f;
-            float spawnY = minY + (static_cast<float>(rand()) / RAND_MAX) * (maxY - minY);
+            float spawnY = m_rng->NextFloat(minY, maxY);
 
             Entity mine = registry.CreateEntity();
 
@@ -8,8 +8,6 @@
 #include "ECS/BulletCollisionResponseSystem.hpp"
 #include "ECS/EffectFactory.hpp"
 #include "Core/Logger.hpp"
-#include <unordered_map>
-#include <cstdint>
 
 namespace RType {
     namespace ECS {
@@ -17,18 +15,16 @@ namespace RType {
         void BulletCollisionResponseSystem::Update(Registry& registry, float deltaTime) {
             auto bullets = registry.GetEntitiesWithComponent<Bullet>();
             
-            static std::unordered_map<uint64_t, float> lastBeamDamageTime;
-            static float totalTime = 0.0f;
-            totalTime += deltaTime;
+            m_totalTime += deltaTime;
             
-            auto it = lastBeamDamageTime.begin();
-            while (it != lastBeamDamageTime.end()) {
+            auto it = m_lastBeamDamageTime.begin();
+            while (it != m_lastBeamDamageTime.end()) {
                 uint64_t key = it->first;
                 Entity bulletEntity = static_cast<Entity>(key & 0xFFFFFFFF);
                 Entity otherEntity = static_cast<Entity>((key >> 32) & 0xFFFFFFFF);
                 
                 if (!registry.IsEntityAlive(bulletEntity) || !registry.IsEntityAlive(otherEntity)) {
-                    it = lastBeamDamageTime.erase(it);
+                    it = m_lastBeamDamageTime.erase(it);
                 } else {
                     ++it;
                 }
@@ -77,16 +73,16 @@ namespace RType {
                 if (isBeam && (hitEnemy || hitBoss)) {
                     uint64_t damageKey = (static_cast<uint64_t>(other) << 32) | static_cast<uint64_t>(bullet);
                     
-                    auto damageIt = lastBeamDamageTime.find(damageKey);
-                    if (damageIt != lastBeamDamageTime.end()) {
-                        float timeSinceLastDamage = totalTime - damageIt->second;
+                    auto damageIt = m_lastBeamDamageTime.find(damageKey);
+                    if (damageIt != m_lastBeamDamageTime.end()) {
+                        float timeSinceLastDamage = m_totalTime - damageIt->second;
                         if (timeSinceLastDamage < BEAM_DAMAGE_TICK_INTERVAL) {
                             shouldApplyDamage = false;
                         }
                     }
                     
                     if (shouldApplyDamage) {
-                        lastBeamDamageTime[damageKey] = totalTime;
+                        m_lastBeamDamageTime[damageKey] = m_totalTime;
                     }
                 }
 
@@ -114,7 +110,7 @@ namespace RType {
                                                            EnemyKilled(enemyComp.id, bulletComp.owner));
                         if (isBeam) {
                             uint64_t damageKey = (static_cast<uint64_t>(other) << 32) | static_cast<uint64_t>(bullet);
-                            lastBeamDamageTime.erase(damageKey);
+                            m_lastBeamDamageTime.erase(damageKey);
                         }
                     }
                 }
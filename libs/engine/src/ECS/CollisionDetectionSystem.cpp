@@ -17,13 +17,14 @@ namespace RType {
             ClearCollisionEvents(registry);
 
             auto entities = GetCollidableEntities(registry);
+            const auto& layers = registry.GetComponentPool<CollisionLayer>();
 
             for (size_t i = 0; i < entities.size(); ++i) {
                 for (size_t j = i + 1; j < entities.size(); ++j) {
                     Entity a = entities[i];
                     Entity b = entities[j];
 
-                    if (!ShouldCollide(registry, a, b)) {
+                    if (!ShouldCollide(layers, a, b)) {
                         continue;
                     }
 
@@ -48,12 +49,16 @@ namespace RType {
             std::vector<Entity> collidableEntities;
 
             auto allEntities = registry.GetEntitiesWithComponent<Position>();
+            const auto& circles = registry.GetComponentPool<CircleCollider>();
+            const auto& boxes = registry.GetComponentPool<BoxCollider>();
+            const auto& compounds = registry.GetComponentPool<CompoundCollider>();
 
             for (auto entity : allEntities) {
-                bool hasCircleCollider = registry.HasComponent<CircleCollider>(entity);
-                bool hasBoxCollider = registry.HasComponent<BoxCollider>(entity);
+                bool hasCircleCollider = circles.Has(entity);
+                bool hasBoxCollider = boxes.Has(entity);
+                bool hasCompoundCollider = compounds.Has(entity);
 
-                if (hasCircleCollider || hasBoxCollider) {
+                if (hasCircleCollider || hasBoxCollider || hasCompoundCollider) {
                     collidableEntities.push_back(entity);
                 }
             }
@@ -61,12 +66,12 @@ namespace RType {
             return collidableEntities;
         }
 
-        bool CollisionDetectionSystem::ShouldCollide(Registry& registry, Entity a, Entity b) {
-            if (!registry.HasComponent<CollisionLayer>(a) || !registry.HasComponent<CollisionLayer>(b)) {
+        bool CollisionDetectionSystem::ShouldCollide(const ComponentPool<CollisionLayer>& layers, Entity a, Entity b) {
+            if (!layers.Has(a) || !layers.Has(b)) {
                 return true;
             }
-            const auto& layerA = registry.GetComponent<CollisionLayer>(a);
-            const auto& layerB = registry.GetComponent<CollisionLayer>(b);
+            const auto& layerA = layers.Get(a);
+            const auto& layerB = layers.Get(b);
 
             bool aCanCollideWithB = (layerA.mask & layerB.layer) != 0;
             bool bCanCollideWithA = (layerB.mask & layerA.layer) != 0;
@@ -75,17 +80,35 @@ namespace RType {
         }
 
         bool CollisionDetectionSystem::CheckCollision(Registry& registry, Entity a, Entity b) {
-            if (!registry.HasComponent<Position>(a) || !registry.HasComponent<Position>(b)) {
+            // Shape dispatch reads each entity's signature once instead of
+            // probing a pool per collider type
+            const Signature& sigA = registry.GetSignature(a);
+            const Signature& sigB = registry.GetSignature(b);
+            const ComponentID position = GetComponentID<Position>();
+            if (!sigA.test(position) || !sigB.test(position)) {
                 return false;
             }
 
-            const auto& posA = registry.GetComponent<Position>(a);
-            const auto& posB = registry.GetComponent<Position>(b);
+            // Compound shapes: bound first, then the boxes one by one
+            const ComponentID compound = GetComponentID<CompoundCollider>();
+            if (sigA.test(compound)) {
+                CompoundCollider::Box box;
+                return GetContactBox(registry, a, b, box);
+            }
+            if (sigB.test(compound)) {
+                CompoundCollider::Box box;
+                return GetContactBox(registry, b, a, box);
+            }
+
+            const Position posA = GetWorldPosition(registry, a);
+            const Position posB = GetWorldPosition(registry, b);
 
-            bool aHasCircle = registry.HasComponent<CircleCollider>(a);
-            bool bHasCircle = registry.HasComponent<CircleCollider>(b);
-            bool aHasBox = registry.HasComponent<BoxCollider>(a);
-            bool bHasBox = registry.HasComponent<BoxCollider>(b);
+            const ComponentID circleId = GetComponentID<CircleCollider>();
+            const ComponentID boxId = GetComponentID<BoxCollider>();
+            bool aHasCircle = sigA.test(circleId);
+            bool bHasCircle = sigB.test(circleId);
+            bool aHasBox = sigA.test(boxId);
+            bool bHasBox = sigB.test(boxId);
 
             if (aHasCircle && bHasCircle) {
                 const auto& circleA = registry.GetComponent<CircleCollider>(a);
@@ -118,6 +141,77 @@ namespace RType {
             return false;
         }
 
+        Position CollisionDetectionSystem::GetWorldPosition(const Registry& registry, Entity entity) {
+            Position position = registry.GetComponent<Position>(entity);
+            if (registry.HasComponent<LevelSpace>(entity)) {
+                position.x += registry.GetScrollOffset();
+            }
+            return position;
+        }
+
+        bool CollisionDetectionSystem::GetContactBox(const Registry& registry, Entity entity, Entity other,
+                                                     CompoundCollider::Box& box) {
+            if (!registry.HasComponent<Position>(entity) || !registry.HasComponent<Position>(other)) {
+                return false;
+            }
+            const Position pos = GetWorldPosition(registry, entity);
+
+            if (registry.HasComponent<BoxCollider>(entity)) {
+                const auto& collider = registry.GetComponent<BoxCollider>(entity);
+                box = {pos.x, pos.y, collider.width, collider.height};
+                return OverlapsBox(registry, other, box);
+            }
+
+            if (!registry.HasComponent<CompoundCollider>(entity)) {
+                return false;
+            }
+            const auto& compound = registry.GetComponent<CompoundCollider>(entity);
+            const CompoundCollider::Box bound{pos.x + compound.bound.x, pos.y + compound.bound.y,
+                                              compound.bound.width, compound.bound.height};
+            if (!OverlapsBox(registry, other, bound)) {
+                return false;
+            }
+            for (const auto& local : compound.boxes) {
+                const CompoundCollider::Box world{pos.x + local.x, pos.y + local.y, local.width, local.height};
+                if (OverlapsBox(registry, other, world)) {
+                    box = world;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool CollisionDetectionSystem::OverlapsBox(const Registry& registry, Entity entity,
+                                                   const CompoundCollider::Box& box) {
+            const Position pos = GetWorldPosition(registry, entity);
+
+            if (registry.HasComponent<CircleCollider>(entity)) {
+                const auto& circle = registry.GetComponent<CircleCollider>(entity);
+                return CheckCircleAABB(pos.x, pos.y, circle.radius, box.x, box.y, box.width, box.height);
+            }
+
+            if (registry.HasComponent<BoxCollider>(entity)) {
+                const auto& collider = registry.GetComponent<BoxCollider>(entity);
+                return CheckAABB(pos.x, pos.y, collider.width, collider.height, box.x, box.y, box.width, box.height);
+            }
+
+            if (registry.HasComponent<CompoundCollider>(entity)) {
+                const auto& compound = registry.GetComponent<CompoundCollider>(entity);
+                if (!CheckAABB(pos.x + compound.bound.x, pos.y + compound.bound.y, compound.bound.width,
+                               compound.bound.height, box.x, box.y, box.width, box.height)) {
+                    return false;
+                }
+                for (const auto& local : compound.boxes) {
+                    if (CheckAABB(pos.x + local.x, pos.y + local.y, local.width, local.height,
+                                  box.x, box.y, box.width, box.height)) {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
         bool CollisionDetectionSystem::CheckCircleCircle(float x1, float y1, float r1,
                                                          float x2, float y2, float r2) {
             float dx = x2 - x1;
@@ -3,7 +3,6 @@
 #include "ECS/Component.hpp"
 #include "Core/Logger.hpp"
 #include <algorithm>
-#include <random>
 #include <cmath>
 
 namespace RType {
@@ -18,8 +17,7 @@ namespace RType {
         constexpr float ENEMY_SPAWN_MIN_Y = 50.0f;
 
         EnemySystem::EnemySystem(Renderer::IRenderer* renderer, float screenWidth, float screenHeight)
-            : m_renderer(renderer), m_screenWidth(screenWidth), m_screenHeight(screenHeight),
-              m_rng(std::random_device{}()) {}
+            : m_renderer(renderer), m_screenWidth(screenWidth), m_screenHeight(screenHeight) {}
 
         void EnemySystem::Update(Registry& registry, float deltaTime) {
             m_spawnTimer += deltaTime;
@@ -43,13 +41,10 @@ namespace RType {
         }
 
         void EnemySystem::SpawnRandomEnemy(Registry& registry) {
-            std::uniform_real_distribution<float> yDist(ENEMY_SPAWN_MIN_Y, m_screenHeight - ENEMY_SPAWN_MARGIN_Y);
-            std::uniform_int_distribution<int> typeDist(0, 2);
-
             float spawnX = m_screenWidth + ENEMY_SPAWN_OFFSET_X;
-            float spawnY = yDist(m_rng);
+            float spawnY = m_rng->NextFloat(ENEMY_SPAWN_MIN_Y, m_screenHeight - ENEMY_SPAWN_MARGIN_Y);
 
-            EnemyType type = static_cast<EnemyType>(typeDist(m_rng));
+            EnemyType type = static_cast<EnemyType>(m_rng->NextInt(0, 2));
 
             EnemyFactory::CreateEnemy(registry, type, spawnX, spawnY, m_renderer);
         }
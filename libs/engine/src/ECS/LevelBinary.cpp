@@ -0,0 +1,376 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LevelBinary - Precompiled flat level format
+*/
+
+#include "ECS/LevelBinary.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <type_traits>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RType {
+
+    namespace ECS {
+
+        namespace LevelBinary {
+
+            static_assert(std::is_trivially_copyable_v<FileHeader>, "FileHeader is copied as raw bytes");
+            static_assert(sizeof(float) == 4 && sizeof(StringRef) == 8, "Unexpected record layout");
+
+            namespace {
+
+                // Read-only view of a whole file, unmapped on destruction
+                class MappedFile {
+                public:
+                    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+                        m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                             FILE_ATTRIBUTE_NORMAL, nullptr);
+                        if (m_file == INVALID_HANDLE_VALUE) {
+                            return;
+                        }
+                        LARGE_INTEGER size;
+                        if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0) {
+                            return;
+                        }
+                        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                        if (!m_mapping) {
+                            return;
+                        }
+                        m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+                        m_size = m_data ? static_cast<std::size_t>(size.QuadPart) : 0;
+#else
+                        int fd = open(path.c_str(), O_RDONLY);
+                        if (fd < 0) {
+                            return;
+                        }
+                        struct stat info {};
+                        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+                            void* mapped = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                            if (mapped != MAP_FAILED) {
+                                m_data = static_cast<const uint8_t*>(mapped);
+                                m_size = static_cast<std::size_t>(info.st_size);
+                            }
+                        }
+                        close(fd);
+#endif
+                    }
+
+                    ~MappedFile() {
+#ifdef _WIN32
+                        if (m_data) {
+                            UnmapViewOfFile(m_data);
+                        }
+                        if (m_mapping) {
+                            CloseHandle(m_mapping);
+                        }
+                        if (m_file != INVALID_HANDLE_VALUE) {
+                            CloseHandle(m_file);
+                        }
+#else
+                        if (m_data) {
+                            munmap(const_cast<uint8_t*>(m_data), m_size);
+                        }
+#endif
+                    }
+
+                    MappedFile(const MappedFile&) = delete;
+                    MappedFile& operator=(const MappedFile&) = delete;
+
+                    const uint8_t* Data() const { return m_data; }
+                    std::size_t Size() const { return m_size; }
+
+                private:
+                    const uint8_t* m_data = nullptr;
+                    std::size_t m_size = 0;
+#ifdef _WIN32
+                    HANDLE m_file = INVALID_HANDLE_VALUE;
+                    HANDLE m_mapping = nullptr;
+#endif
+                };
+
+                // Each distinct string is stored once; obstacle textures repeat a lot
+                class StringTable {
+                public:
+                    StringRef Add(const std::string& value) {
+                        auto it = m_refs.find(value);
+                        if (it != m_refs.end()) {
+                            return it->second;
+                        }
+                        StringRef ref{static_cast<uint32_t>(m_bytes.size()), static_cast<uint32_t>(value.size())};
+                        m_bytes.insert(m_bytes.end(), value.begin(), value.end());
+                        m_refs.emplace(value, ref);
+                        return ref;
+                    }
+                    const std::vector<char>& Bytes() const { return m_bytes; }
+
+                private:
+                    std::vector<char> m_bytes;
+                    std::unordered_map<std::string, StringRef> m_refs;
+                };
+
+                template <typename T>
+                Section Append(std::vector<uint8_t>& image, const std::vector<T>& records) {
+                    Section section{static_cast<uint32_t>(image.size()), static_cast<uint32_t>(records.size())};
+                    const auto* bytes = reinterpret_cast<const uint8_t*>(records.data());
+                    image.insert(image.end(), bytes, bytes + records.size() * sizeof(T));
+                    // Keep every section 4-byte aligned for in-place reads
+                    image.resize((image.size() + 3) & ~static_cast<std::size_t>(3), 0);
+                    return section;
+                }
+
+                // Bounds-checked accessors over the mapped image
+                class Reader {
+                public:
+                    Reader(const uint8_t* data, std::size_t size, const FileHeader& header)
+                        : m_data(data), m_size(size), m_header(header) {}
+
+                    template <typename T>
+                    const T* Records(const Section& section) const {
+                        const std::size_t bytes = static_cast<std::size_t>(section.count) * sizeof(T);
+                        if (section.offset > m_size || bytes > m_size - section.offset ||
+                            section.offset % alignof(T) != 0) {
+                            return nullptr;
+                        }
+                        return reinterpret_cast<const T*>(m_data + section.offset);
+                    }
+
+                    bool String(const StringRef& ref, std::string& out) const {
+                        const Section& strings = m_header.strings;
+                        if (ref.offset > strings.count || ref.length > strings.count - ref.offset) {
+                            return false;
+                        }
+                        out.assign(reinterpret_cast<const char*>(m_data + strings.offset + ref.offset), ref.length);
+                        return true;
+                    }
+
+                private:
+                    const uint8_t* m_data;
+                    std::size_t m_size;
+                    const FileHeader& m_header;
+                };
+
+            }
+
+            std::vector<uint8_t> Compile(const LevelData& level) {
+                FileHeader header;
+                StringTable strings;
+
+                header.name = strings.Add(level.name);
+                header.background.texture = strings.Add(level.background.texture);
+                header.background.scrollSpeed = level.background.scrollSpeed;
+                header.background.copies = level.background.copies;
+                header.background.layer = level.background.layer;
+
+                if (level.boss.has_value()) {
+                    const BossDef& boss = *level.boss;
+                    header.hasBoss = 1;
+                    header.boss.texture = strings.Add(boss.texture);
+                    header.boss.x = boss.x;
+                    header.boss.y = boss.y;
+                    header.boss.width = boss.width;
+                    header.boss.height = boss.height;
+                    header.boss.health = boss.health;
+                    header.boss.scrollSpeed = boss.scrollSpeed;
+                    header.boss.attackPattern = boss.attackPattern;
+                    header.boss.bossId = boss.bossId;
+                }
+
+                std::vector<TextureRecord> textures;
+                for (const auto& [key, path] : level.textures) {
+                    textures.push_back({strings.Add(key), strings.Add(path)});
+                }
+
+                std::vector<FontRecord> fonts;
+                for (const auto& [key, font] : level.fonts) {
+                    fonts.push_back({strings.Add(key), strings.Add(font.path), font.size});
+                }
+
+                std::vector<ObstacleRecord> obstacles;
+                std::vector<ColliderRecord> colliders;
+                for (const auto& obs : level.obstacles) {
+                    ObstacleRecord record;
+                    record.texture = strings.Add(obs.texture);
+                    record.x = obs.x;
+                    record.y = obs.y;
+                    record.scaleWidth = obs.scaleWidth;
+                    record.scaleHeight = obs.scaleHeight;
+                    record.scrollSpeed = obs.scrollSpeed;
+                    record.layer = obs.layer;
+                    record.firstCollider = static_cast<uint32_t>(colliders.size());
+                    record.colliderCount = static_cast<uint32_t>(obs.colliders.size());
+                    for (const auto& col : obs.colliders) {
+                        colliders.push_back({col.x, col.y, col.width, col.height});
+                    }
+                    obstacles.push_back(record);
+                }
+
+                std::vector<EnemyRecord> enemies;
+                for (const auto& en : level.enemies) {
+                    enemies.push_back({strings.Add(en.type), en.x, en.y});
+                }
+
+                std::vector<SpawnRecord> spawns;
+                for (const auto& spawn : level.playerSpawns) {
+                    spawns.push_back({spawn.x, spawn.y});
+                }
+
+                std::vector<uint8_t> image(sizeof(FileHeader), 0);
+                header.textures = Append(image, textures);
+                header.fonts = Append(image, fonts);
+                header.obstacles = Append(image, obstacles);
+                header.colliders = Append(image, colliders);
+                header.enemies = Append(image, enemies);
+                header.playerSpawns = Append(image, spawns);
+                header.strings = {static_cast<uint32_t>(image.size()), static_cast<uint32_t>(strings.Bytes().size())};
+                image.insert(image.end(), strings.Bytes().begin(), strings.Bytes().end());
+                header.fileSize = static_cast<uint32_t>(image.size());
+
+                std::memcpy(image.data(), &header, sizeof(FileHeader));
+                return image;
+            }
+
+            bool Decode(const uint8_t* data, std::size_t size, LevelData& level) {
+                if (!data || size < sizeof(FileHeader)) {
+                    return false;
+                }
+
+                FileHeader header;
+                std::memcpy(&header, data, sizeof(FileHeader));
+                if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+                    header.fileSize != size || header.strings.offset > size ||
+                    header.strings.count > size - header.strings.offset) {
+                    return false;
+                }
+
+                Reader reader(data, size, header);
+                const auto* textures = reader.Records<TextureRecord>(header.textures);
+                const auto* fonts = reader.Records<FontRecord>(header.fonts);
+                const auto* obstacles = reader.Records<ObstacleRecord>(header.obstacles);
+                const auto* colliders = reader.Records<ColliderRecord>(header.colliders);
+                const auto* enemies = reader.Records<EnemyRecord>(header.enemies);
+                const auto* spawns = reader.Records<SpawnRecord>(header.playerSpawns);
+                if ((!textures && header.textures.count) || (!fonts && header.fonts.count) ||
+                    (!obstacles && header.obstacles.count) || (!colliders && header.colliders.count) ||
+                    (!enemies && header.enemies.count) || (!spawns && header.playerSpawns.count)) {
+                    return false;
+                }
+
+                LevelData result;
+                bool ok = reader.String(header.name, result.name) &&
+                          reader.String(header.background.texture, result.background.texture);
+                result.background.scrollSpeed = header.background.scrollSpeed;
+                result.background.copies = header.background.copies;
+                result.background.layer = header.background.layer;
+
+                for (uint32_t i = 0; ok && i < header.textures.count; i++) {
+                    std::string key;
+                    ok = reader.String(textures[i].key, key) && reader.String(textures[i].path, result.textures[key]);
+                }
+
+                for (uint32_t i = 0; ok && i < header.fonts.count; i++) {
+                    std::string key;
+                    FontDef font;
+                    font.size = fonts[i].size;
+                    ok = reader.String(fonts[i].key, key) && reader.String(fonts[i].path, font.path);
+                    result.fonts[key] = font;
+                }
+
+                result.obstacles.resize(header.obstacles.count);
+                for (uint32_t i = 0; ok && i < header.obstacles.count; i++) {
+                    const ObstacleRecord& record = obstacles[i];
+                    ObstacleDef& obs = result.obstacles[i];
+                    ok = reader.String(record.texture, obs.texture) && record.firstCollider <= header.colliders.count &&
+                         record.colliderCount <= header.colliders.count - record.firstCollider;
+                    if (!ok) {
+                        break;
+                    }
+                    obs.x = record.x;
+                    obs.y = record.y;
+                    obs.scaleWidth = record.scaleWidth;
+                    obs.scaleHeight = record.scaleHeight;
+                    obs.scrollSpeed = record.scrollSpeed;
+                    obs.layer = record.layer;
+                    const ColliderRecord* first = colliders + record.firstCollider;
+                    obs.colliders.resize(record.colliderCount);
+                    for (uint32_t c = 0; c < record.colliderCount; c++) {
+                        obs.colliders[c] = {first[c].x, first[c].y, first[c].width, first[c].height};
+                    }
+                }
+
+                result.enemies.resize(header.enemies.count);
+                for (uint32_t i = 0; ok && i < header.enemies.count; i++) {
+                    ok = reader.String(enemies[i].type, result.enemies[i].type);
+                    result.enemies[i].x = enemies[i].x;
+                    result.enemies[i].y = enemies[i].y;
+                }
+
+                result.playerSpawns.resize(header.playerSpawns.count);
+                for (uint32_t i = 0; i < header.playerSpawns.count; i++) {
+                    result.playerSpawns[i] = {spawns[i].x, spawns[i].y};
+                }
+
+                if (ok && header.hasBoss) {
+                    BossDef boss;
+                    ok = reader.String(header.boss.texture, boss.texture);
+                    boss.x = header.boss.x;
+                    boss.y = header.boss.y;
+                    boss.width = header.boss.width;
+                    boss.height = header.boss.height;
+                    boss.health = header.boss.health;
+                    boss.scrollSpeed = header.boss.scrollSpeed;
+                    boss.attackPattern = header.boss.attackPattern;
+                    boss.bossId = static_cast<uint8_t>(header.boss.bossId);
+                    result.boss = boss;
+                }
+
+                if (!ok) {
+                    return false;
+                }
+                level = std::move(result);
+                return true;
+            }
+
+            bool LoadFile(const std::string& path, LevelData& level) {
+                MappedFile file(path);
+                return Decode(file.Data(), file.Size(), level);
+            }
+
+            bool SaveFile(const LevelData& level, const std::string& path) {
+                std::vector<uint8_t> image = Compile(level);
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                if (!file.is_open()) {
+                    return false;
+                }
+                file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+                return file.good();
+            }
+
+            std::string CompiledPath(const std::string& jsonPath) {
+                return std::filesystem::path(jsonPath).replace_extension(EXTENSION).string();
+            }
+
+        }
+
+    }
+
+}
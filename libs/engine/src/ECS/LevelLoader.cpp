@@ -6,9 +6,12 @@
 */
 
 #include "ECS/LevelLoader.hpp"
+#include "ECS/LevelBinary.hpp"
 #include "ECS/EnemyFactory.hpp"
 #include "Core/Logger.hpp"
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <stdexcept>
 
@@ -19,6 +22,11 @@ namespace RType {
     namespace ECS {
 
         LevelData LevelLoader::LoadFromFile(const std::string& path) {
+            LevelData compiled;
+            if (LoadCompiled(path, compiled)) {
+                return compiled;
+            }
+
             std::string sourcePath = "../" + path;
             std::ifstream file(sourcePath);
 
@@ -34,6 +42,35 @@ namespace RType {
             return LoadFromString(content);
         }
 
+        bool LevelLoader::LoadCompiled(const std::string& path, LevelData& level) {
+            for (const std::string& candidate : {"../" + path, path}) {
+                const std::string compiledPath = LevelBinary::CompiledPath(candidate);
+                std::error_code error;
+                if (!std::filesystem::exists(compiledPath, error)) {
+                    continue;
+                }
+
+                // A JSON edited after compilation wins over the stale binary
+                auto compiledTime = std::filesystem::last_write_time(compiledPath, error);
+                auto sourceTime = std::filesystem::last_write_time(candidate, error);
+                if (!error && sourceTime > compiledTime) {
+                    Core::Logger::Warning("Compiled level '{}' is older than its source, using JSON", compiledPath);
+                    return false;
+                }
+
+                if (LevelBinary::LoadFile(compiledPath, level)) {
+                    Core::Logger::Info("Loaded compiled level '{}' with {} obstacles, {} enemies",
+                                       level.name.empty() ? "unnamed" : level.name,
+                                       level.obstacles.size(),
+                                       level.enemies.size());
+                    return true;
+                }
+                Core::Logger::Warning("Invalid compiled level '{}', using JSON", compiledPath);
+                return false;
+            }
+            return false;
+        }
+
         LevelData LevelLoader::LoadFromString(const std::string& jsonString) {
             LevelData level;
 
@@ -134,6 +171,12 @@ namespace RType {
                     }
                 }
 
+                // Sorted by x so the streamer timeline is near-sorted and obstacle ids
+                // are the same whether a level comes from JSON or its compiled form
+                auto byX = [](const auto& a, const auto& b) { return a.x < b.x; };
+                std::stable_sort(level.obstacles.begin(), level.obstacles.end(), byX);
+                std::stable_sort(level.enemies.begin(), level.enemies.end(), byX);
+
                 if (level.playerSpawns.empty()) {
                     level.playerSpawns.push_back({100.0f, 200.0f});
                     level.playerSpawns.push_back({100.0f, 360.0f});
@@ -203,6 +246,56 @@ namespace RType {
                 }
             }
 
+            LoadFonts(level, renderer, assets);
+
+            return assets;
+        }
+
+        bool LevelLoader::DecodeTexture(
+            const Renderer::IRenderer* renderer,
+            const std::string& path,
+            DecodedTexture& decoded) {
+            if (!renderer) {
+                return false;
+            }
+
+            decoded.path = "../" + path;
+            if (renderer->DecodeImage(decoded.path, decoded.image)) {
+                return true;
+            }
+            decoded.path = path;
+            return renderer->DecodeImage(decoded.path, decoded.image);
+        }
+
+        bool LevelLoader::UploadTexture(
+            const std::string& key,
+            const DecodedTexture& decoded,
+            Renderer::IRenderer* renderer,
+            LoadedAssets& assets) {
+            if (!renderer) {
+                return false;
+            }
+
+            Renderer::TextureId texId = renderer->CreateTextureFromImage(decoded.path, decoded.image);
+            if (texId == Renderer::INVALID_TEXTURE_ID) {
+                Core::Logger::Warning("Failed to upload texture '{}' from '{}'", key, decoded.path);
+                return false;
+            }
+
+            assets.textures[key] = texId;
+            assets.sprites[key] = renderer->CreateSprite(texId, {});
+            Core::Logger::Debug("Loaded texture '{}' from '{}'", key, decoded.path);
+            return true;
+        }
+
+        void LevelLoader::LoadFonts(
+            const LevelData& level,
+            Renderer::IRenderer* renderer,
+            LoadedAssets& assets) {
+            if (!renderer) {
+                return;
+            }
+
             for (const auto& [key, fontDef] : level.fonts) {
                 Renderer::FontId fontId = renderer->LoadFont("../" + fontDef.path, fontDef.size);
                 if (fontId == Renderer::INVALID_FONT_ID) {
@@ -216,8 +309,6 @@ namespace RType {
                     Core::Logger::Warning("Failed to load font '{}' from '{}'", key, fontDef.path);
                 }
             }
-
-            return assets;
         }
 
         CreatedEntities LevelLoader::CreateEntities(
@@ -350,21 +441,31 @@ namespace RType {
                     Core::Logger::Warning("Obstacle texture '{}' not found in loaded assets", obs.texture);
                 }
 
-                for (const auto& col : obs.colliders) {
-                    Entity colliderEntity = registry.CreateEntity();
-                    // Store collider position as offset from visual entity (not absolute)
-                    registry.AddComponent<Position>(colliderEntity, Position{col.x - obs.x, col.y - obs.y});
-                    registry.AddComponent<BoxCollider>(colliderEntity, BoxCollider{col.width, col.height});
-                    registry.AddComponent<Scrollable>(colliderEntity, Scrollable(obs.scrollSpeed));
-                    registry.AddComponent<Obstacle>(colliderEntity, Obstacle(true));
-                    registry.AddComponent<ObstacleMetadata>(colliderEntity,
-                                                            ObstacleMetadata(obstacleIdCounter++, obsEntity, col.x - obs.x, col.y - obs.y));
-                    registry.AddComponent<CollisionLayer>(colliderEntity,
-                                                          CollisionLayer(CollisionLayers::OBSTACLE, CollisionLayers::ALL));
-
-                    entities.obstacleColliders.push_back(colliderEntity);
+                if (obs.colliders.empty()) {
+                    continue;
                 }
+
+                // One collider entity per obstacle, at the visual's position
+                Entity colliderEntity = registry.CreateEntity();
+                registry.AddComponent<Position>(colliderEntity, Position{obs.x, obs.y});
+                registry.AddComponent<CompoundCollider>(colliderEntity, MakeObstacleCollider(obs));
+                registry.AddComponent<Scrollable>(colliderEntity, Scrollable(obs.scrollSpeed));
+                registry.AddComponent<Obstacle>(colliderEntity, Obstacle(true));
+                registry.AddComponent<ObstacleMetadata>(colliderEntity, ObstacleMetadata(obstacleIdCounter++, obsEntity));
+                registry.AddComponent<CollisionLayer>(colliderEntity,
+                                                      CollisionLayer(CollisionLayers::OBSTACLE, CollisionLayers::ALL));
+
+                entities.obstacleColliders.push_back(colliderEntity);
+            }
+        }
+
+        CompoundCollider LevelLoader::MakeObstacleCollider(const ObstacleDef& obs) {
+            CompoundCollider compound;
+            compound.boxes.reserve(obs.colliders.size());
+            for (const auto& col : obs.colliders) {
+                compound.AddBox(col.x - obs.x, col.y - obs.y, col.width, col.height);
             }
+            return compound;
         }
 
         void LevelLoader::CreateEnemies(
@@ -386,27 +487,7 @@ namespace RType {
             CreatedEntities& entities,
             uint32_t& obstacleIdCounter) {
             for (const auto& obs : obstacles) {
-                Entity obsEntity = registry.CreateEntity();
-
-                registry.AddComponent<Position>(obsEntity, Position{obs.x, obs.y});
-                registry.AddComponent<Scrollable>(obsEntity, Scrollable(obs.scrollSpeed));
-                registry.AddComponent<ObstacleVisual>(obsEntity, ObstacleVisual{});
-                entities.obstacleVisuals.push_back(obsEntity);
-
-                for (const auto& col : obs.colliders) {
-                    Entity colliderEntity = registry.CreateEntity();
-                    // Store collider position as offset from visual entity (not absolute)
-                    registry.AddComponent<Position>(colliderEntity, Position{col.x - obs.x, col.y - obs.y});
-                    registry.AddComponent<BoxCollider>(colliderEntity, BoxCollider{col.width, col.height});
-                    registry.AddComponent<Scrollable>(colliderEntity, Scrollable(obs.scrollSpeed));
-                    registry.AddComponent<Obstacle>(colliderEntity, Obstacle(true));
-                    registry.AddComponent<ObstacleMetadata>(colliderEntity,
-                                                            ObstacleMetadata(obstacleIdCounter++, obsEntity, col.x - obs.x, col.y - obs.y));
-                    registry.AddComponent<CollisionLayer>(colliderEntity,
-                                                          CollisionLayer(CollisionLayers::OBSTACLE, CollisionLayers::ALL));
-
-                    entities.obstacleColliders.push_back(colliderEntity);
-                }
+                SpawnServerObstacle(registry, obs, 0.0f, obstacleIdCounter, entities);
             }
         }
 
@@ -415,9 +496,7 @@ namespace RType {
             const std::vector<EnemyDef>& enemies,
             CreatedEntities& entities) {
             for (const auto& en : enemies) {
-                EnemyType type = ParseEnemyType(en.type);
-                Entity enemy = EnemyFactory::CreateEnemy(registry, type, en.x, en.y, nullptr);
-                entities.enemies.push_back(enemy);
+                SpawnServerEnemy(registry, en, 0.0f, entities);
             }
         }
 
@@ -429,13 +508,71 @@ namespace RType {
                 return;
             }
 
-            const BossDef& boss = bossOpt.value();
+            SpawnServerBoss(registry, bossOpt.value(), 0.0f, entities);
+        }
+
+        Entity LevelLoader::SpawnServerObstacle(
+            Registry& registry,
+            const ObstacleDef& obs,
+            float shiftX,
+            uint32_t& obstacleIdCounter,
+            CreatedEntities& entities,
+            bool levelSpace) {
+            const float x = obs.x + shiftX;
+            Entity obsEntity = registry.CreateEntity();
 
+            auto addScrolling = [&registry, &obs, levelSpace](Entity entity) {
+                if (levelSpace) {
+                    registry.AddComponent<LevelSpace>(entity, LevelSpace{});
+                } else {
+                    registry.AddComponent<Scrollable>(entity, Scrollable(obs.scrollSpeed));
+                }
+            };
+
+            registry.AddComponent<Position>(obsEntity, Position{x, obs.y});
+            addScrolling(obsEntity);
+            registry.AddComponent<ObstacleVisual>(obsEntity, ObstacleVisual{});
+            entities.obstacleVisuals.push_back(obsEntity);
+
+            if (!obs.colliders.empty()) {
+                // A single compound collider following the visual, whatever the number of boxes
+                Entity colliderEntity = registry.CreateEntity();
+                registry.AddComponent<Position>(colliderEntity, Position{x, obs.y});
+                registry.AddComponent<CompoundCollider>(colliderEntity, MakeObstacleCollider(obs));
+                addScrolling(colliderEntity);
+                registry.AddComponent<Obstacle>(colliderEntity, Obstacle(true));
+                registry.AddComponent<ObstacleMetadata>(colliderEntity, ObstacleMetadata(obstacleIdCounter++, obsEntity));
+                registry.AddComponent<CollisionLayer>(colliderEntity,
+                                                      CollisionLayer(CollisionLayers::OBSTACLE, CollisionLayers::ALL));
+
+                entities.obstacleColliders.push_back(colliderEntity);
+            }
+
+            return obsEntity;
+        }
+
+        Entity LevelLoader::SpawnServerEnemy(
+            Registry& registry,
+            const EnemyDef& en,
+            float shiftX,
+            CreatedEntities& entities) {
+            EnemyType type = ParseEnemyType(en.type);
+            Entity enemy = EnemyFactory::CreateEnemy(registry, type, en.x + shiftX, en.y, nullptr);
+            entities.enemies.push_back(enemy);
+            return enemy;
+        }
+
+        Entity LevelLoader::SpawnServerBoss(
+            Registry& registry,
+            const BossDef& boss,
+            float shiftX,
+            CreatedEntities& entities) {
+            const float x = boss.x + shiftX;
             Entity bossEntity = registry.CreateEntity();
 
             registry.AddComponent<Boss>(bossEntity, Boss{boss.bossId});
 
-            registry.AddComponent<Position>(bossEntity, Position{boss.x, boss.y});
+            registry.AddComponent<Position>(bossEntity, Position{x, boss.y});
 
             registry.AddComponent<Velocity>(bossEntity, Velocity{0.0f, 0.0f});
 
@@ -470,7 +607,9 @@ namespace RType {
             entities.boss = bossEntity;
 
             Core::Logger::Info("Created boss entity at position ({}, {}) with {} health",
-                boss.x, boss.y, boss.health);
+                x, boss.y, boss.health);
+
+            return bossEntity;
         }
 
         std::string LevelLoader::SerializeToString(const LevelData& level) {
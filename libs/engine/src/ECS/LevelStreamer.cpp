@@ -0,0 +1,147 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LevelStreamer - Scroll-window activation of level content
+*/
+
+#include "ECS/LevelStreamer.hpp"
+#include "ECS/EnemyFactory.hpp"
+#include "Core/Logger.hpp"
+#include <algorithm>
+
+namespace RType {
+
+    namespace ECS {
+
+        LevelStreamer::LevelStreamer(float lookahead)
+            : m_lookahead(lookahead) {}
+
+        float LevelStreamer::ActivationTime(float x, float speed, float windowEdge) {
+            if (x <= windowEdge || speed >= 0.0f) {
+                return 0.0f;
+            }
+            return (x - windowEdge) / -speed;
+        }
+
+        void LevelStreamer::Start(Registry& registry, const LevelData& level) {
+            Prepare(level);
+            Begin(registry);
+        }
+
+        void LevelStreamer::Prepare(const LevelData& level) {
+            Clear();
+
+            m_levelName = level.name;
+            m_obstacles = level.obstacles;
+            m_enemies = level.enemies;
+            m_boss = level.boss;
+            m_scrollSpeed = level.background.scrollSpeed;
+
+            const float windowEdge = level.config.screenWidth + m_lookahead;
+            uint32_t obstacleIdCounter = 1;
+
+            for (std::size_t i = 0; i < m_obstacles.size(); i++) {
+                const ObstacleDef& obs = m_obstacles[i];
+                // An obstacle activates when its leftmost part reaches the window
+                float leadingX = obs.x;
+                for (const auto& col : obs.colliders) {
+                    leadingX = std::min(leadingX, col.x);
+                }
+
+                TimelineItem item;
+                item.activationTime = ActivationTime(leadingX, obs.scrollSpeed, windowEdge);
+                item.speed = obs.scrollSpeed;
+                item.levelSpace = obs.scrollSpeed == m_scrollSpeed;
+                item.kind = ItemKind::OBSTACLE;
+                item.index = i;
+                item.obstacleId = obstacleIdCounter;
+                if (!obs.colliders.empty()) {
+                    obstacleIdCounter++;
+                }
+                m_timeline.push_back(item);
+            }
+
+            for (std::size_t i = 0; i < m_enemies.size(); i++) {
+                const EnemyDef& en = m_enemies[i];
+                const float speed = -EnemyFactory::GetEnemySpeed(LevelLoader::ParseEnemyType(en.type));
+
+                TimelineItem item;
+                item.activationTime = ActivationTime(en.x, speed, windowEdge);
+                item.speed = speed;
+                item.kind = ItemKind::ENEMY;
+                item.index = i;
+                m_timeline.push_back(item);
+            }
+
+            if (m_boss.has_value()) {
+                TimelineItem item;
+                item.activationTime = ActivationTime(m_boss->x, m_boss->scrollSpeed, windowEdge);
+                item.speed = m_boss->scrollSpeed;
+                item.kind = ItemKind::BOSS;
+                m_timeline.push_back(item);
+            }
+
+            // Stable so that simultaneous items keep level order
+            std::stable_sort(m_timeline.begin(), m_timeline.end(),
+                             [](const TimelineItem& a, const TimelineItem& b) {
+                                 return a.activationTime < b.activationTime;
+                             });
+        }
+
+        void LevelStreamer::Begin(Registry& registry) {
+            m_elapsed = 0.0;
+            m_cursor = 0;
+            m_spawned = CreatedEntities{};
+            registry.SetScrollOffset(0.0f);
+            Activate(registry);
+
+            Core::Logger::Info("Streaming level '{}': {} timeline items, {} spawned at start",
+                               m_levelName, m_timeline.size(), m_cursor);
+        }
+
+        void LevelStreamer::Clear() {
+            m_levelName.clear();
+            m_elapsed = 0.0;
+            m_cursor = 0;
+            m_timeline.clear();
+            m_obstacles.clear();
+            m_enemies.clear();
+            m_boss.reset();
+            m_scrollSpeed = BackgroundDef{}.scrollSpeed;
+            m_spawned = CreatedEntities{};
+        }
+
+        void LevelStreamer::Update(Registry& registry, float deltaTime) {
+            m_elapsed += deltaTime;
+            registry.SetScrollOffset(GetScrollOffset());
+            Activate(registry);
+        }
+
+        void LevelStreamer::Activate(Registry& registry) {
+            while (m_cursor < m_timeline.size() && m_timeline[m_cursor].activationTime <= m_elapsed) {
+                const TimelineItem& item = m_timeline[m_cursor++];
+                // Where the element would be had it existed since the level started
+                const float shiftX = static_cast<float>(item.speed * m_elapsed);
+
+                switch (item.kind) {
+                case ItemKind::OBSTACLE: {
+                    // Level-space obstacles stay at their level x, the scroll offset moves them
+                    uint32_t obstacleId = item.obstacleId;
+                    LevelLoader::SpawnServerObstacle(registry, m_obstacles[item.index], item.levelSpace ? 0.0f : shiftX,
+                                                     obstacleId, m_spawned, item.levelSpace);
+                    break;
+                }
+                case ItemKind::ENEMY:
+                    LevelLoader::SpawnServerEnemy(registry, m_enemies[item.index], shiftX, m_spawned);
+                    break;
+                case ItemKind::BOSS:
+                    LevelLoader::SpawnServerBoss(registry, *m_boss, shiftX, m_spawned);
+                    break;
+                }
+            }
+        }
+
+    }
+
+}
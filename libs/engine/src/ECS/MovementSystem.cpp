@@ -8,14 +8,17 @@ namespace RType {
 
         void MovementSystem::Update(Registry& registry, float deltaTime) {
             auto entities = registry.GetEntitiesWithComponent<Velocity>();
+            auto& positions = registry.GetComponentPool<Position>();
+            const auto& velocities = registry.GetComponentPool<Velocity>();
+            const auto& obstacles = registry.GetComponentPool<Obstacle>();
 
             for (Entity entity : entities) {
-                if (!registry.HasComponent<Position>(entity)) {
+                if (!positions.Has(entity)) {
                     continue;
                 }
 
                 // CRITICAL FIX: Skip obstacles - they should NEVER move!
-                if (registry.HasComponent<Obstacle>(entity)) {
+                if (obstacles.Has(entity)) {
                     static int obstacleVelocityLog = 0;
                     if (obstacleVelocityLog < 10) {
                         std::cerr << "[MOVEMENT BUG] Obstacle entity " << entity
@@ -26,8 +29,8 @@ namespace RType {
                     continue;
                 }
 
-                auto& position = registry.GetComponent<Position>(entity);
-                const auto& velocity = registry.GetComponent<Velocity>(entity);
+                auto& position = positions.Get(entity);
+                const auto& velocity = velocities.Get(entity);
 
                 position.x += velocity.dx * deltaTime;
                 position.y += velocity.dy * deltaTime;
@@ -6,6 +6,7 @@
 */
 
 #include "ECS/ObstacleCollisionResponseSystem.hpp"
+#include "ECS/CollisionDetectionSystem.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -56,23 +57,23 @@ namespace RType {
 
                         bool resolved = false;
                         const bool hasEnemyBox = registry.HasComponent<BoxCollider>(other);
-                        const bool hasObstacleBox = registry.HasComponent<BoxCollider>(obstacle);
+                        CompoundCollider::Box obstacleBox;
+                        const bool hasObstacleBox =
+                            CollisionDetectionSystem::GetContactBox(registry, obstacle, other, obstacleBox);
 
                         if (hasEnemyBox && hasObstacleBox) {
                             auto& enemyPosRef = registry.GetComponent<Position>(other);
-                            const auto& obstaclePos = registry.GetComponent<Position>(obstacle);
                             const auto& enemyBox = registry.GetComponent<BoxCollider>(other);
-                            const auto& obstacleBox = registry.GetComponent<BoxCollider>(obstacle);
 
                             float enemyLeft = enemyPosRef.x;
                             float enemyRight = enemyPosRef.x + enemyBox.width;
                             float enemyTop = enemyPosRef.y;
                             float enemyBottom = enemyPosRef.y + enemyBox.height;
 
-                            float obstacleLeft = obstaclePos.x;
-                            float obstacleRight = obstaclePos.x + obstacleBox.width;
-                            float obstacleTop = obstaclePos.y;
-                            float obstacleBottom = obstaclePos.y + obstacleBox.height;
+                            float obstacleLeft = obstacleBox.x;
+                            float obstacleRight = obstacleBox.x + obstacleBox.width;
+                            float obstacleTop = obstacleBox.y;
+                            float obstacleBottom = obstacleBox.y + obstacleBox.height;
 
                             float penRight = obstacleRight - enemyLeft;
                             float penLeft = enemyRight - obstacleLeft;
@@ -117,7 +118,7 @@ namespace RType {
                             }
 
                             const auto& enemyPos = registry.GetComponent<Position>(other);
-                            const auto& obstaclePos = registry.GetComponent<Position>(obstacle);
+                            const Position obstaclePos = CollisionDetectionSystem::GetWorldPosition(registry, obstacle);
                             float dx = enemyPos.x - obstaclePos.x;
                             float dy = enemyPos.y - obstaclePos.y;
                             float distance = std::sqrt(dx * dx + dy * dy);
@@ -130,6 +131,9 @@ namespace RType {
                                 if (registry.HasComponent<BoxCollider>(obstacle)) {
                                     const auto& box = registry.GetComponent<BoxCollider>(obstacle);
                                     pushDistance = std::max(box.width, box.height) * 0.5f + 10.0f;
+                                } else if (registry.HasComponent<CompoundCollider>(obstacle)) {
+                                    const auto& bound = registry.GetComponent<CompoundCollider>(obstacle).bound;
+                                    pushDistance = std::max(bound.width, bound.height) * 0.5f + 10.0f;
                                 } else if (registry.HasComponent<CircleCollider>(obstacle)) {
                                     const auto& circle = registry.GetComponent<CircleCollider>(obstacle);
                                     pushDistance = circle.radius + 10.0f;
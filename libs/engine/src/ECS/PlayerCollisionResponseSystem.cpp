@@ -6,6 +6,7 @@
 */
 
 #include "ECS/PlayerCollisionResponseSystem.hpp"
+#include "ECS/CollisionDetectionSystem.hpp"
 #include <cmath>
 #include <algorithm>
 #include <iostream>
@@ -66,12 +67,11 @@ namespace RType {
                     if (obstacle.blocking) {
                         static int serverCollisionLog = 0;
                         if (serverCollisionLog < 5) {
-                            if (registry.HasComponent<Position>(other) && registry.HasComponent<BoxCollider>(other)) {
-                                const auto& obstPos = registry.GetComponent<Position>(other);
-                                const auto& obstBox = registry.GetComponent<BoxCollider>(other);
+                            CompoundCollider::Box obstBox;
+                            if (CollisionDetectionSystem::GetContactBox(registry, other, player, obstBox)) {
                                 std::cout << "[SERVER PLAYER-OBSTACLE COLLISION] Player entity=" << player
                                           << " vs Obstacle entity=" << other
-                                          << " at (" << obstPos.x << "," << obstPos.y << ")"
+                                          << " at (" << obstBox.x << "," << obstBox.y << ")"
                                           << " size=(" << obstBox.width << "," << obstBox.height << ")" << std::endl;
                                 serverCollisionLog++;
                             }
@@ -109,23 +109,24 @@ namespace RType {
 
                             bool resolved = false;
                             const bool hasPlayerBox = registry.HasComponent<BoxCollider>(player);
-                            const bool hasObstacleBox = registry.HasComponent<BoxCollider>(other);
+                            // The box actually touched, one of several for a compound obstacle
+                            CompoundCollider::Box obstacleBox;
+                            const bool hasObstacleBox =
+                                CollisionDetectionSystem::GetContactBox(registry, other, player, obstacleBox);
 
                             if (hasPlayerBox && hasObstacleBox) {
                                 auto& playerPosRef = registry.GetComponent<Position>(player);
-                                const auto& obstaclePos = registry.GetComponent<Position>(other);
                                 const auto& playerBox = registry.GetComponent<BoxCollider>(player);
-                                const auto& obstacleBox = registry.GetComponent<BoxCollider>(other);
 
                                 float playerLeft = playerPosRef.x;
                                 float playerRight = playerPosRef.x + playerBox.width;
                                 float playerTop = playerPosRef.y;
                                 float playerBottom = playerPosRef.y + playerBox.height;
 
-                                float obstacleLeft = obstaclePos.x;
-                                float obstacleRight = obstaclePos.x + obstacleBox.width;
-                                float obstacleTop = obstaclePos.y;
-                                float obstacleBottom = obstaclePos.y + obstacleBox.height;
+                                float obstacleLeft = obstacleBox.x;
+                                float obstacleRight = obstacleBox.x + obstacleBox.width;
+                                float obstacleTop = obstacleBox.y;
+                                float obstacleBottom = obstacleBox.y + obstacleBox.height;
 
                                 float penetrationRight = obstacleRight - playerLeft;
                                 float penetrationLeft = playerRight - obstacleLeft;
@@ -171,7 +172,7 @@ namespace RType {
                                 }
 
                                 const auto& playerPos = registry.GetComponent<Position>(player);
-                                const auto& obstaclePos = registry.GetComponent<Position>(other);
+                                const Position obstaclePos = CollisionDetectionSystem::GetWorldPosition(registry, other);
 
                                 float dx = playerPos.x - obstaclePos.x;
                                 float dy = playerPos.y - obstaclePos.y;
@@ -185,6 +186,9 @@ namespace RType {
                                     if (registry.HasComponent<BoxCollider>(other)) {
                                         const auto& box = registry.GetComponent<BoxCollider>(other);
                                         pushDistance = std::max(box.width, box.height) * 0.5f + 10.0f;
+                                    } else if (registry.HasComponent<CompoundCollider>(other)) {
+                                        const auto& bound = registry.GetComponent<CompoundCollider>(other).bound;
+                                        pushDistance = std::max(bound.width, bound.height) * 0.5f + 10.0f;
                                     } else if (registry.HasComponent<CircleCollider>(other)) {
                                         const auto& circle = registry.GetComponent<CircleCollider>(other);
                                         pushDistance = circle.radius + 10.0f;
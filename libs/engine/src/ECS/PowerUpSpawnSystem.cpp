@@ -10,7 +10,6 @@
 #include "ECS/EffectFactory.hpp"
 #include "ECS/Component.hpp"
 #include "Core/Logger.hpp"
-#include <chrono>
 
 namespace RType {
     namespace ECS {
@@ -22,8 +21,7 @@ namespace RType {
         )
             : m_renderer(renderer),
               m_screenWidth(screenWidth),
-              m_screenHeight(screenHeight),
-              m_rng(std::chrono::steady_clock::now().time_since_epoch().count())
+              m_screenHeight(screenHeight)
         {
         }
 
@@ -40,12 +38,10 @@ namespace RType {
 
         void PowerUpSpawnSystem::SpawnRandomPowerUp(Registry& registry) {
             // Random powerup type (0-5)
-            std::uniform_int_distribution<int> typeDist(0, 5);
-            PowerUpType type = static_cast<PowerUpType>(typeDist(m_rng));
+            PowerUpType type = static_cast<PowerUpType>(m_rng->NextInt(0, 5));
 
             // Random Y position (50 to screenHeight - 50)
-            std::uniform_real_distribution<float> yDist(50.0f, m_screenHeight - 50.0f);
-            float spawnY = yDist(m_rng);
+            float spawnY = m_rng->NextFloat(50.0f, m_screenHeight - 50.0f);
 
             float spawnX = m_screenWidth + 50.0f;
 
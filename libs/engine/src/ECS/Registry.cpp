@@ -1,4 +1,5 @@
 #include "ECS/Registry.hpp"
+#include <algorithm>
 #include <iostream>
 
 namespace RType {
@@ -18,8 +19,8 @@ namespace RType {
 #ifdef DEBUG
                 // CRITICAL: Verify entity has no components before reuse
                 // If this fires, DestroyEntity didn't clean up properly
-                for (const auto& [componentID, pool] : m_componentPools) {
-                    if (pool->Has(newEntity)) {
+                for (const auto& pool : m_componentPools) {
+                    if (pool && pool->Has(newEntity)) {
                         std::cerr << "[CRITICAL] Entity " << newEntity
                                   << " being reused but still has components!" << std::endl;
                         pool->Remove(newEntity);  // Emergency cleanup
@@ -30,6 +31,11 @@ namespace RType {
                 newEntity = m_nextEntityID++;
             }
 
+            if (newEntity >= m_signatures.size()) {
+                m_signatures.resize(newEntity + 1);
+                m_structureTicks.resize(newEntity + 1, 0);
+            }
+            m_structureTicks[newEntity] = m_changeTick;
             m_aliveEntities.insert(newEntity);
             m_entityCount++;
             return newEntity;
@@ -44,18 +50,31 @@ namespace RType {
             }
 
             // Remove all components from this entity
-            for (auto& [componentID, pool] : m_componentPools) {
-                if (pool->Has(entity)) {
+            for (auto& pool : m_componentPools) {
+                if (pool && pool->Has(entity)) {
                     pool->Remove(entity);
                 }
             }
 
+            // Drop it from every cached query it matched, then clear its bits
+            Signature& signature = m_signatures[entity];
+            for (auto& query : m_queries) {
+                if ((signature & query.signature) == query.signature) {
+                    auto it = std::lower_bound(query.entities.begin(), query.entities.end(), entity);
+                    if (it != query.entities.end() && *it == entity) {
+                        query.entities.erase(it);
+                    }
+                }
+            }
+            signature.reset();
+            m_structureTicks[entity] = m_changeTick;
+
 #ifdef DEBUG
             // Debug validation: Verify all components were actually removed
             // This helps catch component persistence bugs that cause entity type confusion
             size_t remainingComponents = 0;
-            for (const auto& [componentID, pool] : m_componentPools) {
-                if (pool->Has(entity)) {
+            for (const auto& pool : m_componentPools) {
+                if (pool && pool->Has(entity)) {
                     remainingComponents++;
                 }
             }
@@ -75,6 +94,103 @@ namespace RType {
             return m_aliveEntities.find(entity) != m_aliveEntities.end();
         }
 
+        const Signature& Registry::GetSignature(Entity entity) const {
+            static const Signature empty;
+            return entity < m_signatures.size() ? m_signatures[entity] : empty;
+        }
+
+        std::vector<Entity> Registry::GetEntitiesWithSignature(const Signature& signature) const {
+            // A copy: callers routinely add, remove and destroy while iterating
+            return GetQuery(signature).entities;
+        }
+
+        bool Registry::AnyChangedSince(Entity entity, const Signature& components, uint32_t tick) const {
+            if (entity < m_structureTicks.size() && m_structureTicks[entity] > tick) {
+                return true;
+            }
+            for (ComponentID id = 0; id < m_componentPools.size(); id++) {
+                if (components.test(id) && m_componentPools[id] && m_componentPools[id]->GetChangeTick(entity) > tick) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        const Registry::Query& Registry::GetQuery(const Signature& signature) const {
+            auto found = m_queryIndex.find(signature);
+            if (found != m_queryIndex.end()) {
+                return m_queries[found->second];
+            }
+
+            // First use: one scan over the signatures, ascending like the pools
+            Query query;
+            query.signature = signature;
+            for (Entity entity = 0; entity < m_signatures.size(); entity++) {
+                if (signature.any() && (m_signatures[entity] & signature) == signature) {
+                    query.entities.push_back(entity);
+                }
+            }
+
+            const std::size_t index = m_queries.size();
+            m_queries.push_back(std::move(query));
+            m_queryIndex.emplace(signature, index);
+            for (ComponentID id = 0; id < MAX_COMPONENTS; id++) {
+                if (signature.test(id)) {
+                    if (id >= m_queriesByComponent.size()) {
+                        m_queriesByComponent.resize(id + 1);
+                    }
+                    m_queriesByComponent[id].push_back(index);
+                }
+            }
+            return m_queries[index];
+        }
+
+        void Registry::AdvanceChangeTick() {
+            m_changeTick++;
+            for (auto& pool : m_componentPools) {
+                if (pool) {
+                    pool->SetChangeTick(m_changeTick);
+                }
+            }
+        }
+
+        void Registry::OnComponentAdded(Entity entity, ComponentID id) {
+            Signature& signature = m_signatures[entity];
+            signature.set(id);
+            m_structureTicks[entity] = m_changeTick;
+            if (id >= m_queriesByComponent.size()) {
+                return;
+            }
+            // Only queries naming this component can start matching
+            for (std::size_t index : m_queriesByComponent[id]) {
+                Query& query = m_queries[index];
+                if ((signature & query.signature) == query.signature) {
+                    auto it = std::lower_bound(query.entities.begin(), query.entities.end(), entity);
+                    query.entities.insert(it, entity);
+                }
+            }
+        }
+
+        void Registry::OnComponentRemoved(Entity entity, ComponentID id) {
+            if (entity >= m_signatures.size() || !m_signatures[entity].test(id)) {
+                return;
+            }
+            Signature& signature = m_signatures[entity];
+            if (id < m_queriesByComponent.size()) {
+                for (std::size_t index : m_queriesByComponent[id]) {
+                    Query& query = m_queries[index];
+                    if ((signature & query.signature) == query.signature) {
+                        auto it = std::lower_bound(query.entities.begin(), query.entities.end(), entity);
+                        if (it != query.entities.end() && *it == entity) {
+                            query.entities.erase(it);
+                        }
+                    }
+                }
+            }
+            signature.reset(id);
+            m_structureTicks[entity] = m_changeTick;
+        }
+
     }
 
 }
@@ -59,6 +59,7 @@ namespace RType {
                 transform.scale = drawable.scale;
                 transform.rotation = drawable.rotation;
                 transform.origin = drawable.origin;
+                transform.layer = drawable.layer;
 
                 Math::Color finalColor = drawable.tint;
                 if (RType::Core::ColorFilter::IsColourBlindModeEnabled()) {
@@ -93,9 +93,9 @@ namespace RType {
                     colliderPos.x = visualPos.x + metadata.offsetX;
                     colliderPos.y = visualPos.y + metadata.offsetY;
                 }
-                else if (metadata.visualEntity != NULL_ENTITY &&
-                         registry.IsEntityAlive(metadata.visualEntity) &&
-                         !registry.HasComponent<ObstacleVisual>(metadata.visualEntity)) {
+                else if (metadata.visualEntity != NULL_ENTITY) {
+                    // Visual scrolled out (or its id was recycled): the collider goes with it,
+                    // before a streamed obstacle can reuse the id and drag it back on screen
                     registry.DestroyEntity(entity);
                     continue;
                 }
@@ -110,6 +110,29 @@ namespace RType {
                     registry.DestroyEntity(entity);
                 }
             }
+
+            // Level-space geometry is moved by the registry scroll offset; it is only read
+            // here (through a const view, so it is not stamped as changed), to drop it
+            // once it is behind the screen
+            const Registry& view = registry;
+            const float scrollOffset = registry.GetScrollOffset();
+            for (auto entity : registry.GetEntitiesWithComponent<LevelSpace>()) {
+                if (!registry.IsEntityAlive(entity) || !registry.HasComponent<Position>(entity)) {
+                    continue;
+                }
+
+                const float worldX = view.GetComponent<Position>(entity).x + scrollOffset;
+                bool behindScreen = worldX < -1500.0f;
+                if (!behindScreen && registry.HasComponent<ObstacleMetadata>(entity)) {
+                    const auto& metadata = view.GetComponent<ObstacleMetadata>(entity);
+                    behindScreen = metadata.visualEntity != NULL_ENTITY &&
+                                   (!registry.IsEntityAlive(metadata.visualEntity) ||
+                                    !registry.HasComponent<ObstacleVisual>(metadata.visualEntity));
+                }
+                if (behindScreen) {
+                    registry.DestroyEntity(entity);
+                }
+            }
         }
     }
 }
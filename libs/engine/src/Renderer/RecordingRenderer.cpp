@@ -0,0 +1,631 @@
+#include "Renderer/RecordingRenderer.hpp"
+#include "Core/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <unordered_set>
+
+namespace Renderer {
+
+    namespace {
+
+        // Average glyph advance relative to the character size, used to size text without a font
+        constexpr float GLYPH_WIDTH_RATIO = 0.6f;
+
+        bool ReadPngSize(const std::string& path, std::uint32_t& width, std::uint32_t& height) {
+            std::ifstream file(path, std::ios::binary);
+            unsigned char header[24];
+            if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) {
+                return false;
+            }
+
+            static const unsigned char signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+            if (!std::equal(signature, signature + 8, header)) {
+                return false;
+            }
+
+            // IHDR is always the first chunk: width and height are big-endian at offsets 16 and 20
+            width = (header[16] << 24) | (header[17] << 16) | (header[18] << 8) | header[19];
+            height = (header[20] << 24) | (header[21] << 16) | (header[22] << 8) | header[23];
+            return true;
+        }
+
+    }
+
+    bool RecordingRenderer::Initialize(RType::Core::Engine* /* engine */) {
+        RType::Core::Logger::Info("Initializing RecordingRenderer module (headless)");
+        return true;
+    }
+
+    void RecordingRenderer::Shutdown() {
+        m_spriteBatch.Clear();
+        m_commands.clear();
+        m_sprites.clear();
+        m_textures.Clear();
+        m_fonts.Clear();
+        Destroy();
+    }
+
+    void RecordingRenderer::Update(float /* deltaTime */) {
+    }
+
+    bool RecordingRenderer::CreateWindow(const WindowConfig& config) {
+        m_windowConfig = config;
+        m_windowOpen = true;
+
+        m_defaultCamera.center = {640.0f, 360.0f};
+        m_defaultCamera.size = {1280.0f, 720.0f};
+        m_camera = m_defaultCamera;
+
+        if (m_rasterize) {
+            m_framebuffer.assign(static_cast<std::size_t>(config.width) * config.height, 0x000000FF);
+        }
+        return true;
+    }
+
+    void RecordingRenderer::Destroy() {
+        m_windowOpen = false;
+    }
+
+    void RecordingRenderer::Resize(std::uint32_t width, std::uint32_t height) {
+        if (width == 0 || height == 0) {
+            return;
+        }
+
+        m_windowConfig.width = width;
+        m_windowConfig.height = height;
+        if (m_rasterize) {
+            m_framebuffer.assign(static_cast<std::size_t>(width) * height, 0x000000FF);
+        }
+    }
+
+    void RecordingRenderer::BeginFrame() {
+        m_stats = RenderStats{};
+        m_lastBatchTexture = INVALID_TEXTURE_ID;
+        m_spriteBatch.Clear();
+        m_commands.clear();
+        m_textBuffer.clear();
+    }
+
+    void RecordingRenderer::EndFrame() {
+        FlushSprites();
+    }
+
+    void RecordingRenderer::Clear(const Color& color) {
+        m_spriteBatch.Clear();
+
+        DrawCommand command;
+        command.type = DrawCommandType::Clear;
+        command.color = color;
+        m_commands.push_back(command);
+
+        if (m_rasterize) {
+            std::fill(m_framebuffer.begin(), m_framebuffer.end(), PackColor(color));
+        }
+    }
+
+    TextureId RecordingRenderer::LoadTexture(const std::string& path, const TextureConfig& config) {
+        std::string key = TextureCacheKey(path, config);
+        if (TextureId cached = m_textures.Acquire(key)) {
+            return cached;
+        }
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            RType::Core::Logger::Error("Failed to load texture: {}", path);
+            return INVALID_TEXTURE_ID;
+        }
+
+        TextureData data;
+        data.path = path;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        if (ReadPngSize(path, width, height)) {
+            data.size = {static_cast<float>(width), static_cast<float>(height)};
+        }
+
+        return m_textures.Insert(key, std::move(data));
+    }
+
+    void RecordingRenderer::UnloadTexture(TextureId textureId) {
+        if (!m_textures.Contains(textureId)) {
+            RType::Core::Logger::Warning("Attempted to unload non-existent texture ID: {}", textureId);
+            return;
+        }
+
+        FlushSprites();
+
+        if (!m_textures.Release(textureId)) {
+            return;
+        }
+
+        for (auto spriteIt = m_sprites.begin(); spriteIt != m_sprites.end();) {
+            if (spriteIt->second.textureId == textureId) {
+                spriteIt = m_sprites.erase(spriteIt);
+            } else {
+                ++spriteIt;
+            }
+        }
+    }
+
+    bool RecordingRenderer::DecodeImage(const std::string& path, ImageData& image) const {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        image.pixels.clear();
+        if (!ReadPngSize(path, image.width, image.height)) {
+            image.width = 0;
+            image.height = 0;
+        }
+        return true;
+    }
+
+    TextureId RecordingRenderer::CreateTextureFromImage(const std::string& path, const ImageData& image,
+                                                        const TextureConfig& config) {
+        std::string key = TextureCacheKey(path, config);
+        if (TextureId cached = m_textures.Acquire(key)) {
+            return cached;
+        }
+
+        return m_textures.Insert(key, MakeTextureData(path, image));
+    }
+
+    RecordingRenderer::TextureData RecordingRenderer::MakeTextureData(const std::string& path, const ImageData& image) {
+        TextureData data;
+        data.path = path;
+        data.size = {static_cast<float>(image.width), static_cast<float>(image.height)};
+        if (image.pixels.size() == static_cast<std::size_t>(image.width) * image.height * 4) {
+            data.width = image.width;
+            data.height = image.height;
+            data.pixels.resize(static_cast<std::size_t>(image.width) * image.height);
+            for (std::size_t i = 0; i < data.pixels.size(); ++i) {
+                const std::uint8_t* rgba = &image.pixels[i * 4];
+                data.pixels[i] = (static_cast<std::uint32_t>(rgba[0]) << 24) | (rgba[1] << 16) | (rgba[2] << 8) | rgba[3];
+            }
+        }
+
+        return data;
+    }
+
+    Vector2 RecordingRenderer::GetTextureSize(TextureId textureId) const {
+        const auto* texture = m_textures.Get(textureId);
+        return texture ? texture->size : Vector2{0.0f, 0.0f};
+    }
+
+    std::size_t RecordingRenderer::BuildTextureAtlas(const std::vector<std::string>& paths, const AtlasConfig& config) {
+        TextureAtlasBuilder builder(config);
+        std::unordered_set<std::string> queued;
+        for (const auto& path : paths) {
+            std::string key = TextureCacheKey(path, TextureConfig{});
+            if (m_textures.Find(key) || !queued.insert(key).second) {
+                continue;
+            }
+            ImageData image;
+            if (DecodeImage(path, image)) {
+                builder.Add(path, std::move(image));
+            }
+        }
+        builder.Build();
+
+        std::vector<TextureId> pages;
+        for (const auto& page : builder.GetPages()) {
+            pages.push_back(m_textures.Insert("#atlas-page-" + std::to_string(m_atlasPageCount++),
+                                              MakeTextureData("", page)));
+        }
+
+        // Views keep the reference they are inserted with, so the atlas stays
+        // resident however many times its images are loaded and unloaded
+        for (const auto& entry : builder.GetEntries()) {
+            TextureData view;
+            view.path = entry.path;
+            view.size = entry.region.size;
+            view.atlasPage = pages[entry.page];
+            view.atlasOffset = entry.region.position;
+            m_textures.Insert(TextureCacheKey(entry.path, TextureConfig{}), std::move(view));
+        }
+
+        RType::Core::Logger::Info("Packed {} textures into {} atlas pages", builder.GetEntries().size(), pages.size());
+        return builder.GetEntries().size();
+    }
+
+    TextureId RecordingRenderer::GetSpriteTexture(SpriteId spriteId) const {
+        auto it = m_sprites.find(spriteId);
+        return (it != m_sprites.end()) ? it->second.textureId : INVALID_TEXTURE_ID;
+    }
+
+    SpriteId RecordingRenderer::CreateSprite(TextureId textureId, const Rectangle& region) {
+        const auto* texture = m_textures.Get(textureId);
+        if (!texture) {
+            RType::Core::Logger::Error("Cannot create sprite: texture ID {} not found", textureId);
+            return INVALID_SPRITE_ID;
+        }
+
+        SpriteData sprite;
+        sprite.textureId = texture->atlasPage != INVALID_TEXTURE_ID ? texture->atlasPage : textureId;
+        sprite.atlasOffset = texture->atlasOffset;
+        if (region.size.x > 0 && region.size.y > 0) {
+            sprite.region = region;
+        } else {
+            sprite.region.size = texture->size;
+        }
+        sprite.region.position.x += sprite.atlasOffset.x;
+        sprite.region.position.y += sprite.atlasOffset.y;
+
+        SpriteId id = m_nextSpriteId++;
+        m_sprites[id] = sprite;
+        return id;
+    }
+
+    void RecordingRenderer::DestroySprite(SpriteId spriteId) {
+        m_sprites.erase(spriteId);
+    }
+
+    void RecordingRenderer::SetSpriteRegion(SpriteId spriteId, const Rectangle& region) {
+        auto it = m_sprites.find(spriteId);
+        if (it != m_sprites.end()) {
+            it->second.region = region;
+            it->second.region.position.x += it->second.atlasOffset.x;
+            it->second.region.position.y += it->second.atlasOffset.y;
+        }
+    }
+
+    void RecordingRenderer::DrawSprite(SpriteId spriteId, const Transform2D& transform, const Color& tint) {
+        auto it = m_sprites.find(spriteId);
+        if (it == m_sprites.end()) {
+            RType::Core::Logger::Warning("Cannot draw sprite: ID {} not found", spriteId);
+            return;
+        }
+
+        const SpriteData& sprite = it->second;
+        bool hasTint = tint.r > 0 || tint.g > 0 || tint.b > 0 || tint.a > 0;
+        Color color = hasTint ? tint : Color{};
+
+        // Bounds ignore rotation; the batch carries the exact quad
+        DrawCommand command;
+        command.type = DrawCommandType::Sprite;
+        command.layer = transform.layer;
+        command.textureId = sprite.textureId;
+        command.spriteId = spriteId;
+        command.bounds.position = {transform.position.x - transform.origin.x * transform.scale.x,
+                                   transform.position.y - transform.origin.y * transform.scale.y};
+        command.bounds.size = {sprite.region.size.x * transform.scale.x,
+                               sprite.region.size.y * transform.scale.y};
+        command.color = color;
+        m_commands.push_back(command);
+
+        m_spriteBatch.Add(sprite.textureId, sprite.region, transform, color);
+    }
+
+    void RecordingRenderer::DrawRectangle(const Rectangle& rectangle, const Color& color) {
+        FlushSprites();
+
+        DrawCommand command;
+        command.type = DrawCommandType::Rectangle;
+        command.bounds = rectangle;
+        command.color = color;
+        m_commands.push_back(command);
+        m_stats.drawCalls++;
+
+        if (m_rasterize) {
+            FillRectangle(rectangle, color);
+        }
+    }
+
+    FontId RecordingRenderer::LoadFont(const std::string& path, std::uint32_t characterSize) {
+        std::string key = NormalizeAssetPath(path) + "|" + std::to_string(characterSize);
+        if (FontId cached = m_fonts.Acquire(key)) {
+            return cached;
+        }
+
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            RType::Core::Logger::Error("Failed to load font: {}", path);
+            return INVALID_FONT_ID;
+        }
+
+        return m_fonts.Insert(key, {path, characterSize});
+    }
+
+    void RecordingRenderer::UnloadFont(FontId fontId) {
+        m_fonts.Release(fontId);
+    }
+
+    void RecordingRenderer::DrawText(FontId fontId, const std::string& text, const TextParams& params) {
+        const auto* font = m_fonts.Get(fontId);
+        if (!font) {
+            RType::Core::Logger::Warning("Cannot draw text: font ID {} not found", fontId);
+            return;
+        }
+
+        FlushSprites();
+
+        // Approximate the glyph box: monospaced advance, one line per '\n'
+        std::size_t lines = 1;
+        std::size_t longestLine = 0;
+        std::size_t currentLine = 0;
+        for (char c : text) {
+            if (c == '\n') {
+                lines++;
+                currentLine = 0;
+            } else {
+                longestLine = std::max(longestLine, ++currentLine);
+            }
+        }
+        float characterSize = static_cast<float>(font->characterSize) * params.scale;
+        Vector2 size{longestLine * characterSize * GLYPH_WIDTH_RATIO, lines * characterSize};
+
+        DrawCommand command;
+        command.type = DrawCommandType::Text;
+        command.fontId = fontId;
+        command.bounds.position = params.centered
+            ? Vector2{params.position.x - size.x / 2.0f, params.position.y - size.y / 2.0f}
+            : params.position;
+        command.bounds.size = size;
+        command.color = params.color;
+        command.textOffset = static_cast<std::uint32_t>(m_textBuffer.size());
+        command.textLength = static_cast<std::uint32_t>(text.size());
+        m_textBuffer += text;
+        m_commands.push_back(command);
+        m_stats.drawCalls++;
+
+        if (m_rasterize) {
+            FillRectangle(command.bounds, params.color);
+        }
+    }
+
+    void RecordingRenderer::SetCamera(const Camera2D& camera) {
+        FlushSprites();
+
+        m_camera = camera;
+
+        DrawCommand command;
+        command.type = DrawCommandType::SetCamera;
+        command.bounds.position = camera.center;
+        command.bounds.size = camera.size;
+        m_commands.push_back(command);
+    }
+
+    void RecordingRenderer::ResetCamera() {
+        FlushSprites();
+
+        m_camera = m_defaultCamera;
+
+        DrawCommand command;
+        command.type = DrawCommandType::ResetCamera;
+        m_commands.push_back(command);
+    }
+
+    bool RecordingRenderer::IsKeyPressed(Key key) const {
+        auto index = static_cast<std::size_t>(static_cast<int>(key));
+        return key != Key::Unknown && index < m_keys.size() && m_keys[index];
+    }
+
+    bool RecordingRenderer::IsMouseButtonPressed(MouseButton button) const {
+        return m_mouseButtons[static_cast<int>(button)];
+    }
+
+    void RecordingRenderer::SetKeyPressed(Key key, bool pressed) {
+        if (key == Key::Unknown) {
+            return;
+        }
+        auto index = static_cast<std::size_t>(static_cast<int>(key));
+        if (index >= m_keys.size()) {
+            m_keys.resize(index + 1, false);
+        }
+        m_keys[index] = pressed;
+    }
+
+    void RecordingRenderer::SetMouseButtonPressed(MouseButton button, bool pressed) {
+        m_mouseButtons[static_cast<int>(button)] = pressed;
+    }
+
+    std::string RecordingRenderer::GetCommandText(const DrawCommand& command) const {
+        if (command.type != DrawCommandType::Text) {
+            return {};
+        }
+        return m_textBuffer.substr(command.textOffset, command.textLength);
+    }
+
+    std::map<TextureId, std::uint32_t> RecordingRenderer::CountSpritesByTexture() const {
+        std::map<TextureId, std::uint32_t> counts;
+        for (const auto& command : m_commands) {
+            if (command.type == DrawCommandType::Sprite) {
+                counts[command.textureId]++;
+            }
+        }
+        return counts;
+    }
+
+    std::map<int, std::uint32_t> RecordingRenderer::CountSpritesByLayer() const {
+        std::map<int, std::uint32_t> counts;
+        for (const auto& command : m_commands) {
+            if (command.type == DrawCommandType::Sprite) {
+                counts[command.layer]++;
+            }
+        }
+        return counts;
+    }
+
+    void RecordingRenderer::SetTexturePixels(TextureId textureId, std::uint32_t width, std::uint32_t height,
+                                             std::vector<std::uint32_t> pixels) {
+        auto* texture = m_textures.Get(textureId);
+        if (!texture || pixels.size() != static_cast<std::size_t>(width) * height) {
+            RType::Core::Logger::Warning("Ignoring pixels for texture ID {}", textureId);
+            return;
+        }
+
+        texture->width = width;
+        texture->height = height;
+        texture->size = {static_cast<float>(width), static_cast<float>(height)};
+        texture->pixels = std::move(pixels);
+    }
+
+    void RecordingRenderer::SetRasterizationEnabled(bool enabled) {
+        m_rasterize = enabled;
+        if (enabled) {
+            m_framebuffer.assign(static_cast<std::size_t>(m_windowConfig.width) * m_windowConfig.height, 0x000000FF);
+        } else {
+            m_framebuffer.clear();
+            m_framebuffer.shrink_to_fit();
+        }
+    }
+
+    std::uint32_t RecordingRenderer::GetPixel(std::uint32_t x, std::uint32_t y) const {
+        if (!m_rasterize || x >= m_windowConfig.width || y >= m_windowConfig.height) {
+            return 0;
+        }
+        return m_framebuffer[static_cast<std::size_t>(y) * m_windowConfig.width + x];
+    }
+
+    std::uint32_t RecordingRenderer::PackColor(const Color& color) {
+        auto channel = [](float value) {
+            return static_cast<std::uint32_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f);
+        };
+        return (channel(color.r) << 24) | (channel(color.g) << 16) | (channel(color.b) << 8) | channel(color.a);
+    }
+
+    void RecordingRenderer::FlushSprites() {
+        if (m_spriteBatch.IsEmpty()) {
+            return;
+        }
+
+        m_spriteBatch.Build();
+
+        for (const auto& batch : m_spriteBatch.GetBatches()) {
+            if (batch.textureId != m_lastBatchTexture) {
+                if (m_lastBatchTexture != INVALID_TEXTURE_ID) {
+                    m_stats.textureSwitches++;
+                }
+                m_lastBatchTexture = batch.textureId;
+            }
+            m_stats.drawCalls++;
+            m_stats.batches++;
+            m_stats.vertices += static_cast<std::uint32_t>(batch.vertexCount);
+        }
+        m_stats.sprites += static_cast<std::uint32_t>(m_spriteBatch.GetSpriteCount());
+
+        if (m_rasterize) {
+            RasterizeBatches();
+        }
+
+        m_spriteBatch.Clear();
+    }
+
+    Vector2 RecordingRenderer::WorldToPixel(const Vector2& point) const {
+        float scaleX = static_cast<float>(m_windowConfig.width) / m_camera.size.x;
+        float scaleY = static_cast<float>(m_windowConfig.height) / m_camera.size.y;
+        return {(point.x - (m_camera.center.x - m_camera.size.x / 2.0f)) * scaleX,
+                (point.y - (m_camera.center.y - m_camera.size.y / 2.0f)) * scaleY};
+    }
+
+    void RecordingRenderer::BlendPixel(std::uint32_t x, std::uint32_t y, std::uint32_t rgba) {
+        std::uint32_t alpha = rgba & 0xFF;
+        if (alpha == 0) {
+            return;
+        }
+
+        std::uint32_t& destination = m_framebuffer[static_cast<std::size_t>(y) * m_windowConfig.width + x];
+        if (alpha == 0xFF) {
+            destination = rgba;
+            return;
+        }
+
+        // Source-over with the destination kept opaque
+        std::uint32_t result = 0xFF;
+        for (int shift = 8; shift <= 24; shift += 8) {
+            std::uint32_t src = (rgba >> shift) & 0xFF;
+            std::uint32_t dst = (destination >> shift) & 0xFF;
+            result |= ((src * alpha + dst * (255 - alpha)) / 255) << shift;
+        }
+        destination = result;
+    }
+
+    void RecordingRenderer::FillRectangle(const Rectangle& rectangle, const Color& color) {
+        Vector2 topLeft = WorldToPixel(rectangle.position);
+        Vector2 bottomRight = WorldToPixel({rectangle.position.x + rectangle.size.x,
+                                            rectangle.position.y + rectangle.size.y});
+
+        auto clampX = [this](float v) { return std::clamp(v, 0.0f, static_cast<float>(m_windowConfig.width)); };
+        auto clampY = [this](float v) { return std::clamp(v, 0.0f, static_cast<float>(m_windowConfig.height)); };
+        auto x0 = static_cast<std::uint32_t>(std::lround(clampX(std::min(topLeft.x, bottomRight.x))));
+        auto x1 = static_cast<std::uint32_t>(std::lround(clampX(std::max(topLeft.x, bottomRight.x))));
+        auto y0 = static_cast<std::uint32_t>(std::lround(clampY(std::min(topLeft.y, bottomRight.y))));
+        auto y1 = static_cast<std::uint32_t>(std::lround(clampY(std::max(topLeft.y, bottomRight.y))));
+
+        std::uint32_t rgba = PackColor(color);
+        for (std::uint32_t y = y0; y < y1; ++y) {
+            for (std::uint32_t x = x0; x < x1; ++x) {
+                BlendPixel(x, y, rgba);
+            }
+        }
+    }
+
+    void RecordingRenderer::RasterizeBatches() {
+        const auto& vertices = m_spriteBatch.GetVertices();
+        const float width = static_cast<float>(m_windowConfig.width);
+        const float height = static_cast<float>(m_windowConfig.height);
+
+        for (const auto& batch : m_spriteBatch.GetBatches()) {
+            const TextureData* texture = m_textures.Get(batch.textureId);
+            if (texture && texture->pixels.empty()) {
+                texture = nullptr;
+            }
+
+            // SpriteBatch emits quads as two triangles (0,1,2)(0,2,3); sprites are
+            // parallelograms, so rasterize each quad in its own 2D basis.
+            for (std::size_t i = batch.firstVertex; i < batch.firstVertex + batch.vertexCount;
+                 i += SpriteBatch::VERTICES_PER_SPRITE) {
+                const BatchVertex& v0 = vertices[i];
+                const BatchVertex& v1 = vertices[i + 1];
+                const BatchVertex& v3 = vertices[i + 5];
+                Vector2 p0 = WorldToPixel(v0.position);
+                Vector2 p1 = WorldToPixel(v1.position);
+                Vector2 p2 = WorldToPixel(vertices[i + 2].position);
+                Vector2 p3 = WorldToPixel(v3.position);
+
+                Vector2 axisU{p1.x - p0.x, p1.y - p0.y};
+                Vector2 axisV{p3.x - p0.x, p3.y - p0.y};
+                float determinant = axisU.x * axisV.y - axisU.y * axisV.x;
+                if (determinant == 0.0f) {
+                    continue;
+                }
+
+                int minX = static_cast<int>(std::max(0.0f, std::floor(std::min({p0.x, p1.x, p2.x, p3.x}))));
+                int maxX = static_cast<int>(std::min(width - 1.0f, std::ceil(std::max({p0.x, p1.x, p2.x, p3.x}))));
+                int minY = static_cast<int>(std::max(0.0f, std::floor(std::min({p0.y, p1.y, p2.y, p3.y}))));
+                int maxY = static_cast<int>(std::min(height - 1.0f, std::ceil(std::max({p0.y, p1.y, p2.y, p3.y}))));
+
+                // Sample at pixel centers; (a, b) are the coordinates along the two quad edges
+                for (int y = minY; y <= maxY; ++y) {
+                    for (int x = minX; x <= maxX; ++x) {
+                        float dx = static_cast<float>(x) + 0.5f - p0.x;
+                        float dy = static_cast<float>(y) + 0.5f - p0.y;
+                        float a = (dx * axisV.y - dy * axisV.x) / determinant;
+                        float b = (axisU.x * dy - axisU.y * dx) / determinant;
+                        if (a < 0.0f || a >= 1.0f || b < 0.0f || b >= 1.0f) {
+                            continue;
+                        }
+
+                        Color color = v0.color;
+                        if (texture) {
+                            float u = v0.texCoords.x + a * (v1.texCoords.x - v0.texCoords.x);
+                            float v = v0.texCoords.y + b * (v3.texCoords.y - v0.texCoords.y);
+                            auto tx = static_cast<std::uint32_t>(std::clamp(u, 0.0f, texture->size.x - 1.0f));
+                            auto ty = static_cast<std::uint32_t>(std::clamp(v, 0.0f, texture->size.y - 1.0f));
+                            std::uint32_t texel = texture->pixels[static_cast<std::size_t>(ty) * texture->width + tx];
+                            color.r *= static_cast<float>((texel >> 24) & 0xFF) / 255.0f;
+                            color.g *= static_cast<float>((texel >> 16) & 0xFF) / 255.0f;
+                            color.b *= static_cast<float>((texel >> 8) & 0xFF) / 255.0f;
+                            color.a *= static_cast<float>(texel & 0xFF) / 255.0f;
+                        }
+
+                        BlendPixel(static_cast<std::uint32_t>(x), static_cast<std::uint32_t>(y), PackColor(color));
+                    }
+                }
+            }
+        }
+    }
+
+}
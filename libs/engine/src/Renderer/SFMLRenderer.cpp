@@ -3,6 +3,7 @@
 #include "Core/Logger.hpp"
 #include <cmath>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Renderer {
 
@@ -33,9 +34,11 @@ namespace Renderer {
     void SFMLRenderer::Shutdown() {
         RType::Core::Logger::Info("Shutting down SFMLRenderer module");
 
+        m_spriteBatch.Clear();
         m_sprites.clear();
-        m_textures.clear();
-        m_fonts.clear();
+        m_textures.Clear();
+        m_fonts.Clear();
+        m_fontFiles.clear();
 
         Destroy();
         m_engine = nullptr;
@@ -47,9 +50,6 @@ namespace Renderer {
         }
 
         ProcessEvents();
-
-        m_stats.drawCalls = 0;
-        m_stats.textureSwitches = 0;
     }
 
     bool SFMLRenderer::ShouldUpdateInRenderThread() const {
@@ -147,8 +147,9 @@ namespace Renderer {
             return;
         }
 
-        m_stats.drawCalls = 0;
-        m_stats.textureSwitches = 0;
+        m_stats = RenderStats{};
+        m_lastBatchTexture = INVALID_TEXTURE_ID;
+        m_spriteBatch.Clear();
     }
 
     void SFMLRenderer::EndFrame() {
@@ -156,6 +157,7 @@ namespace Renderer {
             return;
         }
 
+        FlushSprites();
         m_window->display();
     }
 
@@ -164,10 +166,16 @@ namespace Renderer {
             return;
         }
 
+        m_spriteBatch.Clear();
         m_window->clear(ToSFMLColor(color));
     }
 
     TextureId SFMLRenderer::LoadTexture(const std::string& path, const TextureConfig& config) {
+        std::string key = TextureCacheKey(path, config);
+        if (TextureId cached = m_textures.Acquire(key)) {
+            return cached;
+        }
+
         auto texture = std::make_shared<sf::Texture>();
 
         if (!texture->loadFromFile(path)) {
@@ -177,20 +185,25 @@ namespace Renderer {
         texture->setSmooth(config.smooth);
         texture->setRepeated(config.repeated);
 
-        TextureId id = m_nextTextureId++;
-        m_textures[id] = {texture, config};
+        TextureId id = m_textures.Insert(key, {texture, config});
 
         RType::Core::Logger::Debug("Loaded texture: {} (ID: {})", path, id);
         return id;
     }
 
     void SFMLRenderer::UnloadTexture(TextureId textureId) {
-        auto it = m_textures.find(textureId);
-        if (it == m_textures.end()) {
+        if (!m_textures.Contains(textureId)) {
             RType::Core::Logger::Warning("Attempted to unload non-existent texture ID: {}", textureId);
             return;
         }
 
+        FlushSprites();
+
+        // Other owners still hold references: keep the texture and its sprites
+        if (!m_textures.Release(textureId)) {
+            return;
+        }
+
         for (auto spriteIt = m_sprites.begin(); spriteIt != m_sprites.end();) {
             if (spriteIt->second.textureId == textureId) {
                 spriteIt = m_sprites.erase(spriteIt);
@@ -199,22 +212,99 @@ namespace Renderer {
             }
         }
 
-        m_textures.erase(it);
         RType::Core::Logger::Debug("Unloaded texture ID: {}", textureId);
     }
 
+    bool SFMLRenderer::DecodeImage(const std::string& path, ImageData& image) const {
+        // sf::Image is CPU-only, so this can run on a loader thread
+        sf::Image decoded;
+        if (!decoded.loadFromFile(path)) {
+            return false;
+        }
+
+        sf::Vector2u size = decoded.getSize();
+        image.width = size.x;
+        image.height = size.y;
+        const sf::Uint8* pixels = decoded.getPixelsPtr();
+        image.pixels.assign(pixels, pixels + static_cast<std::size_t>(size.x) * size.y * 4);
+        return true;
+    }
+
+    TextureId SFMLRenderer::CreateTextureFromImage(const std::string& path, const ImageData& image,
+                                                   const TextureConfig& config) {
+        std::string key = TextureCacheKey(path, config);
+        if (TextureId cached = m_textures.Acquire(key)) {
+            return cached;
+        }
+
+        auto texture = CreateSFMLTexture(image, config);
+        if (!texture) {
+            RType::Core::Logger::Error("Failed to create texture: {}", path);
+            return 0;
+        }
+
+        TextureId id = m_textures.Insert(key, {texture, config});
+
+        RType::Core::Logger::Debug("Uploaded texture: {} (ID: {})", path, id);
+        return id;
+    }
+
     Vector2 SFMLRenderer::GetTextureSize(TextureId textureId) const {
-        auto it = m_textures.find(textureId);
-        if (it == m_textures.end()) {
+        const auto* data = m_textures.Get(textureId);
+        if (!data) {
             return {0.0f, 0.0f};
         }
-        sf::Vector2u size = it->second.texture->getSize();
+        if (data->atlasPage != INVALID_TEXTURE_ID) {
+            return data->atlasRegion.size;
+        }
+        sf::Vector2u size = data->texture->getSize();
         return {static_cast<float>(size.x), static_cast<float>(size.y)};
     }
 
+    std::size_t SFMLRenderer::BuildTextureAtlas(const std::vector<std::string>& paths, const AtlasConfig& config) {
+        TextureAtlasBuilder builder(config);
+        std::unordered_set<std::string> queued;
+        for (const auto& path : paths) {
+            std::string key = TextureCacheKey(path, TextureConfig{});
+            if (m_textures.Find(key) || !queued.insert(key).second) {
+                continue;
+            }
+            ImageData image;
+            if (DecodeImage(path, image)) {
+                builder.Add(path, std::move(image));
+            }
+        }
+        builder.Build();
+
+        std::vector<TextureId> pages;
+        std::vector<std::shared_ptr<sf::Texture>> pageTextures;
+        for (const auto& page : builder.GetPages()) {
+            auto texture = CreateSFMLTexture(page, TextureConfig{});
+            if (!texture) {
+                RType::Core::Logger::Error("Failed to create atlas page of {}x{}", page.width, page.height);
+                return 0;
+            }
+            pageTextures.push_back(texture);
+            pages.push_back(m_textures.Insert("#atlas-page-" + std::to_string(m_atlasPageCount++),
+                                              {texture, TextureConfig{}}));
+        }
+
+        // Views keep the reference they are inserted with, so the atlas stays
+        // resident however many times its images are loaded and unloaded
+        for (const auto& entry : builder.GetEntries()) {
+            TextureData view{pageTextures[entry.page], TextureConfig{}};
+            view.atlasPage = pages[entry.page];
+            view.atlasRegion = entry.region;
+            m_textures.Insert(TextureCacheKey(entry.path, TextureConfig{}), std::move(view));
+        }
+
+        RType::Core::Logger::Info("Packed {} textures into {} atlas pages", builder.GetEntries().size(), pages.size());
+        return builder.GetEntries().size();
+    }
+
     SpriteId SFMLRenderer::CreateSprite(TextureId textureId, const Rectangle& region) {
-        auto it = m_textures.find(textureId);
-        if (it == m_textures.end()) {
+        const auto* texture = m_textures.Get(textureId);
+        if (!texture) {
             RType::Core::Logger::Error("Cannot create sprite: texture ID {} not found", textureId);
             return 0;
         }
@@ -222,16 +312,16 @@ namespace Renderer {
         SpriteId id = m_nextSpriteId++;
 
         SpriteData spriteData;
-        spriteData.sprite.setTexture(*it->second.texture);
-        spriteData.textureId = textureId;
+        spriteData.textureId = texture->atlasPage != INVALID_TEXTURE_ID ? texture->atlasPage : textureId;
+        spriteData.atlasOffset = texture->atlasRegion.position;
 
         if (region.size.x > 0 && region.size.y > 0) {
-            spriteData.sprite.setTextureRect(sf::IntRect(
-                static_cast<int>(region.position.x),
-                static_cast<int>(region.position.y),
-                static_cast<int>(region.size.x),
-                static_cast<int>(region.size.y)));
+            spriteData.region = region;
+        } else {
+            spriteData.region.size = GetTextureSize(textureId);
         }
+        spriteData.region.position.x += spriteData.atlasOffset.x;
+        spriteData.region.position.y += spriteData.atlasOffset.y;
 
         m_sprites[id] = spriteData;
 
@@ -257,7 +347,9 @@ namespace Renderer {
             return;
         }
 
-        it->second.sprite.setTextureRect(ToSFMLRect(region));
+        it->second.region = region;
+        it->second.region.position.x += it->second.atlasOffset.x;
+        it->second.region.position.y += it->second.atlasOffset.y;
     }
 
     void SFMLRenderer::DrawSprite(SpriteId spriteId, const Transform2D& transform, const Color& tint) {
@@ -271,21 +363,54 @@ namespace Renderer {
             return;
         }
 
-        sf::Sprite& sprite = it->second.sprite;
+        // Integer texture rect, as sf::Sprite::setTextureRect would store it
+        const Rectangle& region = it->second.region;
+        Rectangle texelRegion;
+        texelRegion.position = {std::trunc(region.position.x), std::trunc(region.position.y)};
+        texelRegion.size = {std::trunc(region.size.x), std::trunc(region.size.y)};
 
-        sprite.setPosition(ToSFMLVector(transform.position));
-        sprite.setScale(ToSFMLVector(transform.scale));
-        sprite.setRotation(transform.rotation);
-        sprite.setOrigin(ToSFMLVector(transform.origin));
+        bool hasTint = tint.r > 0 || tint.g > 0 || tint.b > 0 || tint.a > 0;
+        m_spriteBatch.Add(it->second.textureId, texelRegion, transform, hasTint ? tint : Color{});
+    }
 
-        if (tint.r > 0 || tint.g > 0 || tint.b > 0 || tint.a > 0) {
-            sprite.setColor(ToSFMLColor(tint));
-        } else {
-            sprite.setColor(sf::Color::White);
+    void SFMLRenderer::FlushSprites() {
+        if (!m_window || m_spriteBatch.IsEmpty()) {
+            return;
         }
 
-        m_window->draw(sprite);
-        m_stats.drawCalls++;
+        m_spriteBatch.Build();
+
+        const auto& vertices = m_spriteBatch.GetVertices();
+        m_batchVertices.resize(vertices.size());
+        for (std::size_t i = 0; i < vertices.size(); ++i) {
+            sf::Vertex& vertex = m_batchVertices[i];
+            vertex.position = ToSFMLVector(vertices[i].position);
+            vertex.texCoords = ToSFMLVector(vertices[i].texCoords);
+            vertex.color = ToSFMLColor(vertices[i].color);
+        }
+
+        for (const auto& batch : m_spriteBatch.GetBatches()) {
+            const auto* texture = m_textures.Get(batch.textureId);
+            if (!texture) {
+                continue;
+            }
+
+            if (batch.textureId != m_lastBatchTexture) {
+                if (m_lastBatchTexture != INVALID_TEXTURE_ID) {
+                    m_stats.textureSwitches++;
+                }
+                m_lastBatchTexture = batch.textureId;
+            }
+
+            sf::RenderStates states(texture->texture.get());
+            m_window->draw(&m_batchVertices[batch.firstVertex], batch.vertexCount, sf::Triangles, states);
+            m_stats.drawCalls++;
+            m_stats.batches++;
+            m_stats.vertices += static_cast<std::uint32_t>(batch.vertexCount);
+        }
+
+        m_stats.sprites += static_cast<std::uint32_t>(m_spriteBatch.GetSpriteCount());
+        m_spriteBatch.Clear();
     }
 
     void SFMLRenderer::DrawRectangle(const Rectangle& rectangle, const Color& color) {
@@ -293,6 +418,8 @@ namespace Renderer {
             return;
         }
 
+        FlushSprites();
+
         sf::RectangleShape rect(ToSFMLVector(rectangle.size));
         rect.setPosition(ToSFMLVector(rectangle.position));
         rect.setFillColor(ToSFMLColor(color));
@@ -302,29 +429,38 @@ namespace Renderer {
     }
 
     FontId SFMLRenderer::LoadFont(const std::string& path, std::uint32_t characterSize) {
-        auto font = std::make_shared<sf::Font>();
-
-        if (!font->loadFromFile(path)) {
-            RType::Core::Logger::Error("Failed to load font: {}", path);
-            return 0;
+        std::string file = NormalizeAssetPath(path);
+        std::string key = file + "|" + std::to_string(characterSize);
+        if (FontId cached = m_fonts.Acquire(key)) {
+            return cached;
+        }
+
+        auto font = m_fontFiles[file].lock();
+        if (!font) {
+            font = std::make_shared<sf::Font>();
+            if (!font->loadFromFile(path)) {
+                RType::Core::Logger::Error("Failed to load font: {}", path);
+                m_fontFiles.erase(file);
+                return 0;
+            }
+            m_fontFiles[file] = font;
         }
 
-        FontId id = m_nextFontId++;
-        m_fonts[id] = {font, characterSize};
+        FontId id = m_fonts.Insert(key, {font, characterSize});
 
         RType::Core::Logger::Debug("Loaded font: {} (ID: {}, size: {})", path, id, characterSize);
         return id;
     }
 
     void SFMLRenderer::UnloadFont(FontId fontId) {
-        auto it = m_fonts.find(fontId);
-        if (it == m_fonts.end()) {
+        if (!m_fonts.Contains(fontId)) {
             RType::Core::Logger::Warning("Attempted to unload non-existent font ID: {}", fontId);
             return;
         }
 
-        m_fonts.erase(it);
-        RType::Core::Logger::Debug("Unloaded font ID: {}", fontId);
+        if (m_fonts.Release(fontId)) {
+            RType::Core::Logger::Debug("Unloaded font ID: {}", fontId);
+        }
     }
 
     void SFMLRenderer::DrawText(FontId fontId, const std::string& text, const TextParams& params) {
@@ -332,16 +468,18 @@ namespace Renderer {
             return;
         }
 
-        auto it = m_fonts.find(fontId);
-        if (it == m_fonts.end()) {
+        const auto* font = m_fonts.Get(fontId);
+        if (!font) {
             RType::Core::Logger::Warning("Cannot draw text: font ID {} not found", fontId);
             return;
         }
 
+        FlushSprites();
+
         sf::Text sfText;
-        sfText.setFont(*it->second.font);
+        sfText.setFont(*font->font);
         sfText.setString(text);
-        sfText.setCharacterSize(it->second.characterSize);
+        sfText.setCharacterSize(font->characterSize);
         sfText.setRotation(params.rotation);
         sfText.setFillColor(ToSFMLColor(params.color));
         sfText.setScale(sf::Vector2f(params.scale, params.scale));
@@ -362,6 +500,8 @@ namespace Renderer {
             return;
         }
 
+        FlushSprites();
+
         m_currentView.setCenter(ToSFMLVector(camera.center));
         m_currentView.setSize(camera.size.x, camera.size.y);
         m_window->setView(m_currentView);
@@ -377,6 +517,8 @@ namespace Renderer {
             return;
         }
 
+        FlushSprites();
+
         m_currentView = m_defaultView;
         m_window->setView(m_currentView);
         m_usingCustomCamera = false;
@@ -408,6 +550,22 @@ namespace Renderer {
         }
     }
 
+    std::shared_ptr<sf::Texture> SFMLRenderer::CreateSFMLTexture(const ImageData& image, const TextureConfig& config) {
+        if (image.width == 0 || image.height == 0 ||
+            image.pixels.size() != static_cast<std::size_t>(image.width) * image.height * 4) {
+            return nullptr;
+        }
+
+        auto texture = std::make_shared<sf::Texture>();
+        if (!texture->create(image.width, image.height)) {
+            return nullptr;
+        }
+        texture->update(image.pixels.data());
+        texture->setSmooth(config.smooth);
+        texture->setRepeated(config.repeated);
+        return texture;
+    }
+
     sf::Color SFMLRenderer::ToSFMLColor(const Color& color) {
         return sf::Color(
             static_cast<std::uint8_t>(color.r * 255.0f),
@@ -0,0 +1,94 @@
+#include "Renderer/SpriteBatch.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Renderer {
+
+    void SpriteBatch::Add(TextureId textureId, const Rectangle& region,
+                          const Transform2D& transform, const Color& color) {
+        QueuedSprite sprite;
+        sprite.layer = transform.layer;
+        sprite.textureId = textureId;
+        sprite.region = region;
+        sprite.color = color;
+
+        // Same composition as sf::Transformable: translate(position) * rotate * scale * translate(-origin)
+        const float left = -transform.origin.x * transform.scale.x;
+        const float top = -transform.origin.y * transform.scale.y;
+        const float right = left + region.size.x * transform.scale.x;
+        const float bottom = top + region.size.y * transform.scale.y;
+        const Vector2 local[4] = {{left, top}, {right, top}, {right, bottom}, {left, bottom}};
+
+        if (transform.rotation == 0.0f) {
+            for (int i = 0; i < 4; ++i) {
+                sprite.corners[i] = {transform.position.x + local[i].x, transform.position.y + local[i].y};
+            }
+        } else {
+            const float radians = transform.rotation * 3.14159265358979f / 180.0f;
+            const float cosine = std::cos(radians);
+            const float sine = std::sin(radians);
+            for (int i = 0; i < 4; ++i) {
+                sprite.corners[i] = {transform.position.x + local[i].x * cosine - local[i].y * sine,
+                                     transform.position.y + local[i].x * sine + local[i].y * cosine};
+            }
+        }
+
+        m_sprites.push_back(sprite);
+    }
+
+    void SpriteBatch::Build() {
+        m_order.resize(m_sprites.size());
+        for (std::size_t i = 0; i < m_order.size(); ++i) {
+            m_order[i] = i;
+        }
+
+        // Stable so that sprites sharing a layer and texture keep submission order
+        std::stable_sort(m_order.begin(), m_order.end(), [this](std::size_t a, std::size_t b) {
+            const auto& lhs = m_sprites[a];
+            const auto& rhs = m_sprites[b];
+            if (lhs.layer != rhs.layer) {
+                return lhs.layer < rhs.layer;
+            }
+            return lhs.textureId < rhs.textureId;
+        });
+
+        m_vertices.clear();
+        m_vertices.reserve(m_sprites.size() * VERTICES_PER_SPRITE);
+        m_batches.clear();
+
+        for (std::size_t index : m_order) {
+            const auto& sprite = m_sprites[index];
+
+            if (m_batches.empty() || m_batches.back().textureId != sprite.textureId) {
+                m_batches.push_back({sprite.textureId, m_vertices.size(), 0});
+            }
+
+            const float u0 = sprite.region.position.x;
+            const float v0 = sprite.region.position.y;
+            const float u1 = u0 + sprite.region.size.x;
+            const float v1 = v0 + sprite.region.size.y;
+            const BatchVertex quad[4] = {
+                {sprite.corners[0], {u0, v0}, sprite.color},
+                {sprite.corners[1], {u1, v0}, sprite.color},
+                {sprite.corners[2], {u1, v1}, sprite.color},
+                {sprite.corners[3], {u0, v1}, sprite.color},
+            };
+
+            // Two triangles per quad
+            m_vertices.push_back(quad[0]);
+            m_vertices.push_back(quad[1]);
+            m_vertices.push_back(quad[2]);
+            m_vertices.push_back(quad[0]);
+            m_vertices.push_back(quad[2]);
+            m_vertices.push_back(quad[3]);
+            m_batches.back().vertexCount += VERTICES_PER_SPRITE;
+        }
+    }
+
+    void SpriteBatch::Clear() {
+        m_sprites.clear();
+        m_vertices.clear();
+        m_batches.clear();
+    }
+
+}
@@ -0,0 +1,145 @@
+#include "Renderer/TextureAtlas.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+#include <system_error>
+
+namespace Renderer {
+
+    TextureAtlasBuilder::TextureAtlasBuilder(const AtlasConfig& config)
+        : m_config(config) {}
+
+    bool TextureAtlasBuilder::Add(const std::string& path, ImageData image) {
+        const std::uint32_t padded = 2 * m_config.padding;
+        if (image.width == 0 || image.height == 0 ||
+            image.width > m_config.maxImageSize || image.height > m_config.maxImageSize ||
+            image.width + padded > m_config.pageSize || image.height + padded > m_config.pageSize) {
+            return false;
+        }
+
+        m_images.push_back({path, std::move(image)});
+        return true;
+    }
+
+    void TextureAtlasBuilder::Build() {
+        m_pages.clear();
+        m_entries.clear();
+
+        std::vector<std::size_t> order(m_images.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+            const auto& lhs = m_images[a].image;
+            const auto& rhs = m_images[b].image;
+            if (lhs.height != rhs.height) {
+                return lhs.height > rhs.height;
+            }
+            return lhs.width > rhs.width;
+        });
+
+        // Layout pass: shelves filled left to right, a new page when a shelf no longer fits
+        std::uint32_t cursorX = 0;
+        std::uint32_t shelfY = 0;
+        std::uint32_t shelfHeight = 0;
+        std::vector<Vector2> pageExtents;
+        std::vector<std::size_t> entryImage;
+
+        for (std::size_t index : order) {
+            const ImageData& image = m_images[index].image;
+            const std::uint32_t width = image.width + 2 * m_config.padding;
+            const std::uint32_t height = image.height + 2 * m_config.padding;
+
+            if (pageExtents.empty() || cursorX + width > m_config.pageSize) {
+                shelfY += shelfHeight;
+                cursorX = 0;
+                shelfHeight = 0;
+            }
+            if (pageExtents.empty() || shelfY + height > m_config.pageSize) {
+                pageExtents.push_back({0.0f, 0.0f});
+                cursorX = 0;
+                shelfY = 0;
+                shelfHeight = 0;
+            }
+
+            AtlasEntry entry;
+            entry.path = m_images[index].path;
+            entry.page = pageExtents.size() - 1;
+            entry.region.position = {static_cast<float>(cursorX + m_config.padding),
+                                     static_cast<float>(shelfY + m_config.padding)};
+            entry.region.size = {static_cast<float>(image.width), static_cast<float>(image.height)};
+            m_entries.push_back(entry);
+            entryImage.push_back(index);
+
+            cursorX += width;
+            shelfHeight = std::max(shelfHeight, height);
+            Vector2& extent = pageExtents.back();
+            extent.x = std::max(extent.x, static_cast<float>(cursorX));
+            extent.y = std::max(extent.y, static_cast<float>(shelfY + height));
+        }
+
+        // Pages are cropped to what they use
+        const bool hasPixels = std::all_of(m_images.begin(), m_images.end(), [](const PendingImage& pending) {
+            return pending.image.pixels.size() == static_cast<std::size_t>(pending.image.width) * pending.image.height * 4;
+        });
+
+        m_pages.resize(pageExtents.size());
+        for (std::size_t i = 0; i < m_pages.size(); ++i) {
+            m_pages[i].width = static_cast<std::uint32_t>(pageExtents[i].x);
+            m_pages[i].height = static_cast<std::uint32_t>(pageExtents[i].y);
+            if (hasPixels) {
+                m_pages[i].pixels.assign(static_cast<std::size_t>(m_pages[i].width) * m_pages[i].height * 4, 0);
+            }
+        }
+
+        if (hasPixels) {
+            for (std::size_t i = 0; i < m_entries.size(); ++i) {
+                const AtlasEntry& entry = m_entries[i];
+                Blit(m_pages[entry.page], m_images[entryImage[i]].image,
+                     static_cast<std::uint32_t>(entry.region.position.x),
+                     static_cast<std::uint32_t>(entry.region.position.y));
+            }
+        }
+
+        m_images.clear();
+    }
+
+    void TextureAtlasBuilder::Blit(ImageData& page, const ImageData& image, std::uint32_t x, std::uint32_t y) const {
+        const int padding = static_cast<int>(m_config.padding);
+        const int width = static_cast<int>(image.width);
+        const int height = static_cast<int>(image.height);
+
+        // Border texels are repeated into the padding
+        for (int row = -padding; row < height + padding; ++row) {
+            const int sourceRow = std::clamp(row, 0, height - 1);
+            std::uint8_t* destination = &page.pixels[((static_cast<std::size_t>(y + row) * page.width) + x - padding) * 4];
+            const std::uint8_t* source = &image.pixels[static_cast<std::size_t>(sourceRow) * image.width * 4];
+
+            for (int column = -padding; column < 0; ++column, destination += 4) {
+                std::copy(source, source + 4, destination);
+            }
+            std::copy(source, source + static_cast<std::size_t>(width) * 4, destination);
+            destination += static_cast<std::size_t>(width) * 4;
+            const std::uint8_t* last = source + static_cast<std::size_t>(width - 1) * 4;
+            for (int column = 0; column < padding; ++column, destination += 4) {
+                std::copy(last, last + 4, destination);
+            }
+        }
+    }
+
+    std::vector<std::string> TextureAtlasBuilder::CollectImages(const std::vector<std::string>& directories) {
+        std::vector<std::string> paths;
+
+        for (const auto& directory : directories) {
+            std::error_code error;
+            for (std::filesystem::recursive_directory_iterator it(directory, error), end; !error && it != end;
+                 it.increment(error)) {
+                if (it->is_regular_file(error) && it->path().extension() == ".png") {
+                    paths.push_back(it->path().string());
+                }
+            }
+        }
+
+        std::sort(paths.begin(), paths.end());
+        return paths;
+    }
+
+}
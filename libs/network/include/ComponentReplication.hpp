@@ -0,0 +1,155 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ComponentReplication - ECS components bound to replicated fields
+*/
+
+#pragma once
+
+#include "ReplicationSchema.hpp"
+#include "ECS/Registry.hpp"
+#include "ECS/Component.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace network {
+
+    namespace Replication {
+
+        // How an ECS component maps onto EntityState. FIELDS names the DeltaFlags
+        // groups it fills; the server captures it, the client applies it back.
+        template <typename Component>
+        struct ComponentBinding;
+
+        template <>
+        struct ComponentBinding<RType::ECS::Position> {
+            static constexpr uint8_t FIELDS = DELTA_POSITION;
+            static void Capture(const RType::ECS::Position& pos, EntityState& state) {
+                state.x = pos.x;
+                state.y = pos.y;
+            }
+            static void Apply(const EntityState& state, RType::ECS::Position& pos) {
+                pos.x = state.x;
+                pos.y = state.y;
+            }
+        };
+
+        template <>
+        struct ComponentBinding<RType::ECS::Velocity> {
+            static constexpr uint8_t FIELDS = DELTA_VELOCITY;
+            static void Capture(const RType::ECS::Velocity& vel, EntityState& state) {
+                state.vx = vel.dx;
+                state.vy = vel.dy;
+            }
+            static void Apply(const EntityState& state, RType::ECS::Velocity& vel) {
+                vel.dx = state.vx;
+                vel.dy = state.vy;
+            }
+        };
+
+        // Clamped to the 16-bit wire field; the boss sends a percent instead
+        template <>
+        struct ComponentBinding<RType::ECS::Health> {
+            static constexpr uint8_t FIELDS = DELTA_HEALTH;
+            static void Capture(const RType::ECS::Health& health, EntityState& state) {
+                state.health = static_cast<uint16_t>(std::min(0xFFFF, std::max(0, health.current)));
+            }
+            static void Apply(const EntityState& state, RType::ECS::Health& health) {
+                health.current = static_cast<int>(state.health);
+            }
+        };
+
+        // Speed multipliers and fire rates travel as tenths in a byte
+        inline uint8_t EncodeTenths(float value) {
+            return static_cast<uint8_t>(std::min(255, std::max(0, static_cast<int>(value * 10.0f))));
+        }
+        inline float DecodeTenths(uint8_t value) {
+            return static_cast<float>(value) / 10.0f;
+        }
+
+        template <>
+        struct ComponentBinding<RType::ECS::ScoreValue> {
+            static constexpr uint8_t FIELDS = DELTA_SCORE;
+            static void Capture(const RType::ECS::ScoreValue& score, EntityState& state) {
+                state.score = score.points;
+            }
+            static void Apply(const EntityState& state, RType::ECS::ScoreValue& score) {
+                score.points = state.score;
+            }
+        };
+
+        // Only the boss flash: other entity types use flags to pick a sprite
+        template <>
+        struct ComponentBinding<RType::ECS::DamageFlash> {
+            static constexpr uint8_t FIELDS = DELTA_FLAGS;
+            static void Capture(const RType::ECS::DamageFlash& flash, EntityState& state) {
+                state.flags = flash.isActive ? 1 : 0;
+            }
+            static void Apply(const EntityState& state, RType::ECS::DamageFlash& flash) {
+                flash.isActive = state.flags == 1;
+            }
+        };
+
+        // POWERUP_FORCE_POD is not a component of the ship: the server ORs it in afterwards
+        template <>
+        struct ComponentBinding<RType::ECS::ActivePowerUps> {
+            static constexpr uint8_t FIELDS = DELTA_POWERUP;
+            static void Capture(const RType::ECS::ActivePowerUps& powerUps, EntityState& state) {
+                state.powerUpFlags = (powerUps.hasFireRateBoost ? POWERUP_FIRE_RATE_BOOST : 0) |
+                                     (powerUps.hasSpreadShot ? POWERUP_SPREAD_SHOT : 0) |
+                                     (powerUps.hasLaserBeam ? POWERUP_LASER_BEAM : 0) |
+                                     (powerUps.hasShield ? POWERUP_SHIELD : 0);
+                state.speedMultiplier = EncodeTenths(powerUps.speedMultiplier);
+            }
+            static void Apply(const EntityState& state, RType::ECS::ActivePowerUps& powerUps) {
+                powerUps.hasFireRateBoost = (state.powerUpFlags & POWERUP_FIRE_RATE_BOOST) != 0;
+                powerUps.hasSpreadShot = (state.powerUpFlags & POWERUP_SPREAD_SHOT) != 0;
+                powerUps.hasLaserBeam = (state.powerUpFlags & POWERUP_LASER_BEAM) != 0;
+                powerUps.hasShield = (state.powerUpFlags & POWERUP_SHIELD) != 0;
+                powerUps.speedMultiplier = DecodeTenths(state.speedMultiplier);
+            }
+        };
+
+        template <>
+        struct ComponentBinding<RType::ECS::WeaponSlot> {
+            static constexpr uint8_t FIELDS = DELTA_WEAPON;
+            static void Capture(const RType::ECS::WeaponSlot& weapon, EntityState& state) {
+                state.weaponType = static_cast<uint8_t>(weapon.type);
+                state.fireRate = EncodeTenths(weapon.fireRate);
+            }
+            static void Apply(const EntityState& state, RType::ECS::WeaponSlot& weapon) {
+                weapon.type = static_cast<RType::ECS::WeaponType>(state.weaponType);
+                weapon.fireRate = DecodeTenths(state.fireRate);
+            }
+        };
+
+        // The standard gun of a ship without a WeaponSlot
+        template <>
+        struct ComponentBinding<RType::ECS::Shooter> {
+            static constexpr uint8_t FIELDS = DELTA_WEAPON;
+            static void Capture(const RType::ECS::Shooter& shooter, EntityState& state) {
+                state.fireRate = EncodeTenths(shooter.fireRate);
+            }
+            static void Apply(const EntityState& state, RType::ECS::Shooter& shooter) {
+                shooter.fireRate = DecodeTenths(state.fireRate);
+            }
+        };
+
+        // Fills the fields of every listed component; the entity must have them all
+        template <typename... Components>
+        void CaptureComponents(const RType::ECS::Registry& registry, RType::ECS::Entity entity, EntityState& state) {
+            (ComponentBinding<Components>::Capture(registry.GetComponent<Components>(entity), state), ...);
+        }
+
+        // Writes back the listed components the entity has, for the groups set in fields
+        template <typename... Components>
+        void ApplyComponents(RType::ECS::Registry& registry, RType::ECS::Entity entity, const EntityState& state, uint8_t fields) {
+            ((fields & ComponentBinding<Components>::FIELDS && registry.HasComponent<Components>(entity)
+                ? ComponentBinding<Components>::Apply(state, registry.GetComponent<Components>(entity))
+                : void()), ...);
+        }
+
+    }
+
+}
@@ -0,0 +1,67 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** EntityReplicator
+*/
+
+#pragma once
+
+#include "Protocol.hpp"
+#include "ECS/Registry.hpp"
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <functional>
+
+namespace network {
+
+    // How one kind of server entity is replicated: the components that select
+    // it, the components its state is read from, and the function writing them
+    // into an EntityState (id and type are filled in by the caller). Kinds are
+    // disjoint; an entity matching several is sent as the first registered.
+    struct ReplicatedType {
+        EntityType type;
+        RType::ECS::Signature required;
+        RType::ECS::Signature excluded;
+        RType::ECS::Signature inputs;  // Rebuilt when one of these changes; none: every tick
+        size_t maxEntities = 0;         // Per snapshot and wire type, shared by its kinds; 0 for no limit
+        std::function<void(const RType::ECS::Registry&, RType::ECS::Entity, EntityState&)> build;
+    };
+
+    // Keeps one EntityState per replicated entity in step with a registry.
+    // Update() only rebuilds an entity's state when one of its kind's inputs
+    // changed since the previous call (see Registry::AnyChangedSince); entities
+    // that stop matching, die (health 0) or fall outside their type's cap are
+    // dropped, and rebuilt from scratch if they come back.
+    class EntityReplicator {
+    public:
+        void AddType(ReplicatedType type) { m_types.push_back(std::move(type)); }
+        void Update(RType::ECS::Registry& registry);
+
+        const std::unordered_map<uint32_t, EntityState>& GetStates() const { return m_states; }  // By network id
+        const std::unordered_set<uint32_t>& GetChangedIds() const { return m_changedIds; }  // Rebuilt by the last Update()
+        // Network id the entity is sent under, 0 when it is not replicated
+        uint32_t GetNetworkId(RType::ECS::Entity entity) const;
+
+    private:
+        struct ReplicatedEntity {
+            uint32_t networkId = 0;
+            uint32_t build = 0;  // Last Update() that saw it
+        };
+
+        uint32_t GetOrAssignNetworkId(RType::ECS::Registry& registry, RType::ECS::Entity entity);
+        void RegisterNetworkType(uint32_t netId, EntityType type);
+
+        std::vector<ReplicatedType> m_types;
+        std::unordered_map<uint32_t, EntityState> m_states;
+        std::unordered_map<RType::ECS::Entity, ReplicatedEntity> m_entities;
+        std::unordered_set<uint32_t> m_changedIds;
+        uint32_t m_replicatedTick = 0;  // Registry change tick of the last build
+        uint32_t m_build = 0;
+
+        uint32_t m_nextNetworkId = 1;
+        std::unordered_map<uint32_t, EntityType> m_networkIdTypes;
+    };
+
+}
@@ -9,6 +9,8 @@
 
 #include "Protocol.hpp"
 #include "INetworkModule.hpp"
+#include "PacketFragmenter.hpp"
+#include "SnapshotCodec.hpp"
 #include <vector>
 #include <unordered_map>
 #include <chrono>
@@ -27,6 +29,13 @@ namespace network {
         void RunHeadless(float duration);
         void Stop();
 
+        // Building blocks of ConnectToServer()/RunHeadless() for drivers that step
+        // many clients themselves: send HELLO then poll until IsConnected(), and call
+        // UpdateHeadless() once per frame (receives, and sends inputs at 60 Hz).
+        void SendHello();
+        void UpdateHeadless();
+        void SendPing();
+
         void SetInputGenerator(std::function<uint8_t()> generator) { m_inputGenerator = generator; }
         void SetStateCallback(std::function<void(uint32_t, const std::vector<EntityState>&, const std::vector<InputAck>&)> callback) {
             m_stateCallback = callback;
@@ -34,13 +43,25 @@ namespace network {
         void SetLevelCompleteCallback(std::function<void(uint8_t, uint8_t)> callback) {
             m_levelCompleteCallback = callback;
         }
+        void SetPongCallback(std::function<void(float)> callback) { m_pongCallback = callback; }
+        // Time source in seconds (steady clock by default); load tests plug a virtual clock here.
+        void SetClock(std::function<double()> clock) { m_clock = clock; }
 
         uint32_t GetLastServerTick() const { return m_lastServerTick; }
         uint32_t GetInputSequence() const { return m_inputSequence; }
         float GetLastScrollOffset() const { return m_lastScrollOffset; }
+        // DeltaFlags groups the last STATE/STATE_DELTA carried for this entity, 0 if it was not updated
+        uint8_t GetChangedFields(uint32_t entityId) const;
         uint64_t GetPacketsSent() const { return m_packetsSent; }
         uint64_t GetPacketsReceived() const { return m_packetsReceived; }
+        uint64_t GetBytesSent() const { return m_bytesSent; }
+        uint64_t GetBytesReceived() const { return m_bytesReceived; }
+        float GetLastRtt() const { return m_lastRtt; }
         bool IsConnected() const { return m_connected; }
+        const FragmentStats& GetFragmentStats() const { return m_reassembler.GetStats(); }
+        void SetFragmentConfig(const FragmentReassembler::Config& config) { m_reassembler = FragmentReassembler(config); }
+        // Trained dictionary matching the server's, required to decode COMPRESSION_ZSTD_DICT snapshots
+        void SetCompressionDictionary(const std::vector<uint8_t>& dictionary);
 
         void SendInput(uint8_t inputs);
         void ReceivePackets();
@@ -49,11 +70,14 @@ namespace network {
         void HandleWelcome(const std::vector<uint8_t>& data);
         void HandleState(const std::vector<uint8_t>& data);
         void HandleStateDelta(const std::vector<uint8_t>& data);
+        void HandleFragment(const std::vector<uint8_t>& data);
         void HandlePong(const std::vector<uint8_t>& data);
         void HandleLevelComplete(const std::vector<uint8_t>& data);
         void SendStateAck(uint32_t stateSequence);
 
         uint8_t GenerateRandomInputs();
+        void Send(const std::vector<uint8_t>& packet);
+        uint32_t GetTimeMs() const { return static_cast<uint32_t>(static_cast<uint64_t>(m_clock() * 1000.0)); }
 
         Network::INetworkModule* m_network = nullptr;
         Network::SocketId m_udpSocket = Network::INVALID_SOCKET_ID;
@@ -70,13 +94,23 @@ namespace network {
         std::function<uint8_t()> m_inputGenerator;
         std::function<void(uint32_t, const std::vector<EntityState>&, const std::vector<InputAck>&)> m_stateCallback;
         std::function<void(uint8_t, uint8_t)> m_levelCompleteCallback;
+        std::function<void(float)> m_pongCallback;
+        std::function<double()> m_clock;
+        double m_lastInputTime = -1.0;
+        float m_lastRtt = 0.0f;
 
         std::atomic<uint64_t> m_packetsSent{0};
         std::atomic<uint64_t> m_packetsReceived{0};
+        std::atomic<uint64_t> m_bytesSent{0};
+        std::atomic<uint64_t> m_bytesReceived{0};
 
-        std::unordered_map<uint32_t, EntityState> m_entityStates;
+        EntityStateTable m_entityStates;
         uint32_t m_lastReceivedStateSeq = 0;
         uint32_t m_lastAckedStateSeq = 0;
+
+        FragmentReassembler m_reassembler;
+
+        SnapshotCodec m_codec;
         static constexpr uint32_t STATE_ACK_INTERVAL = 5;
     };
 
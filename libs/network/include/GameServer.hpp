@@ -9,6 +9,11 @@
 
 #include "Protocol.hpp"
 #include "INetworkModule.hpp"
+#include "SnapshotBudget.hpp"
+#include "PacketFragmenter.hpp"
+#include "SnapshotCompressor.hpp"
+#include "InputLog.hpp"
+#include "EntityReplicator.hpp"
 #include "ECS/Registry.hpp"
 #include "ECS/Component.hpp"
 #include "ECS/MovementSystem.hpp"
@@ -24,6 +29,7 @@
 #include "ECS/BlackOrbSystem.hpp"
 #include "ECS/ThirdBulletSystem.hpp"
 #include "ECS/LevelLoader.hpp"
+#include "ECS/LevelStreamer.hpp"
 #include "ECS/HealthSystem.hpp"
 #include "ECS/ScoreSystem.hpp"
 #include "ECS/PlayerFactory.hpp"
@@ -33,13 +39,17 @@
 #include "ECS/ShootingSystem.hpp"
 #include "ECS/ForcePodSystem.hpp"
 #include "ECS/ShieldSystem.hpp"
+#include "ECS/SimulationRng.hpp"
 #include <vector>
+#include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <chrono>
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <future>
 #include <cmath>
 #include <array>
 #include <string>
@@ -54,10 +64,6 @@ namespace network {
         FORMATION = 4
     };
 
-    struct GameEntity;
-
-    using MovementPatternFunc = void (*)(GameEntity&, float);
-
     struct EnemyStats {
         float speed;
         uint8_t health;
@@ -66,7 +72,6 @@ namespace network {
         float bulletXOffset;
         float bulletYOffset;
         uint8_t collisionDamageMultiplier;
-        MovementPatternFunc movementPattern;
     };
 
     struct ConnectedPlayer {
@@ -76,21 +81,8 @@ namespace network {
         uint32_t lastInputSequence = 0;
         bool alive = true;
         uint32_t lastAckedStateSeq = 0;
-    };
-
-    struct GameEntity {
-        uint32_t id;
-        EntityType type;
-        float x, y;
-        float vx, vy;
-        uint16_t health;
-        uint8_t flags;
-        uint64_t ownerHash = 0;
-        uint32_t score = 0;
-        uint8_t powerUpFlags = 0;
-        uint8_t speedMultiplier = 10;
-        uint8_t weaponType = 0;
-        uint8_t fireRate = 20;
+        ClientSnapshotState snapshot;
+        PayloadHistory sentPayloads;  // Delta payloads by sequence, compression context for COMPRESSION_LZ4_HISTORY
     };
 
     class GameServer {
@@ -102,6 +94,14 @@ namespace network {
 
         void Run();
         void Stop();
+
+        // Headless drivers (replay, load tests) call Start() once and then Tick()
+        // at their own pace instead of Run(). Tick() returns false once stopped.
+        void Start();
+        bool Tick();
+        // Non-blocking Start(): handles pending HELLOs and starts the match once
+        // every expected player is connected. Returns true when started.
+        bool TryStart();
         bool AllPlayersDisconnected() const;
 
         uint32_t GetCurrentTick() const { return m_currentTick; }
@@ -110,6 +110,14 @@ namespace network {
         uint64_t GetPacketsReceived() const { return m_packetsReceived; }
         const std::string& GetLevelPath() const { return m_levelPath; }
 
+        // Seeds every gameplay random draw of this room; call before Run() to reproduce a match.
+        void SetSeed(uint64_t seed) { m_rng.Reseed(seed); }
+        uint64_t GetSeed() const { return m_rng.GetSeed(); }
+        // Logs every applied input per tick (with seed, level and players) for r-type_replay.
+        bool RecordInputs(const std::string& path);
+        // Hash of network ids, positions, health and scroll, to compare two runs of the same inputs.
+        uint64_t ComputeStateChecksum() const;
+
         uint64_t GetTotalBytesSent() const { return m_totalBytesSent; }
         uint64_t GetDeltaBytesSent() const { return m_deltaBytesSent; }
         uint64_t GetFullSnapshotBytesSent() const { return m_fullSnapshotBytesSent; }
@@ -121,12 +129,28 @@ namespace network {
             if (totalWithoutDelta == 0) return 0.0f;
             return (1.0f - static_cast<float>(m_totalBytesSent) / static_cast<float>(totalWithoutDelta)) * 100.0f;
         }
-    private:
-        uint32_t GetOrAssignNetworkId(RType::ECS::Entity entity);
 
+        void SetSnapshotBudget(const SnapshotBudgetConfig& config) { m_snapshotBudget = config; }
+        const SnapshotBudgetConfig& GetSnapshotBudget() const { return m_snapshotBudget; }
+        SnapshotStats GetSnapshotStats(uint64_t playerHash) const;
+        uint32_t GetMaxSnapshotPacketBytes() const { return m_maxSnapshotPacketBytes; }
+        uint32_t GetMaxStarvationTicks() const { return m_maxStarvationTicks; }
+        uint64_t GetFragmentedPacketsSent() const { return m_fragmentedPacketsSent; }
+
+        // Selects the STATE_DELTA compressor; zstd needs the trained dictionary the clients also load.
+        bool SetSnapshotCompression(CompressionFlags flag, const std::vector<uint8_t>& dictionary = {});
+        // Appends every uncompressed delta payload to path, for dictionary training and benchmarks.
+        bool RecordSnapshotTraffic(const std::string& path) { return m_trafficRecorder.Open(path); }
+    private:
         void WaitForAllPlayers();
+        void StartMatch();
         void ProcessIncomingPackets();
         void SendStateSnapshots();
+        void SendFullSnapshot(ConnectedPlayer& player, const std::unordered_map<uint32_t, EntityState>& currentStates,
+            const std::vector<InputAck>& inputAcks);
+        void SendDeltaSnapshot(ConnectedPlayer& player, const std::unordered_map<uint32_t, EntityState>& currentStates,
+            const std::vector<InputAck>& inputAcks, const EntityState* viewer);
+        void RecordSnapshotSent(ConnectedPlayer& player, size_t packetSize);
         void HandlePacket(const std::vector<uint8_t>& data, const Network::Endpoint& from);
         void HandleHello(const std::vector<uint8_t>& data, const Network::Endpoint& from);
         void HandleInput(const std::vector<uint8_t>& data, const Network::Endpoint& from);
@@ -143,24 +167,25 @@ namespace network {
         bool IsBossActive() const;
         void CheckBossDefeated();
         void LoadNextLevelIfNeeded();
+        void PreloadNextLevel();
+        void CleanupLevelEntities();
         void SpawnEnemyBullet(uint32_t enemyId, float x, float y, uint8_t enemyType);
         void SpawnBullet(uint64_t ownerHash, float x, float y);
         void UpdateBullets(float dt);
         void UpdateEnemies(float dt);
-        void CleanupDeadEntities();
-        void UpdateLegacyEntitiesFromRegistry();
+        void RegisterReplicatedTypes();
+        void ScrubObstacleComponents();
+        void UpdateReplicatedStates();
 
         EnemyType GetRandomEnemyType();
         const EnemyStats& GetEnemyStats(EnemyType type) const;
 
-        void RegisterNetworkType(uint32_t netId, EntityType type);
-
         uint32_t GetNextEntityId() { return m_nextEntityId++; }
 
         Network::INetworkModule* m_network = nullptr;
         Network::SocketId m_udpSocket = Network::INVALID_SOCKET_ID;
         std::vector<PlayerInfo> m_expectedPlayers;
-        std::unordered_map<uint64_t, ConnectedPlayer> m_connectedPlayers;
+        std::map<uint64_t, ConnectedPlayer> m_connectedPlayers;  // Ordered by hash, so every walk is reproducible
         const std::chrono::seconds DISCONNECT_TIMEOUT{10};
 
         RType::ECS::Registry m_registry;
@@ -182,28 +207,34 @@ namespace network {
         std::unique_ptr<RType::ECS::ShootingSystem> m_shootingSystem;
         std::unique_ptr<RType::ECS::ForcePodSystem> m_forcePodSystem;
         std::unique_ptr<RType::ECS::ShieldSystem> m_shieldSystem;
+        RType::ECS::LevelStreamer m_levelStreamer;
 
-        std::vector<GameEntity> m_entities;
         uint32_t m_currentTick = 0;
 
-        uint32_t m_nextNetworkId = 1;
-        std::unordered_map<uint32_t, EntityType> m_networkIdTypes;
+        // Snapshots are serialized straight from the replicator's states, which
+        // UpdateReplicatedStates() keeps in step with the registry
+        EntityReplicator m_replicator;
 
         uint32_t m_nextEntityId = 1;
         std::atomic<bool> m_running{false};
+        bool m_matchStarted = false;
 
-        float m_scrollOffset = 0.0f;
-        const float SCROLL_SPEED = -150.0f;
+        float m_scrollOffset = 0.0f;  // Mirrors the level streamer, sent in every state header
 
-        std::chrono::steady_clock::time_point m_lastSpawnTime;
+        static constexpr uint32_t TICKS_PER_SECOND = 60;
+        RType::ECS::SimulationRng m_rng;
+        uint32_t m_lastSpawnTick = 0;
         float m_enemySpawnInterval = 2.0f;
 
-        std::unordered_map<uint32_t, float> m_enemyShootCooldowns;
+        std::map<uint32_t, float> m_enemyShootCooldowns;  // Ordered by enemy id, like m_connectedPlayers
         std::unordered_map<uint32_t, uint8_t> m_enemyBulletTypes;
 
         std::atomic<uint64_t> m_packetsSent{0};
         std::atomic<uint64_t> m_packetsReceived{0};
 
+        std::atomic<uint16_t> m_nextFragmentMessageId{0};
+        std::atomic<uint64_t> m_fragmentedPacketsSent{0};
+
         static const std::array<EnemyStats, 5> s_enemyStats;
 
         std::string m_levelPath;
@@ -214,11 +245,27 @@ namespace network {
         float m_levelTransitionTimer = 0.0f;
         bool m_waitingForLevelTransition = false;
 
+        // Next level parsed and its timeline built on a loader thread, started
+        // when the boss spawns so the transition only swaps it in
+        struct PreloadedLevel {
+            int levelNumber = 0;
+            std::string path;
+            bool loaded = false;
+            RType::ECS::LevelData data;
+            RType::ECS::LevelStreamer streamer;
+        };
+        std::future<PreloadedLevel> m_nextLevel;
+
         uint32_t m_stateSequence = 0;
-        std::unordered_map<uint32_t, EntityState> m_lastSentState;
-        std::vector<uint32_t> m_destroyedEntities;
         static constexpr uint32_t FULL_SNAPSHOT_INTERVAL = 60;
-        static constexpr float POSITION_DELTA_THRESHOLD = 0.5f;
+        static constexpr size_t MAX_OBSTACLES_PER_SNAPSHOT = 256;
+        SnapshotBudgetConfig m_snapshotBudget;
+        uint32_t m_maxSnapshotPacketBytes = 0;
+        uint32_t m_maxStarvationTicks = 0;
+        std::unique_ptr<ISnapshotCompressor> m_snapshotCompressor = std::make_unique<Lz4HistoryCompressor>();
+        std::vector<uint8_t> m_compressedScratch;
+        SnapshotTrafficRecorder m_trafficRecorder;
+        InputLogWriter m_inputLog;
 
         std::atomic<uint64_t> m_totalBytesSent{0};
         std::atomic<uint64_t> m_deltaBytesSent{0};
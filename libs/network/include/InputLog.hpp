@@ -0,0 +1,85 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** InputLog - compact binary recording of the inputs a GameServer applied
+*/
+
+#pragma once
+
+#include "Protocol.hpp"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace network {
+
+    // File layout (little endian, packed):
+    //   InputLogHeader, levelPath bytes, playerCount x InputLogPlayer,
+    //   then per tick with events: uint32 tick, uint16 eventCount, eventCount x InputLogEvent,
+    //   closed by the last simulated tick with an eventCount of 0
+    constexpr uint32_t INPUT_LOG_MAGIC = 0x52495452; // "RTIR"
+    constexpr uint16_t INPUT_LOG_VERSION = 1;
+
+    enum class InputLogEventType : uint8_t {
+        INPUT = 0,
+        DISCONNECT = 1,
+    };
+
+#pragma pack(push, 1)
+    struct InputLogHeader {
+        uint32_t magic = INPUT_LOG_MAGIC;
+        uint16_t version = INPUT_LOG_VERSION;
+        uint64_t seed = 0;
+        uint8_t playerCount = 0;
+        uint16_t levelPathLength = 0;
+    };
+
+    struct InputLogPlayer {
+        uint64_t hash = 0;
+        uint8_t number = 0;
+        char name[PLAYER_NAME_SIZE] = {};
+    };
+
+    struct InputLogEvent {
+        uint64_t playerHash = 0;
+        uint8_t type = static_cast<uint8_t>(InputLogEventType::INPUT);
+        uint8_t inputs = 0;
+        uint32_t sequence = 0;
+    };
+#pragma pack(pop)
+
+    class InputLogWriter {
+    public:
+        bool Open(const std::string& path, uint64_t seed, const std::string& levelPath, const std::vector<PlayerInfo>& players);
+        bool IsOpen() const { return m_file.is_open(); }
+
+        // Events are buffered and written once per tick by EndTick.
+        void Record(const InputLogEvent& event) { m_pending.push_back(event); }
+        void EndTick(uint32_t tick);
+        void Close();
+    private:
+        std::ofstream m_file;
+        std::vector<InputLogEvent> m_pending;
+        uint32_t m_lastTick = 0;
+    };
+
+    class InputLogReader {
+    public:
+        bool Open(const std::string& path);
+
+        uint64_t GetSeed() const { return m_header.seed; }
+        const std::string& GetLevelPath() const { return m_levelPath; }
+        const std::vector<PlayerInfo>& GetPlayers() const { return m_players; }
+
+        // Next tick that has events (or the final tick, with no events); false at end of file.
+        bool ReadTick(uint32_t& tick, std::vector<InputLogEvent>& events);
+    private:
+        std::ifstream m_file;
+        InputLogHeader m_header;
+        std::string m_levelPath;
+        std::vector<PlayerInfo> m_players;
+    };
+
+}
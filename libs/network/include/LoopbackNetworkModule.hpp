@@ -0,0 +1,166 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LoopbackNetworkModule - in-process INetworkModule without real sockets
+*/
+
+#pragma once
+
+#include "INetworkModule.hpp"
+#include <deque>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+namespace Network {
+
+    // Network impairments applied to traffic on a link (one direction, one pair of ports)
+    struct LinkConditions {
+        double latency = 0.0;              // One-way delay in seconds
+        double jitter = 0.0;               // Extra uniform delay in [0, jitter] seconds
+        float lossRate = 0.0f;             // Probability that a datagram is dropped (UDP only)
+        float reorderRate = 0.0f;          // Probability that a datagram is held back by reorderDelay
+        double reorderDelay = 0.03;
+        std::uint32_t bandwidth = 0;       // Bytes per second, 0 = unlimited
+        std::size_t queueLimit = 64 * 1024; // Bytes waiting for bandwidth before tail drop (UDP only)
+    };
+
+    // Memory-backed transport driven by a virtual clock: sockets exchange
+    // datagrams and framed TCP messages through in-process queues, and nothing
+    // is delivered before the clock reaches its scheduled arrival time.
+    // Advance the clock with AdvanceTime() (or Update(), which does the same).
+    // With default conditions everything is delivered on the next receive.
+    class LoopbackNetworkModule : public INetworkModule {
+    public:
+        static constexpr std::uint16_t FIRST_EPHEMERAL_PORT = 49152;
+
+        struct Stats {
+            std::uint64_t datagramsSent = 0;
+            std::uint64_t datagramsDelivered = 0;
+            std::uint64_t datagramsLost = 0;       // Dropped by lossRate
+            std::uint64_t datagramsOverflowed = 0; // Dropped because the bandwidth queue was full
+            std::uint64_t datagramsUnreachable = 0; // No socket bound to the destination port
+            std::uint64_t datagramsReordered = 0;
+            std::uint64_t bytesSent = 0;
+            std::uint64_t bytesDelivered = 0;
+            std::uint64_t tcpMessagesSent = 0;
+            std::uint64_t tcpBytesSent = 0;
+        };
+
+        LoopbackNetworkModule() = default;
+        ~LoopbackNetworkModule() override = default;
+
+        const char* GetName() const override { return "LoopbackNetworkModule"; }
+        RType::Core::ModulePriority GetPriority() const override {
+            return RType::Core::ModulePriority::High;
+        }
+        bool Initialize(RType::Core::Engine* engine) override;
+        void Shutdown() override;
+        void Update(float deltaTime) override { AdvanceTime(deltaTime); }
+
+        // TCP Socket Operations (reliable, ordered, framed like AsioNetworkModule)
+        SocketId CreateTcpSocket(const SocketConfig& config = SocketConfig{}) override;
+        bool ConnectTcp(SocketId socketId, const Endpoint& endpoint) override;
+        bool BindTcp(SocketId socketId, std::uint16_t port) override;
+        bool ListenTcp(SocketId socketId, std::uint32_t backlog = 10) override;
+        std::optional<SocketId> AcceptTcp(SocketId serverSocketId, Endpoint& clientEndpoint) override;
+        bool SendTcp(SocketId socketId, const std::vector<std::uint8_t>& data) override;
+        std::optional<std::vector<std::uint8_t>> ReceiveTcp(SocketId socketId, std::size_t maxSize = 2048) override;
+
+        // UDP Socket Operations
+        SocketId CreateUdpSocket(const SocketConfig& config = SocketConfig{}) override;
+        bool BindUdp(SocketId socketId, std::uint16_t port) override;
+        bool SendUdp(SocketId socketId, const std::vector<std::uint8_t>& data, const Endpoint& to) override;
+        std::optional<ReceivedPacket> ReceiveUdp(SocketId socketId, std::size_t maxSize = 2048) override;
+
+        // Common Socket Operations
+        void CloseSocket(SocketId socketId) override;
+        bool IsSocketValid(SocketId socketId) const override;
+        SocketError GetLastError() const override;
+        SocketInfo GetSocketInfo(SocketId socketId) const override;
+
+        // Utility
+        Endpoint ResolveHostname(const std::string& hostname, std::uint16_t port) override;
+        std::string GetLocalAddress() const override { return "127.0.0.1"; }
+
+        // Virtual clock
+        void AdvanceTime(double seconds);
+        double GetTime() const;
+        // Arrival time of the next message in flight, or a negative value if none.
+        double GetNextDeliveryTime() const;
+
+        // Conditions for every link without an override.
+        void SetConditions(const LinkConditions& conditions);
+        // Override for traffic sent from or to a local port (e.g. one client's UDP socket).
+        void SetPortConditions(std::uint16_t port, const LinkConditions& conditions);
+        void ClearPortConditions(std::uint16_t port);
+        void SetSeed(std::uint32_t seed);
+
+        Stats GetStats() const;
+
+    private:
+        struct UdpSocketData {
+            Endpoint localEndpoint;
+            std::deque<ReceivedPacket> queue;
+        };
+
+        struct TcpSocketData {
+            Endpoint localEndpoint;
+            SocketId peer = INVALID_SOCKET_ID;
+            bool listening = false;
+            bool peerClosed = false;
+            std::deque<SocketId> acceptQueue;
+            std::uint32_t backlog = 0;
+            std::deque<std::vector<std::uint8_t>> inbox;
+        };
+
+        // Per (source port, destination port) state used to serialize traffic through the bandwidth cap
+        struct LinkState {
+            double busyUntil = 0.0;
+            double lastArrival = 0.0; // Keeps TCP messages in order
+        };
+
+        struct InFlight {
+            double deliverAt = 0.0;
+            std::uint64_t order = 0;
+            bool tcp = false;
+            SocketId tcpTarget = INVALID_SOCKET_ID;
+            std::uint16_t udpPort = 0;
+            ReceivedPacket packet;
+
+            bool operator>(const InFlight& other) const {
+                return deliverAt != other.deliverAt ? deliverAt > other.deliverAt : order > other.order;
+            }
+        };
+
+        const LinkConditions& GetConditions(std::uint16_t fromPort, std::uint16_t toPort) const;
+        // Arrival time of a message on the link, or nullopt if it is dropped
+        std::optional<double> Schedule(std::uint16_t fromPort, std::uint16_t toPort, std::size_t size, bool reliable);
+        void DeliverDue();
+        std::uint16_t AllocatePort();
+        bool IsPortUsed(std::uint16_t port) const;
+        void setLastError(SocketError error) const { m_lastError = error; }
+
+        std::unordered_map<SocketId, UdpSocketData> m_udpSockets;
+        std::unordered_map<SocketId, TcpSocketData> m_tcpSockets;
+        std::unordered_map<std::uint16_t, SocketId> m_boundUdpPorts;
+        std::unordered_map<std::uint16_t, SocketId> m_tcpListeners;
+        std::unordered_map<std::uint32_t, LinkState> m_links;
+        std::vector<InFlight> m_inFlight; // Min-heap on arrival time
+
+        LinkConditions m_defaultConditions;
+        std::unordered_map<std::uint16_t, LinkConditions> m_portConditions;
+        std::mt19937 m_rng{0x52545950};
+        std::uniform_real_distribution<double> m_unit{0.0, 1.0};
+
+        double m_now = 0.0;
+        std::uint64_t m_nextOrder = 0;
+        SocketId m_nextSocketId = 1;
+        std::uint16_t m_nextEphemeralPort = FIRST_EPHEMERAL_PORT;
+        Stats m_stats;
+        mutable SocketError m_lastError = SocketError::None;
+        mutable std::mutex m_mutex;
+    };
+
+}
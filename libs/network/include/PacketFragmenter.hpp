@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** PacketFragmenter - splits large game packets into FRAGMENTs and reassembles them
+*/
+
+#pragma once
+
+#include "Protocol.hpp"
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace network {
+
+    class PacketFragmenter {
+    public:
+        // Returns the packet unchanged when it already fits in maxDatagramSize,
+        // otherwise one FRAGMENT datagram per chunk (at most 255 fragments).
+        static std::vector<std::vector<uint8_t>> Split(const std::vector<uint8_t>& packet, uint16_t messageId,
+            size_t maxDatagramSize = MAX_UDP_DATAGRAM_SIZE);
+    };
+
+    struct FragmentStats {
+        uint64_t fragmentsReceived = 0;
+        uint64_t packetsReassembled = 0;
+        uint64_t invalidFragments = 0;
+        uint64_t timedOutPackets = 0;   // Partials dropped because a fragment never arrived
+        uint64_t stalePackets = 0;      // Partials dropped because a newer packet completed first
+    };
+
+    class FragmentReassembler {
+    public:
+        struct Config {
+            double timeout = 0.25;          // Seconds a partial packet may wait for its missing fragments
+            size_t maxPendingPackets = 8;
+            bool dropStalePartials = true;  // Snapshots are superseded: discard anything older than the last completed one
+        };
+
+        FragmentReassembler() = default;
+        explicit FragmentReassembler(const Config& config) : m_config(config) {}
+
+        // Feeds one FRAGMENT datagram; returns the original packet once all its pieces arrived.
+        // now is a monotonic clock in seconds.
+        std::optional<std::vector<uint8_t>> AddFragment(const std::vector<uint8_t>& datagram, double now);
+
+        // Drops partial packets older than the configured timeout.
+        void Expire(double now);
+        void Clear();
+
+        size_t GetPendingCount() const { return m_pending.size(); }
+        const FragmentStats& GetStats() const { return m_stats; }
+    private:
+        struct PartialPacket {
+            std::vector<uint8_t> data;
+            std::vector<bool> received;
+            uint8_t fragmentCount = 0;
+            uint8_t receivedCount = 0;
+            double firstSeen = 0.0;
+        };
+
+        // Sequence comparison that survives messageId wraparound
+        static bool IsNewer(uint16_t a, uint16_t b) { return static_cast<int16_t>(a - b) > 0; }
+
+        void DropOlderThan(uint16_t messageId);
+
+        Config m_config;
+        std::map<uint16_t, PartialPacket> m_pending;
+        bool m_hasCompleted = false;
+        uint16_t m_lastCompletedId = 0;
+        FragmentStats m_stats;
+    };
+
+}
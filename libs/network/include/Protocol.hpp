@@ -16,6 +16,7 @@ constexpr size_t ROOM_NAME_SIZE = 32;
 constexpr size_t MAX_PLAYERS = 4;
 constexpr size_t MAX_ROOMS = 16;
 constexpr size_t MAX_ENTITIES = 256;
+constexpr size_t MAX_UDP_DATAGRAM_SIZE = 1200; // Game packets larger than this are sent as FRAGMENTs
 
 namespace network {
 
@@ -56,6 +57,7 @@ namespace network {
         LEVEL_COMPLETE = 0x07, // Server → Client: Level completed (boss defeated)
         STATE_DELTA = 0x08,    // Server → Client: Delta state snapshot (optimized)
         STATE_ACK = 0x09,      // Client → Server: Acknowledge received state sequence
+        FRAGMENT = 0x0A,       // Server → Client: Piece of a game packet larger than MAX_UDP_DATAGRAM_SIZE
     };
 
     // Input flags bitfield
@@ -181,7 +183,7 @@ namespace network {
         uint32_t tick = 0;         // Server tick number
         uint32_t timestamp = 0;    // Server timestamp (ms)
         uint16_t entityCount = 0;  // Number of entities following
-        float scrollOffset = 0.0f; // Background scroll offset
+        float scrollOffset = 0.0f; // Level scroll offset, added to OBSTACLE x (level space)
         uint8_t inputAckCount = 0;
         uint32_t stateSequence = 0; // Sequence number for delta tracking
     };
@@ -214,9 +216,9 @@ namespace network {
         uint16_t deltaEntityCount = 0;  // Number of changed entities
         uint16_t destroyedCount = 0;    // Number of destroyed entity IDs
         uint16_t newEntityCount = 0;    // Number of new full entities
-        float scrollOffset = 0.0f;      // Background scroll offset
+        float scrollOffset = 0.0f;      // Level scroll offset, added to OBSTACLE x (level space)
         uint8_t inputAckCount = 0;
-        uint8_t compressionFlags = 0;   // 0 = none, 1 = LZ4
+        uint8_t compressionFlags = 0;   // CompressionFlags
         uint32_t uncompressedSize = 0;  // Original size before compression (0 if not compressed)
     };
 
@@ -231,6 +233,19 @@ namespace network {
     enum CompressionFlags : uint8_t {
         COMPRESSION_NONE = 0x00,
         COMPRESSION_LZ4 = 0x01,
+        COMPRESSION_LZ4_HISTORY = 0x02,  // LZ4 with the payload of baseSequence as dictionary
+        COMPRESSION_ZSTD_DICT = 0x03,    // zstd with a dictionary trained from recorded traffic
+    };
+
+    // FRAGMENT packet header, followed by fragmentSize bytes of the original packet
+    struct FragmentHeader {
+        uint8_t type = static_cast<uint8_t>(GamePacket::FRAGMENT);
+        uint16_t messageId = 0;      // Same for every fragment of one packet, wraps around
+        uint8_t fragmentIndex = 0;
+        uint8_t fragmentCount = 0;
+        uint16_t fragmentSize = 0;   // Payload bytes in this fragment
+        uint32_t offset = 0;         // Position of this payload in the reassembled packet
+        uint32_t totalSize = 0;      // Size of the reassembled packet
     };
 
     // PING packet
@@ -0,0 +1,178 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** ReplicationSchema - declarative description of the replicated entity fields
+*/
+
+#pragma once
+
+#include "Protocol.hpp"
+#include "SnapshotBudget.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace network {
+
+    namespace Replication {
+
+        template <typename T>
+        struct MemberTraits;
+
+        template <typename Class, typename Value>
+        struct MemberTraits<Value Class::*> {
+            using Type = Value;
+        };
+
+        // One EntityState field and its wire encoding. A float sent as an integer
+        // type is quantized to 1/Scale units and clamped to the integer range.
+        template <auto Member, typename Wire = typename MemberTraits<decltype(Member)>::Type, int Scale = 1>
+        struct Field {
+            using Value = typename MemberTraits<decltype(Member)>::Type;
+            static constexpr size_t WIRE_SIZE = sizeof(Wire);
+            static constexpr bool QUANTIZED = std::is_floating_point_v<Value> && std::is_integral_v<Wire>;
+
+            static Wire Encode(Value value) {
+                if constexpr (QUANTIZED) {
+                    const long scaled = std::lround(value * static_cast<Value>(Scale));
+                    const long low = static_cast<long>(std::numeric_limits<Wire>::min());
+                    const long high = static_cast<long>(std::numeric_limits<Wire>::max());
+                    return static_cast<Wire>(std::min(high, std::max(low, scaled)));
+                } else {
+                    return static_cast<Wire>(value);
+                }
+            }
+
+            static Value Decode(Wire wire) {
+                if constexpr (QUANTIZED) {
+                    return static_cast<Value>(wire) / static_cast<Value>(Scale);
+                } else {
+                    return static_cast<Value>(wire);
+                }
+            }
+
+            // The value as the client will see it after a round trip
+            static Value Quantize(Value value) { return Decode(Encode(value)); }
+
+            static float Distance(const EntityState& a, const EntityState& b) {
+                return std::abs(static_cast<float>(a.*Member) - static_cast<float>(b.*Member));
+            }
+            static bool Differs(const EntityState& known, const EntityState& current) {
+                return Quantize(current.*Member) != known.*Member;
+            }
+
+            static void Write(std::vector<uint8_t>& out, const EntityState& state) {
+                const Wire wire = Encode(state.*Member);
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&wire);
+                out.insert(out.end(), bytes, bytes + sizeof(Wire));
+            }
+            static void Read(const uint8_t* data, size_t& offset, EntityState& state) {
+                Wire wire;
+                std::memcpy(&wire, data + offset, sizeof(Wire));
+                offset += sizeof(Wire);
+                state.*Member = Decode(wire);
+            }
+            static void Copy(EntityState& to, const EntityState& from) { to.*Member = Quantize(from.*Member); }
+            static void Keep(EntityState& to, const EntityState& from) { to.*Member = from.*Member; }
+        };
+
+        // Delta policies: when is a field group worth sending again
+        struct OnChange {
+            template <typename FieldT>
+            static bool Changed(const EntityState& known, const EntityState& current, const SnapshotBudgetConfig&) {
+                return FieldT::Differs(known, current);
+            }
+        };
+
+        // Continuous values are resent once they drift past a configured threshold
+        template <float SnapshotBudgetConfig::*Threshold>
+        struct Drift {
+            template <typename FieldT>
+            static bool Changed(const EntityState& known, const EntityState& current, const SnapshotBudgetConfig& config) {
+                return FieldT::Distance(known, current) > config.*Threshold;
+            }
+        };
+
+        // Fields sharing one DeltaFlags bit. Priority scales how fast a pending
+        // change of the group climbs the per-client send queue.
+        template <uint8_t Flag, uint8_t Priority, typename Policy, typename... Fields>
+        struct FieldGroup {
+            static constexpr uint8_t FLAG = Flag;
+            static constexpr uint8_t PRIORITY = Priority;
+            static constexpr size_t WIRE_SIZE = (Fields::WIRE_SIZE + ...);
+
+            static bool Changed(const EntityState& known, const EntityState& current, const SnapshotBudgetConfig& config) {
+                return (Policy::template Changed<Fields>(known, current, config) || ...);
+            }
+            static void Write(std::vector<uint8_t>& out, const EntityState& state) { (Fields::Write(out, state), ...); }
+            static void Read(const uint8_t* data, size_t& offset, EntityState& state) { (Fields::Read(data, offset, state), ...); }
+            static void Copy(EntityState& to, const EntityState& from) { (Fields::Copy(to, from), ...); }
+            static void Keep(EntityState& to, const EntityState& from) { (Fields::Keep(to, from), ...); }
+        };
+
+        // Serializers generated from a list of field groups. Groups are written in
+        // declaration order, which is the wire order of a delta's field data.
+        template <typename... Groups>
+        struct Schema {
+            static constexpr uint8_t ALL_FIELDS = (Groups::FLAG | ...);
+
+            static uint8_t ComputeDeltaFlags(const EntityState& known, const EntityState& current, const SnapshotBudgetConfig& config) {
+                uint8_t deltaFlags = 0;
+                ((deltaFlags |= Groups::Changed(known, current, config) ? Groups::FLAG : 0), ...);
+                return deltaFlags;
+            }
+
+            static size_t GetFieldsSize(uint8_t deltaFlags) {
+                return ((deltaFlags & Groups::FLAG ? Groups::WIRE_SIZE : 0) + ...);
+            }
+
+            static void Write(std::vector<uint8_t>& out, const EntityState& state, uint8_t deltaFlags) {
+                ((deltaFlags & Groups::FLAG ? Groups::Write(out, state) : void()), ...);
+            }
+
+            static void Read(const uint8_t* data, size_t& offset, uint8_t deltaFlags, EntityState& state) {
+                ((deltaFlags & Groups::FLAG ? Groups::Read(data, offset, state) : void()), ...);
+            }
+
+            // Client-side view after a delta: sent groups take their quantized new value,
+            // the others keep what the client already had
+            static EntityState Apply(const EntityState& known, const EntityState& current, uint8_t deltaFlags) {
+                EntityState result = current;
+                ((deltaFlags & Groups::FLAG ? Groups::Copy(result, current) : Groups::Keep(result, known)), ...);
+                return result;
+            }
+
+            // Highest priority among the sent groups, 1 for a full entity
+            static float GetPriority(uint8_t deltaFlags) {
+                uint8_t priority = 1;
+                ((priority = deltaFlags & Groups::FLAG ? std::max(priority, Groups::PRIORITY) : priority), ...);
+                return static_cast<float>(priority);
+            }
+        };
+
+        template <auto Member, typename Wire = typename MemberTraits<decltype(Member)>::Type, int Scale = 1>
+        using F = Field<Member, Wire, Scale>;
+
+        // Everything a STATE_DELTA can carry about an entity. Velocities stay
+        // floats: as 16-bit quarter units they compressed worse under LZ4 history
+        // and cost more bytes per client. Flag changes (damage flash, exploding
+        // mines) jump ahead of routine movement when the budget is tight.
+        using EntitySchema = Schema<
+            FieldGroup<DELTA_POSITION, 1, Drift<&SnapshotBudgetConfig::positionThreshold>,
+                F<&EntityState::x>, F<&EntityState::y>>,
+            FieldGroup<DELTA_VELOCITY, 1, Drift<&SnapshotBudgetConfig::velocityThreshold>,
+                F<&EntityState::vx>, F<&EntityState::vy>>,
+            FieldGroup<DELTA_HEALTH, 1, OnChange, F<&EntityState::health>>,
+            FieldGroup<DELTA_FLAGS, 2, OnChange, F<&EntityState::flags>>,
+            FieldGroup<DELTA_SCORE, 1, OnChange, F<&EntityState::score>>,
+            FieldGroup<DELTA_POWERUP, 1, OnChange, F<&EntityState::powerUpFlags>, F<&EntityState::speedMultiplier>>,
+            FieldGroup<DELTA_WEAPON, 1, OnChange, F<&EntityState::weaponType>, F<&EntityState::fireRate>>>;
+
+    }
+
+}
@@ -34,6 +34,7 @@ namespace network {
             float countdownTimer = 5.0f;
             std::chrono::steady_clock::time_point lastUpdateTime;
             int lastBroadcastedSecond = -1;
+            uint32_t gameSeed = 0;  // Sent in GAME_START, seeds the room's simulation
         };
 
         RoomManager(Network::INetworkModule* network, uint16_t port, size_t maxRooms = MAX_ROOMS,
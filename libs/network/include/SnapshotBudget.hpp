@@ -0,0 +1,88 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotBudget - per-client snapshot priority and byte budget
+*/
+
+#pragma once
+
+#include "Protocol.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace network {
+
+    struct SnapshotBudgetConfig {
+        size_t maxPacketBytes = MAX_UDP_DATAGRAM_SIZE; // Keeps STATE/STATE_DELTA unfragmented
+        float relevanceRadius = 1500.0f;  // Distance from the client's ship where relevance reaches its floor
+        float minRelevance = 0.1f;
+        float positionThreshold = 0.5f;
+        float velocityThreshold = 1.0f;
+    };
+
+    struct SnapshotStats {
+        uint64_t packetsSent = 0;
+        uint64_t bytesSent = 0;
+        uint32_t lastPacketBytes = 0;
+        uint32_t maxPacketBytes = 0;
+        uint32_t deferredEntities = 0;     // Entities with pending changes left out of the last packet
+        uint64_t totalDeferred = 0;
+        uint32_t maxStarvationTicks = 0;   // Longest wait among entities still pending after the last packet
+        uint32_t peakStarvationTicks = 0;
+    };
+
+    // Priority accumulator of an entity whose changes have not reached the client yet
+    struct PendingEntity {
+        float priority = 0.0f;
+        uint32_t waitingTicks = 0;
+    };
+
+    // What the server believes a single client currently knows about the world
+    struct ClientSnapshotState {
+        std::unordered_map<uint32_t, EntityState> lastSent;
+        std::unordered_map<uint32_t, PendingEntity> pending;
+        std::unordered_map<uint32_t, uint32_t> pendingDestroyed; // id -> first sequence it was sent in
+        std::unordered_set<uint32_t> needsFullResend;
+        uint32_t lastResyncSeq = 0;
+        SnapshotStats stats;
+    };
+
+    // Entities picked for one STATE_DELTA, in send order
+    struct SnapshotSelection {
+        std::vector<EntityState> newEntities;
+        std::vector<std::pair<uint32_t, uint8_t>> deltaUpdates;  // id, DeltaFlags
+        std::vector<uint8_t> deltaData;                          // Field data of deltaUpdates, same order
+        uint32_t deferred = 0;
+        uint32_t maxStarvation = 0;
+    };
+
+    class SnapshotPrioritizer {
+    public:
+        static float GetBaseWeight(const EntityState& state);
+        static float GetRelevance(const EntityState& state, const EntityState* viewer, const SnapshotBudgetConfig& config);
+        // Weight of the most urgent field group in a delta (see ReplicationSchema)
+        static float GetChangePriority(uint8_t deltaFlags);
+
+        static uint8_t ComputeDeltaFlags(const EntityState& oldState, const EntityState& newState, const SnapshotBudgetConfig& config);
+        static size_t GetDeltaFieldsSize(uint8_t deltaFlags);
+        static void AppendDeltaFields(std::vector<uint8_t>& out, const EntityState& state, uint8_t deltaFlags);
+
+        // Diffs the changed, pending and resend entities against what the client last
+        // received, then takes them by accumulated priority while they fit in
+        // maxPacketBytes (usedBytes already spent). Entities left out stay pending and
+        // keep accumulating priority, so they win a later packet. Updates snapshot.
+        static SnapshotSelection SelectEntities(ClientSnapshotState& snapshot,
+            const std::unordered_map<uint32_t, EntityState>& currentStates, const std::unordered_set<uint32_t>& changedIds,
+            const EntityState* viewer, const SnapshotBudgetConfig& config, size_t usedBytes);
+
+        // Client-side view after a delta: fields below the change threshold keep their previous value,
+        // sent ones are quantized like the wire encoding
+        static EntityState ApplyDelta(const EntityState& oldState, const EntityState& newState, uint8_t deltaFlags);
+    };
+
+}
@@ -0,0 +1,97 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotBuffer - client-side snapshot history with adaptive playout delay
+*/
+
+#pragma once
+
+#include "Protocol.hpp"
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+
+namespace network {
+
+    // Keeps the last few server snapshots per entity (keyed by server tick) and
+    // renders remote entities slightly in the past, so that they can always be
+    // interpolated between two real samples instead of snapping on each packet.
+    // The playout delay adapts to the measured arrival jitter of snapshots.
+    class SnapshotBuffer {
+    public:
+        struct Config {
+            float tickRate = 60.0f;            // Server simulation rate (ticks per second)
+            float minPlayoutDelay = 1.0f / 60.0f;
+            float maxPlayoutDelay = 0.25f;
+            float jitterMultiplier = 2.5f;     // Delay = snapshot interval + multiplier * jitter
+            float delayAdaptRate = 2.0f;       // Fraction of the delay error corrected per second
+            float maxExtrapolation = 0.1f;     // Seconds we may extrapolate past the newest sample
+            float teleportDistance = 200.0f;   // Samples further apart than this are not blended
+        };
+
+        static constexpr size_t HISTORY_SIZE = 16;
+        static constexpr float INITIAL_PLAYOUT_DELAY = 2.0f / 60.0f;
+
+        SnapshotBuffer() = default;
+        explicit SnapshotBuffer(const Config& config) : m_config(config) {}
+
+        // Call once per received STATE/STATE_DELTA before pushing its entities.
+        // localTime is the client's monotonic clock in seconds.
+        void OnSnapshotReceived(uint32_t serverTick, double localTime);
+        void PushEntityState(uint32_t serverTick, const EntityState& state);
+
+        // Smooths the playout delay toward its jitter-based target.
+        void Update(float dt);
+
+        // Server time (in seconds) that should be displayed at the given local time.
+        double GetRenderTime(double localTime) const;
+
+        // Hermite interpolation between the two samples surrounding renderTime,
+        // capped extrapolation past the newest one. Returns false if unknown.
+        bool Sample(uint32_t entityId, double renderTime, float& outX, float& outY) const;
+
+        bool HasEntity(uint32_t entityId) const { return m_entities.find(entityId) != m_entities.end(); }
+        void RemoveEntity(uint32_t entityId) { m_entities.erase(entityId); }
+        // Forgets every entity and the measured clock, jitter and delay (reconnect, new level)
+        void Clear();
+
+        float GetJitter() const { return m_jitter; }
+        float GetPlayoutDelay() const { return m_playoutDelay; }
+        float GetTargetPlayoutDelay() const;
+        uint32_t GetLatestTick() const { return m_latestTick; }
+        uint64_t GetExtrapolatedSamples() const { return m_extrapolatedSamples; }
+    private:
+        struct HistorySample {
+            uint32_t tick = 0;
+            float x = 0.0f;
+            float y = 0.0f;
+            float vx = 0.0f;
+            float vy = 0.0f;
+        };
+
+        struct EntityHistory {
+            std::array<HistorySample, HISTORY_SIZE> samples;
+            size_t head = 0;  // Index of the newest sample
+            size_t count = 0;
+
+            const HistorySample& At(size_t age) const { return samples[(head + HISTORY_SIZE - age) % HISTORY_SIZE]; }
+        };
+
+        double TickToTime(uint32_t tick) const { return static_cast<double>(tick) / static_cast<double>(m_config.tickRate); }
+
+        Config m_config;
+        std::unordered_map<uint32_t, EntityHistory> m_entities;
+
+        bool m_hasClock = false;
+        double m_clockOffset = 0.0;      // localTime - serverTime for the least-delayed snapshot
+        double m_lastArrival = 0.0;
+        double m_lastServerTime = 0.0;
+        float m_jitter = 0.0f;
+        float m_snapshotInterval = 1.0f / 60.0f;
+        float m_playoutDelay = INITIAL_PLAYOUT_DELAY;
+        uint32_t m_latestTick = 0;
+        mutable uint64_t m_extrapolatedSamples = 0;
+    };
+
+}
@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotCodec - client-side STATE/STATE_DELTA decoder with reusable buffers
+*/
+
+#pragma once
+
+#include "Protocol.hpp"
+#include "SnapshotCompressor.hpp"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace network {
+
+    using EntityStateTable = std::unordered_map<uint32_t, EntityState>;
+
+    // Decodes snapshots straight into the caller's entity table. Decompression,
+    // input acks and the flattened entity list all live in buffers owned by the
+    // codec, so steady-state decoding does not allocate per packet.
+    class SnapshotCodec {
+    public:
+        SnapshotCodec();
+
+        void SetDictionary(const std::vector<uint8_t>& dictionary);
+
+        // Replaces the table with a full STATE snapshot. Returns false on malformed packets.
+        bool DecodeState(const uint8_t* packet, size_t size, EntityStateTable& entities);
+        // Applies a STATE_DELTA in place. Returns false if it could not be decompressed.
+        bool DecodeDelta(const uint8_t* packet, size_t size, EntityStateTable& entities);
+
+        // Input acks of the last decoded packet
+        const std::vector<InputAck>& GetInputAcks() const { return m_inputAcks; }
+        // DeltaFlags groups each entity received in the last decoded packet, every group for new entities
+        const std::unordered_map<uint32_t, uint8_t>& GetChangedFields() const { return m_changedFields; }
+        // Copy of the table as a list, rebuilt in a reused buffer
+        const std::vector<EntityState>& Flatten(const EntityStateTable& entities);
+    private:
+        ISnapshotCompressor* GetCompressor(uint8_t compressionFlag);
+        void ReadInputAcks(const uint8_t* data, size_t size, size_t& offset, uint8_t count);
+
+        std::unordered_map<uint8_t, std::unique_ptr<ISnapshotCompressor>> m_compressors;
+        std::vector<uint8_t> m_dictionary;
+        PayloadHistory m_receivedPayloads;
+
+        std::vector<uint8_t> m_decompressed;
+        std::vector<InputAck> m_inputAcks;
+        std::unordered_map<uint32_t, uint8_t> m_changedFields;
+        std::vector<EntityState> m_flattened;
+    };
+
+}
@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotCompressor - pluggable compressors for STATE_DELTA payloads
+*/
+
+#pragma once
+
+#include "Protocol.hpp"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace network {
+
+    // Previous payload both ends agree on, used as compression context.
+    // Null when no shared history is available (e.g. right after a full STATE).
+    struct CompressionHistory {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+    };
+
+    class ISnapshotCompressor {
+    public:
+        virtual ~ISnapshotCompressor() = default;
+
+        virtual CompressionFlags GetCompressionFlag() const = 0;
+        virtual const char* GetName() const = 0;
+        virtual size_t GetMinInputSize() const { return 0; }
+
+        // Both return false on failure; out is resized to the produced bytes.
+        virtual bool Compress(const uint8_t* data, size_t size, const CompressionHistory& history, std::vector<uint8_t>& out) = 0;
+        virtual bool Decompress(const uint8_t* data, size_t size, size_t originalSize, const CompressionHistory& history,
+            std::vector<uint8_t>& out) = 0;
+    };
+
+    // Independent LZ4 blocks (the historical wire format, COMPRESSION_LZ4)
+    class Lz4BlockCompressor : public ISnapshotCompressor {
+    public:
+        CompressionFlags GetCompressionFlag() const override { return COMPRESSION_LZ4; }
+        const char* GetName() const override { return "lz4"; }
+        size_t GetMinInputSize() const override { return 100; }
+
+        bool Compress(const uint8_t* data, size_t size, const CompressionHistory& history, std::vector<uint8_t>& out) override;
+        bool Decompress(const uint8_t* data, size_t size, size_t originalSize, const CompressionHistory& history,
+            std::vector<uint8_t>& out) override;
+    };
+
+    // LZ4 using the payload of the client's last acknowledged snapshot as dictionary.
+    // Consecutive snapshots share most of their bytes, so even tiny deltas shrink.
+    class Lz4HistoryCompressor : public ISnapshotCompressor {
+    public:
+        CompressionFlags GetCompressionFlag() const override { return COMPRESSION_LZ4_HISTORY; }
+        const char* GetName() const override { return "lz4-history"; }
+        size_t GetMinInputSize() const override { return 16; }
+
+        bool Compress(const uint8_t* data, size_t size, const CompressionHistory& history, std::vector<uint8_t>& out) override;
+        bool Decompress(const uint8_t* data, size_t size, size_t originalSize, const CompressionHistory& history,
+            std::vector<uint8_t>& out) override;
+    };
+
+#ifdef RTYPE_HAS_ZSTD
+    // zstd with a dictionary trained offline from recorded snapshot traffic
+    // (see r-type_dict_trainer). Both ends must load the same dictionary file.
+    class ZstdDictCompressor : public ISnapshotCompressor {
+    public:
+        explicit ZstdDictCompressor(const std::vector<uint8_t>& dictionary, int level = 3);
+        ~ZstdDictCompressor() override;
+
+        ZstdDictCompressor(const ZstdDictCompressor&) = delete;
+        ZstdDictCompressor& operator=(const ZstdDictCompressor&) = delete;
+
+        CompressionFlags GetCompressionFlag() const override { return COMPRESSION_ZSTD_DICT; }
+        const char* GetName() const override { return "zstd-dict"; }
+        size_t GetMinInputSize() const override { return 16; }
+
+        bool Compress(const uint8_t* data, size_t size, const CompressionHistory& history, std::vector<uint8_t>& out) override;
+        bool Decompress(const uint8_t* data, size_t size, size_t originalSize, const CompressionHistory& history,
+            std::vector<uint8_t>& out) override;
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+#endif
+
+    // Returns nullptr for COMPRESSION_NONE, unknown flags, or zstd without a dictionary/support.
+    std::unique_ptr<ISnapshotCompressor> CreateSnapshotCompressor(CompressionFlags flag,
+        const std::vector<uint8_t>& dictionary = {});
+
+    // Uncompressed STATE_DELTA payloads indexed by state sequence, kept identically
+    // by the server (per client) and the client to resolve CompressionHistory.
+    class PayloadHistory {
+    public:
+        static constexpr size_t HISTORY_SIZE = 32;
+
+        void Store(uint32_t sequence, const uint8_t* data, size_t size);
+        CompressionHistory Find(uint32_t sequence) const;
+        void Clear();
+    private:
+        struct Entry {
+            uint32_t sequence = 0;
+            bool valid = false;
+            std::vector<uint8_t> payload;
+        };
+        std::array<Entry, HISTORY_SIZE> m_entries;
+    };
+
+    // Recorded snapshot traffic: a flat file of [uint32 size][payload] records,
+    // used to train zstd dictionaries and to benchmark compressors offline.
+    class SnapshotTrafficRecorder {
+    public:
+        bool Open(const std::string& path);
+        bool IsOpen() const { return m_file.is_open(); }
+        void Record(const uint8_t* data, size_t size);
+
+        static bool Load(const std::string& path, std::vector<std::vector<uint8_t>>& samples);
+    private:
+        std::ofstream m_file;
+    };
+
+    bool LoadBinaryFile(const std::string& path, std::vector<uint8_t>& data);
+
+}
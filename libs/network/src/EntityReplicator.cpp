@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** EntityReplicator implementation
+*/
+
+#include "EntityReplicator.hpp"
+#include "ECS/Component.hpp"
+#include <iostream>
+#include <array>
+
+namespace network {
+
+    uint32_t EntityReplicator::GetNetworkId(RType::ECS::Entity entity) const
+    {
+        auto it = m_entities.find(entity);
+        return it != m_entities.end() ? it->second.networkId : 0;
+    }
+
+    uint32_t EntityReplicator::GetOrAssignNetworkId(RType::ECS::Registry& registry, RType::ECS::Entity entity)
+    {
+        if (registry.HasComponent<RType::ECS::NetworkId>(entity)) {
+            return registry.GetComponent<RType::ECS::NetworkId>(entity).id;
+        }
+        const uint32_t id = m_nextNetworkId++;
+        registry.AddComponent<RType::ECS::NetworkId>(entity, RType::ECS::NetworkId{id});
+        return id;
+    }
+
+    void EntityReplicator::RegisterNetworkType(uint32_t netId, EntityType type)
+    {
+        auto it = m_networkIdTypes.find(netId);
+        if (it == m_networkIdTypes.end()) {
+            m_networkIdTypes.emplace(netId, type);
+            return;
+        }
+        if (it->second != type) {
+            std::cerr << "[NETID COLLISION] NetworkId " << netId
+                      << " was " << static_cast<int>(it->second)
+                      << " now " << static_cast<int>(type)
+                      << " -- this indicates ID reuse/type confusion" << std::endl;
+            it->second = type;
+        }
+    }
+
+    void EntityReplicator::Update(RType::ECS::Registry& registry)
+    {
+        m_build++;
+        m_changedIds.clear();
+
+        // Reads go through a const view so they do not stamp components as changed
+        const RType::ECS::Registry& view = registry;
+        size_t replicated = 0;
+        std::array<size_t, 256> countByType{};  // Caps are per wire type, whichever kind fills them
+
+        for (const auto& kind : m_types) {
+            size_t& count = countByType[static_cast<uint8_t>(kind.type)];
+            for (auto entity : view.GetEntitiesWithSignature(kind.required)) {
+                if (kind.maxEntities != 0 && count >= kind.maxEntities) {
+                    break;
+                }
+                if ((view.GetSignature(entity) & kind.excluded).any()) {
+                    continue;
+                }
+                auto known = m_entities.find(entity);
+                if (known != m_entities.end()) {
+                    if (known->second.build == m_build) {
+                        continue;  // Claimed by an earlier kind
+                    }
+                    if (kind.inputs.any() && !view.AnyChangedSince(entity, kind.inputs, m_replicatedTick)) {
+                        known->second.build = m_build;
+                        replicated++;
+                        count++;
+                        continue;
+                    }
+                }
+
+                EntityState state;
+                kind.build(view, entity, state);
+                if (state.health == 0) {
+                    continue;  // Dead: dropped below like a destroyed entity
+                }
+                state.entityId = GetOrAssignNetworkId(registry, entity);
+                state.entityType = static_cast<uint8_t>(kind.type);
+                RegisterNetworkType(state.entityId, kind.type);
+                if (known != m_entities.end() && known->second.networkId != state.entityId) {
+                    m_states.erase(known->second.networkId);  // Recycled entity id
+                }
+
+                m_entities[entity] = {state.entityId, m_build};
+                m_states[state.entityId] = state;
+                m_changedIds.insert(state.entityId);
+                replicated++;
+                count++;
+            }
+        }
+
+        // Entities seen last build but not this one (destroyed, dead or past their
+        // type's cap) are gone from the snapshots. Erasing them here, rather than
+        // keeping them aside, means one coming back is rebuilt, never reused stale.
+        if (replicated != m_entities.size()) {
+            for (auto it = m_entities.begin(); it != m_entities.end();) {
+                if (it->second.build != m_build) {
+                    m_states.erase(it->second.networkId);
+                    it = m_entities.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+
+        // Anything modified from here on is newer than this build
+        m_replicatedTick = registry.GetChangeTick();
+        registry.AdvanceChangeTick();
+    }
+
+}
@@ -6,7 +6,6 @@
 */
 
 #include "GameClient.hpp"
-#include "Compression.hpp"
 #include <iostream>
 #include <cstring>
 #include <random>
@@ -21,7 +20,11 @@ namespace network {
         m_udpSocket = m_network->CreateUdpSocket();
         m_network->BindUdp(m_udpSocket, 0);
 
+        m_entityStates.reserve(MAX_ENTITIES);
         m_inputGenerator = [this]() { return GenerateRandomInputs(); };
+        m_clock = []() {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        };
     }
 
     GameClient::~GameClient() {
@@ -35,15 +38,7 @@ namespace network {
     bool GameClient::ConnectToServer() {
         std::cout << "[Client " << m_localPlayer.name << "] Connecting to " << m_serverEndpoint.address << ":" << m_serverEndpoint.port << std::endl;
 
-        HelloPacket hello;
-        hello.playerHash = m_localPlayer.hash;
-        std::strncpy(hello.playerName, m_localPlayer.name, PLAYER_NAME_SIZE - 1);
-
-        std::vector<uint8_t> packet(sizeof(HelloPacket));
-        std::memcpy(packet.data(), &hello, sizeof(HelloPacket));
-
-        m_network->SendUdp(m_udpSocket, packet, m_serverEndpoint);
-        m_packetsSent++;
+        SendHello();
 
         auto startTime = std::chrono::steady_clock::now();
         const float TIMEOUT = 5.0f;
@@ -65,6 +60,43 @@ namespace network {
         return true;
     }
 
+    void GameClient::SendHello() {
+        HelloPacket hello;
+        hello.playerHash = m_localPlayer.hash;
+        std::strncpy(hello.playerName, m_localPlayer.name, PLAYER_NAME_SIZE - 1);
+
+        std::vector<uint8_t> packet(sizeof(HelloPacket));
+        std::memcpy(packet.data(), &hello, sizeof(HelloPacket));
+        Send(packet);
+    }
+
+    void GameClient::UpdateHeadless() {
+        ReceivePackets();
+
+        // The margin keeps one input per frame when the clock is stepped by exactly 1/60 s
+        const double INPUT_RATE = 1.0 / 60.0 - 1e-6;
+        double now = m_clock();
+        if (m_lastInputTime < 0.0 || now - m_lastInputTime >= INPUT_RATE) {
+            SendInput(m_inputGenerator());
+            m_lastInputTime = now;
+        }
+    }
+
+    void GameClient::SendPing() {
+        PingPacket ping;
+        ping.timestamp = GetTimeMs();
+
+        std::vector<uint8_t> packet(sizeof(PingPacket));
+        std::memcpy(packet.data(), &ping, sizeof(PingPacket));
+        Send(packet);
+    }
+
+    void GameClient::Send(const std::vector<uint8_t>& packet) {
+        m_network->SendUdp(m_udpSocket, packet, m_serverEndpoint);
+        m_packetsSent++;
+        m_bytesSent += packet.size();
+    }
+
     void GameClient::RunHeadless(float duration) {
         if (!m_connected) {
             std::cerr << "[Client " << m_localPlayer.name << "] Not connected!" << std::endl;
@@ -73,9 +105,7 @@ namespace network {
 
         m_running = true;
 
-        const float INPUT_RATE = 1.0f / 60.0f;
         auto startTime = std::chrono::steady_clock::now();
-        auto lastInputTime = std::chrono::steady_clock::now();
 
         std::cout << "[Client " << m_localPlayer.name << "] Running headless for " << duration << " seconds..." << std::endl;
 
@@ -87,14 +117,7 @@ namespace network {
                 break;
             }
 
-            ReceivePackets();
-
-            float inputElapsed = std::chrono::duration<float>(now - lastInputTime).count();
-            if (inputElapsed >= INPUT_RATE) {
-                uint8_t inputs = m_inputGenerator();
-                SendInput(inputs);
-                lastInputTime = now;
-            }
+            UpdateHeadless();
 
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
         }
@@ -128,13 +151,11 @@ namespace network {
         input.sequence = m_inputSequence++;
         input.playerHash = m_localPlayer.hash;
         input.inputs = inputs;
-        input.timestamp = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        input.timestamp = GetTimeMs();
 
         std::vector<uint8_t> packet(sizeof(InputPacket));
         std::memcpy(packet.data(), &input, sizeof(InputPacket));
-
-        m_network->SendUdp(m_udpSocket, packet, m_serverEndpoint);
-        m_packetsSent++;
+        Send(packet);
     }
 
     void GameClient::ReceivePackets() {
@@ -145,12 +166,15 @@ namespace network {
                 break;
             }
             if (!packet->data.empty()) {
+                m_bytesReceived += packet->data.size();
                 HandlePacket(packet->data);
                 m_packetsReceived++;
                 packetsRead++;
             }
         }
 
+        m_reassembler.Expire(m_clock());
+
         static int frameCount = 0;
         if (packetsRead > 0 && frameCount++ % 60 == 0) {
             auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
@@ -180,11 +204,29 @@ namespace network {
         case GamePacket::LEVEL_COMPLETE:
             HandleLevelComplete(data);
             break;
+        case GamePacket::FRAGMENT:
+            HandleFragment(data);
+            break;
         default:
             break;
         }
     }
 
+    void GameClient::HandleFragment(const std::vector<uint8_t>& data) {
+        auto packet = m_reassembler.AddFragment(data, m_clock());
+        if (!packet || packet->empty()) {
+            return;
+        }
+        if (static_cast<GamePacket>((*packet)[0]) == GamePacket::FRAGMENT) {
+            return;
+        }
+        HandlePacket(*packet);
+    }
+
+    void GameClient::SetCompressionDictionary(const std::vector<uint8_t>& dictionary) {
+        m_codec.SetDictionary(dictionary);
+    }
+
     void GameClient::HandleWelcome(const std::vector<uint8_t>& data) {
         if (data.size() < sizeof(WelcomePacket))
             return;
@@ -197,7 +239,7 @@ namespace network {
     }
 
     void GameClient::HandleState(const std::vector<uint8_t>& data) {
-        if (data.size() < sizeof(StatePacketHeader))
+        if (!m_codec.DecodeState(data.data(), data.size(), m_entityStates))
             return;
 
         const StatePacketHeader* header = reinterpret_cast<const StatePacketHeader*>(data.data());
@@ -205,46 +247,18 @@ namespace network {
         m_lastScrollOffset = header->scrollOffset;
         m_lastReceivedStateSeq = header->stateSequence;
 
-        size_t offset = sizeof(StatePacketHeader);
-
-        std::vector<InputAck> inputAcks;
-        for (uint8_t i = 0; i < header->inputAckCount; i++) {
-            if (offset + sizeof(InputAck) > data.size())
-                break;
-
-            InputAck ack;
-            std::memcpy(&ack, data.data() + offset, sizeof(InputAck));
-            inputAcks.push_back(ack);
-            offset += sizeof(InputAck);
-        }
-
-        std::vector<EntityState> entities;
-        m_entityStates.clear();
-
-        for (uint16_t i = 0; i < header->entityCount; i++) {
-            if (offset + sizeof(EntityState) > data.size())
-                break;
-
-            EntityState entity;
-            std::memcpy(&entity, data.data() + offset, sizeof(EntityState));
-            entities.push_back(entity);
-            m_entityStates[entity.entityId] = entity;
-
-            offset += sizeof(EntityState);
-        }
-
         if (m_lastReceivedStateSeq - m_lastAckedStateSeq >= STATE_ACK_INTERVAL) {
             SendStateAck(m_lastReceivedStateSeq);
             m_lastAckedStateSeq = m_lastReceivedStateSeq;
         }
 
         if (m_stateCallback) {
-            m_stateCallback(header->tick, entities, inputAcks);
+            m_stateCallback(header->tick, m_codec.Flatten(m_entityStates), m_codec.GetInputAcks());
         }
     }
 
     void GameClient::HandleStateDelta(const std::vector<uint8_t>& data) {
-        if (data.size() < sizeof(StateDeltaHeader))
+        if (!m_codec.DecodeDelta(data.data(), data.size(), m_entityStates))
             return;
 
         const StateDeltaHeader* header = reinterpret_cast<const StateDeltaHeader*>(data.data());
@@ -252,145 +266,22 @@ namespace network {
         m_lastScrollOffset = header->scrollOffset;
         m_lastReceivedStateSeq = header->stateSequence;
 
-        const uint8_t* payloadData = data.data() + sizeof(StateDeltaHeader);
-        size_t payloadSize = data.size() - sizeof(StateDeltaHeader);
-
-        std::vector<uint8_t> decompressedPayload;
-        if (header->compressionFlags == CompressionFlags::COMPRESSION_LZ4) {
-            if (header->uncompressedSize == 0) {
-                return;
-            }
-            decompressedPayload = Compression::DecompressLZ4(payloadData, payloadSize, header->uncompressedSize);
-            if (decompressedPayload.empty()) {
-                std::cerr << "[CLIENT] LZ4 decompression failed!" << std::endl;
-                return;
-            }
-            payloadData = decompressedPayload.data();
-            payloadSize = decompressedPayload.size();
-        }
-
-        size_t offset = 0;
-
-        std::vector<InputAck> inputAcks;
-        for (uint8_t i = 0; i < header->inputAckCount; i++) {
-            if (offset + sizeof(InputAck) > payloadSize)
-                break;
-
-            InputAck ack;
-            std::memcpy(&ack, payloadData + offset, sizeof(InputAck));
-            inputAcks.push_back(ack);
-            offset += sizeof(InputAck);
-        }
-
-        for (uint16_t i = 0; i < header->destroyedCount; i++) {
-            if (offset + sizeof(uint32_t) > payloadSize)
-                break;
-
-            uint32_t destroyedId;
-            std::memcpy(&destroyedId, payloadData + offset, sizeof(uint32_t));
-            m_entityStates.erase(destroyedId);
-            offset += sizeof(uint32_t);
-        }
-
-        for (uint16_t i = 0; i < header->newEntityCount; i++) {
-            if (offset + sizeof(EntityState) > payloadSize)
-                break;
-
-            EntityState entity;
-            std::memcpy(&entity, payloadData + offset, sizeof(EntityState));
-            m_entityStates[entity.entityId] = entity;
-            offset += sizeof(EntityState);
-        }
-
-        std::vector<DeltaEntityHeader> deltaHeaders;
-        for (uint16_t i = 0; i < header->deltaEntityCount; i++) {
-            if (offset + sizeof(DeltaEntityHeader) > payloadSize)
-                break;
-
-            DeltaEntityHeader deh;
-            std::memcpy(&deh, payloadData + offset, sizeof(DeltaEntityHeader));
-            deltaHeaders.push_back(deh);
-            offset += sizeof(DeltaEntityHeader);
-        }
-
-        for (const auto& deh : deltaHeaders) {
-            auto it = m_entityStates.find(deh.entityId);
-            if (it == m_entityStates.end()) {
-                if (deh.deltaFlags & DeltaFlags::DELTA_POSITION) offset += sizeof(float) * 2;
-                if (deh.deltaFlags & DeltaFlags::DELTA_VELOCITY) offset += sizeof(float) * 2;
-                if (deh.deltaFlags & DeltaFlags::DELTA_HEALTH) offset += sizeof(uint16_t);
-                if (deh.deltaFlags & DeltaFlags::DELTA_FLAGS) offset += sizeof(uint8_t);
-                if (deh.deltaFlags & DeltaFlags::DELTA_SCORE) offset += sizeof(uint32_t);
-                if (deh.deltaFlags & DeltaFlags::DELTA_POWERUP) offset += sizeof(uint8_t) * 2;
-                if (deh.deltaFlags & DeltaFlags::DELTA_WEAPON) offset += sizeof(uint8_t) * 2;
-                continue;
-            }
-
-            EntityState& state = it->second;
-
-            if (deh.deltaFlags & DeltaFlags::DELTA_POSITION) {
-                if (offset + sizeof(float) * 2 <= payloadSize) {
-                    std::memcpy(&state.x, payloadData + offset, sizeof(float));
-                    offset += sizeof(float);
-                    std::memcpy(&state.y, payloadData + offset, sizeof(float));
-                    offset += sizeof(float);
-                }
-            }
-            if (deh.deltaFlags & DeltaFlags::DELTA_VELOCITY) {
-                if (offset + sizeof(float) * 2 <= payloadSize) {
-                    std::memcpy(&state.vx, payloadData + offset, sizeof(float));
-                    offset += sizeof(float);
-                    std::memcpy(&state.vy, payloadData + offset, sizeof(float));
-                    offset += sizeof(float);
-                }
-            }
-            if (deh.deltaFlags & DeltaFlags::DELTA_HEALTH) {
-                if (offset + sizeof(uint16_t) <= payloadSize) {
-                    std::memcpy(&state.health, payloadData + offset, sizeof(uint16_t));
-                    offset += sizeof(uint16_t);
-                }
-            }
-            if (deh.deltaFlags & DeltaFlags::DELTA_FLAGS) {
-                if (offset + sizeof(uint8_t) <= payloadSize) {
-                    state.flags = payloadData[offset++];
-                }
-            }
-            if (deh.deltaFlags & DeltaFlags::DELTA_SCORE) {
-                if (offset + sizeof(uint32_t) <= payloadSize) {
-                    std::memcpy(&state.score, payloadData + offset, sizeof(uint32_t));
-                    offset += sizeof(uint32_t);
-                }
-            }
-            if (deh.deltaFlags & DeltaFlags::DELTA_POWERUP) {
-                if (offset + sizeof(uint8_t) * 2 <= payloadSize) {
-                    state.powerUpFlags = payloadData[offset++];
-                    state.speedMultiplier = payloadData[offset++];
-                }
-            }
-            if (deh.deltaFlags & DeltaFlags::DELTA_WEAPON) {
-                if (offset + sizeof(uint8_t) * 2 <= payloadSize) {
-                    state.weaponType = payloadData[offset++];
-                    state.fireRate = payloadData[offset++];
-                }
-            }
-        }
-
         if (m_lastReceivedStateSeq - m_lastAckedStateSeq >= STATE_ACK_INTERVAL) {
             SendStateAck(m_lastReceivedStateSeq);
             m_lastAckedStateSeq = m_lastReceivedStateSeq;
         }
 
-        std::vector<EntityState> entities;
-        entities.reserve(m_entityStates.size());
-        for (const auto& [id, state] : m_entityStates) {
-            entities.push_back(state);
-        }
-
         if (m_stateCallback) {
-            m_stateCallback(header->tick, entities, inputAcks);
+            m_stateCallback(header->tick, m_codec.Flatten(m_entityStates), m_codec.GetInputAcks());
         }
     }
 
+    uint8_t GameClient::GetChangedFields(uint32_t entityId) const {
+        const auto& changed = m_codec.GetChangedFields();
+        auto it = changed.find(entityId);
+        return it != changed.end() ? it->second : 0;
+    }
+
     void GameClient::SendStateAck(uint32_t stateSequence) {
         StateAckPacket ack;
         ack.playerHash = m_localPlayer.hash;
@@ -398,9 +289,7 @@ namespace network {
 
         std::vector<uint8_t> packet(sizeof(StateAckPacket));
         std::memcpy(packet.data(), &ack, sizeof(StateAckPacket));
-
-        m_network->SendUdp(m_udpSocket, packet, m_serverEndpoint);
-        m_packetsSent++;
+        Send(packet);
     }
 
     void GameClient::HandlePong(const std::vector<uint8_t>& data) {
@@ -409,10 +298,12 @@ namespace network {
 
         const PongPacket* pong = reinterpret_cast<const PongPacket*>(data.data());
 
-        uint32_t now = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+        uint32_t rtt = GetTimeMs() - pong->timestamp;
+        m_lastRtt = static_cast<float>(rtt);
 
-        uint32_t rtt = now - pong->timestamp;
-        (void)rtt;
+        if (m_pongCallback) {
+            m_pongCallback(m_lastRtt);
+        }
     }
 
     void GameClient::HandleLevelComplete(const std::vector<uint8_t>& data) {
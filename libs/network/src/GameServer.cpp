@@ -7,6 +7,7 @@
 
 #include "GameServer.hpp"
 #include "Compression.hpp"
+#include "ComponentReplication.hpp"
 #include "ECS/BossSystem.hpp"
 #include "ECS/MineSystem.hpp"
 #include <nlohmann/json.hpp>
@@ -15,72 +16,20 @@
 #include <fstream>
 #include <cstring>
 #include <algorithm>
-#include <random>
 #include <cmath>
+#include <unordered_set>
 
 using json = nlohmann::json;
 
 namespace network {
 
-    uint32_t GameServer::GetOrAssignNetworkId(RType::ECS::Entity entity)
-    {
-        if (m_registry.HasComponent<RType::ECS::NetworkId>(entity)) {
-            return m_registry.GetComponent<RType::ECS::NetworkId>(entity).id;
-        }
-        const uint32_t id = m_nextNetworkId++;
-        m_registry.AddComponent<RType::ECS::NetworkId>(entity, RType::ECS::NetworkId{id});
-        return id;
-    }
-
-    void GameServer::RegisterNetworkType(uint32_t netId, EntityType type)
-    {
-        auto it = m_networkIdTypes.find(netId);
-        if (it == m_networkIdTypes.end()) {
-            m_networkIdTypes.emplace(netId, type);
-            return;
-        }
-        if (it->second != type) {
-            std::cerr << "[NETID COLLISION] NetworkId " << netId
-                      << " was " << static_cast<int>(it->second)
-                      << " now " << static_cast<int>(type)
-                      << " -- this indicates ID reuse/type confusion" << std::endl;
-            it->second = type;
-        }
-    }
-
-    namespace {
-        void BasicMovementPattern(GameEntity& enemy, float /*dt*/) {
-            enemy.vx = -220.0f;
-            enemy.vy = 0.0f;
-        }
-
-        void FastMovementPattern(GameEntity& enemy, float /*dt*/) {
-            enemy.vx = -200.0f;
-            enemy.vy = std::sin(enemy.x * 0.01f) * 50.0f;
-        }
-
-        void TankMovementPattern(GameEntity& enemy, float /*dt*/) {
-            enemy.vx = -220.0f;
-            enemy.vy = 0.0f;
-        }
-
-        void BossMovementPattern(GameEntity& enemy, float /*dt*/) {
-            enemy.vx = -75.0f;
-            enemy.vy = 0.0f;
-        }
-
-        void FormationMovementPattern(GameEntity& enemy, float /*dt*/) {
-            enemy.vx = -100.0f;
-            enemy.vy = 0.0f;
-        }
-    }
-
-    const std::array<EnemyStats, 5> GameServer::s_enemyStats = {{{220.0f, 100, 8, 1.0f, -50.0f, 25.0f, 25, BasicMovementPattern}, {200.0f, 50, 3, 0.5f, -50.0f, 20.0f, 20, FastMovementPattern}, {220.0f, 200, 18, 1.8f, -30.0f, -20.0f, 30, TankMovementPattern}, {75.0f, 255, 50, 0.5f, -30.0f, 45.0f, 50, BossMovementPattern}, {100.0f, 100, 10, 1.5f, -30.0f, 45.0f, 25, FormationMovementPattern}}};
+    // Enemy movement itself is driven by EnemySystem::ApplyMovementPattern
+    const std::array<EnemyStats, 5> GameServer::s_enemyStats = {{{220.0f, 100, 8, 1.0f, -50.0f, 25.0f, 25}, {200.0f, 50, 3, 0.5f, -50.0f, 20.0f, 20}, {220.0f, 200, 18, 1.8f, -30.0f, -20.0f, 30}, {75.0f, 255, 50, 0.5f, -30.0f, 45.0f, 50}, {100.0f, 100, 10, 1.5f, -30.0f, 45.0f, 25}}};
 
     GameServer::GameServer(Network::INetworkModule* network, uint16_t port,
         const std::vector<PlayerInfo>& expectedPlayers, const std::string& levelPath)
         : m_network(network), m_expectedPlayers(expectedPlayers),
-          m_lastSpawnTime(std::chrono::steady_clock::now()), m_levelPath(levelPath) {
+          m_levelPath(levelPath) {
 
         m_udpSocket = m_network->CreateUdpSocket();
         m_network->BindUdp(m_udpSocket, port);
@@ -88,6 +37,7 @@ namespace network {
         m_scrollingSystem = std::make_unique<RType::ECS::ScrollingSystem>();
         m_bossSystem = std::make_unique<RType::ECS::BossSystem>();
         m_bossAttackSystem = std::make_unique<RType::ECS::BossAttackSystem>();
+        m_bossAttackSystem->SetRng(&m_rng);
         m_mineSystem = std::make_unique<RType::ECS::MineSystem>();
         m_blackOrbSystem = std::make_unique<RType::ECS::BlackOrbSystem>();
         m_thirdBulletSystem = std::make_unique<RType::ECS::ThirdBulletSystem>();
@@ -104,6 +54,7 @@ namespace network {
             720.0f
         );
         m_powerUpSpawnSystem->SetSpawnInterval(5.0f);
+        m_powerUpSpawnSystem->SetRng(&m_rng);
         m_powerUpCollisionSystem = std::make_unique<RType::ECS::PowerUpCollisionSystem>(nullptr);
 
         m_shootingSystem = std::make_unique<RType::ECS::ShootingSystem>(0);
@@ -111,6 +62,8 @@ namespace network {
         m_forcePodSystem = std::make_unique<RType::ECS::ForcePodSystem>();
         m_shieldSystem = std::make_unique<RType::ECS::ShieldSystem>();
 
+        RegisterReplicatedTypes();
+
         std::cout << "GameServer started on UDP port " << port << std::endl;
         std::cout << "ECS collision systems initialized" << std::endl;
         std::cout << "Waiting for " << expectedPlayers.size() << " players..." << std::endl;
@@ -125,9 +78,54 @@ namespace network {
     }
 
     void GameServer::Run() {
+        Start();
+
+        while (m_running) {
+            auto now = std::chrono::steady_clock::now();
+
+            if (!Tick()) {
+                break;
+            }
+
+            auto elapsed = std::chrono::steady_clock::now() - now;
+            auto sleepTime = std::chrono::duration<float>(1.0f / TICKS_PER_SECOND) - elapsed;
+            if (sleepTime.count() > 0) {
+                std::this_thread::sleep_for(sleepTime);
+            }
+        }
+
+        std::cout << "GameServer stopped" << std::endl;
+    }
+
+    void GameServer::Start() {
         m_running = true;
 
         WaitForAllPlayers();
+        StartMatch();
+    }
+
+    bool GameServer::TryStart() {
+        if (m_matchStarted) {
+            return true;
+        }
+        m_running = true;
+
+        while (auto packet = m_network->ReceiveUdp(m_udpSocket, 1024)) {
+            if (!packet->data.empty()) {
+                HandleHello(packet->data, packet->from);
+            }
+        }
+        if (m_connectedPlayers.size() < m_expectedPlayers.size()) {
+            return false;
+        }
+
+        std::cout << "All players connected!" << std::endl;
+        StartMatch();
+        return true;
+    }
+
+    void GameServer::StartMatch() {
+        m_matchStarted = true;
 
         try {
             std::cout << "Loading level from: " << m_levelPath << std::endl;
@@ -138,50 +136,26 @@ namespace network {
                 std::cout << "Boss position: (" << levelData.boss->x << ", " << levelData.boss->y << ")" << std::endl;
             }
 
-            auto createdEntities = RType::ECS::LevelLoader::CreateServerEntities(m_registry, levelData);
-            std::cout << "Level loaded: " << createdEntities.obstacleColliders.size() << " obstacle colliders, "
-                      << createdEntities.enemies.size() << " enemy entities, boss: "
-                      << (createdEntities.boss != RType::ECS::NULL_ENTITY ? "CREATED" : "NOT CREATED") << std::endl;
-
-            for (auto collider : createdEntities.obstacleColliders) {
-                if (!m_registry.IsEntityAlive(collider) ||
-                    !m_registry.HasComponent<RType::ECS::ObstacleMetadata>(collider)) {
-                    continue;
-                }
-                const auto& metadata = m_registry.GetComponent<RType::ECS::ObstacleMetadata>(collider);
-
-                if (metadata.visualEntity != RType::ECS::NULL_ENTITY &&
-                    m_registry.IsEntityAlive(metadata.visualEntity) &&
-                    m_registry.HasComponent<RType::ECS::Position>(metadata.visualEntity) &&
-                    m_registry.HasComponent<RType::ECS::Position>(collider)) {
-
-                    const auto& visualPos = m_registry.GetComponent<RType::ECS::Position>(metadata.visualEntity);
-                    auto& colliderPos = m_registry.GetComponent<RType::ECS::Position>(collider);
-
-                    colliderPos.x = visualPos.x + metadata.offsetX;
-                    colliderPos.y = visualPos.y + metadata.offsetY;
-
-                    std::cout << "[SERVER INIT] Collider synced: visual=(" << visualPos.x << "," << visualPos.y
-                              << ") offset=(" << metadata.offsetX << "," << metadata.offsetY
-                              << ") -> collider=(" << colliderPos.x << "," << colliderPos.y << ")" << std::endl;
-                }
-            }
-
-            size_t obstaclesWithColliders = 0;
-            for (auto obsEntity : createdEntities.obstacleColliders) {
-                if (m_registry.HasComponent<RType::ECS::Obstacle>(obsEntity) && m_registry.HasComponent<RType::ECS::BoxCollider>(obsEntity) && m_registry.HasComponent<RType::ECS::CollisionLayer>(obsEntity)) {
-                    obstaclesWithColliders++;
-                }
-            }
-            std::cout << "Verified: " << obstaclesWithColliders << " obstacles have collision components" << std::endl;
+            m_levelStreamer.Start(m_registry, levelData);
+            const auto& spawned = m_levelStreamer.GetSpawned();
+            std::cout << "Level streaming: " << m_levelStreamer.GetTimelineSize() << " timeline items, "
+                      << spawned.obstacleColliders.size() << " obstacle colliders and "
+                      << spawned.enemies.size() << " enemies in the first window" << std::endl;
         } catch (const std::exception& e) {
             std::cerr << "Failed to load level: " << e.what() << std::endl;
             std::cerr << "Continuing without obstacles..." << std::endl;
         }
 
+        std::cout << "Simulation seed: " << m_rng.GetSeed() << std::endl;
+
+        // Lobby order rather than hash-map order, so spawn slots do not depend on the standard library
         const float defaultSpawnY[] = {200.0f, 360.0f, 520.0f, 680.0f};
         size_t playerIndex = 0;
-        for (const auto& [hash, player] : m_connectedPlayers) {
+        for (const auto& expected : m_expectedPlayers) {
+            uint64_t hash = expected.hash;
+            if (m_connectedPlayers.find(hash) == m_connectedPlayers.end()) {
+                continue;
+            }
             float spawnX = 100.0f;
             float spawnY = defaultSpawnY[playerIndex % 4];
 
@@ -190,42 +164,74 @@ namespace network {
         }
 
         std::cout << "All players connected! Starting game loop..." << std::endl;
+    }
 
-        const float TICK_RATE = 1.0f / 60.0f;
+    bool GameServer::Tick() {
+        if (!m_running) {
+            return false;
+        }
 
-        auto lastTick = std::chrono::steady_clock::now();
+        ProcessIncomingPackets();
 
-        while (m_running) {
-            auto now = std::chrono::steady_clock::now();
-            lastTick = now;
+        LoadNextLevelIfNeeded();
 
-            ProcessIncomingPackets();
+        if (AllPlayersDisconnected() && !m_levelComplete) {
+            std::cout << "All players disconnected. Stopping game server..." << std::endl;
+            m_inputLog.EndTick(m_currentTick);
+            Stop();
+            return false;
+        }
 
-            LoadNextLevelIfNeeded();
+        UpdateGameLogic(1.0f / TICKS_PER_SECOND);
+        m_inputLog.EndTick(m_currentTick);
+        m_currentTick++;
 
-            if (AllPlayersDisconnected() && !m_levelComplete) {
-                std::cout << "All players disconnected. Stopping game server..." << std::endl;
-                Stop();
-                break;
-            }
+        SendStateSnapshots();
+        return true;
+    }
 
-            UpdateGameLogic(TICK_RATE);
-            m_currentTick++;
+    bool GameServer::RecordInputs(const std::string& path) {
+        if (!m_inputLog.Open(path, m_rng.GetSeed(), m_levelPath, m_expectedPlayers)) {
+            std::cerr << "[SERVER] Could not open input log " << path << std::endl;
+            return false;
+        }
+        std::cout << "[SERVER] Recording inputs to " << path << std::endl;
+        return true;
+    }
 
-            SendStateSnapshots();
+    uint64_t GameServer::ComputeStateChecksum() const {
+        using namespace RType::ECS;
+        constexpr uint64_t FNV_OFFSET = 1469598103934665603ULL;
+        constexpr uint64_t FNV_PRIME = 1099511628211ULL;
 
-            auto elapsed = std::chrono::steady_clock::now() - now;
-            auto sleepTime = std::chrono::duration<float>(TICK_RATE) - elapsed;
-            if (sleepTime.count() > 0) {
-                std::this_thread::sleep_for(sleepTime);
+        uint64_t checksum = FNV_OFFSET;
+        auto mix = [&checksum](const void* data, size_t size) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; i++) {
+                checksum = (checksum ^ bytes[i]) * FNV_PRIME;
             }
-        }
+        };
 
-        std::cout << "GameServer stopped" << std::endl;
+        for (auto entity : m_registry.GetEntitiesWithComponent<NetworkId>()) {
+            const uint32_t netId = m_registry.GetComponent<NetworkId>(entity).id;
+            mix(&netId, sizeof(netId));
+            if (m_registry.HasComponent<Position>(entity)) {
+                const auto& pos = m_registry.GetComponent<Position>(entity);
+                mix(&pos.x, sizeof(pos.x));
+                mix(&pos.y, sizeof(pos.y));
+            }
+            if (m_registry.HasComponent<Health>(entity)) {
+                const int health = m_registry.GetComponent<Health>(entity).current;
+                mix(&health, sizeof(health));
+            }
+        }
+        mix(&m_scrollOffset, sizeof(m_scrollOffset));
+        return checksum;
     }
 
     void GameServer::Stop() {
         m_running = false;
+        m_inputLog.Close();
     }
 
     bool GameServer::AllPlayersDisconnected() const {
@@ -354,6 +360,15 @@ namespace network {
         it->second.lastInputSequence = input->sequence;
         it->second.lastPingTime = now;
 
+        if (m_inputLog.IsOpen()) {
+            InputLogEvent event;
+            event.playerHash = input->playerHash;
+            event.type = static_cast<uint8_t>(InputLogEventType::INPUT);
+            event.inputs = input->inputs;
+            event.sequence = input->sequence;
+            m_inputLog.Record(event);
+        }
+
         using namespace RType::ECS;
         RType::ECS::Entity playerEntity = NULL_ENTITY;
         auto players = m_registry.GetEntitiesWithComponent<Player>();
@@ -411,6 +426,12 @@ namespace network {
             if (it->second.endpoint == from) {
                 std::cout << "[GameServer] Player " << it->second.info.name
                           << " (hash: " << it->first << ") disconnected gracefully" << std::endl;
+                if (m_inputLog.IsOpen()) {
+                    InputLogEvent event;
+                    event.playerHash = it->first;
+                    event.type = static_cast<uint8_t>(InputLogEventType::DISCONNECT);
+                    m_inputLog.Record(event);
+                }
                 m_connectedPlayers.erase(it);
                 std::cout << "[GameServer] Remaining players: " << m_connectedPlayers.size() << std::endl;
                 return;
@@ -460,260 +481,261 @@ namespace network {
             inputAcks.push_back(ack);
         }
 
-        std::unordered_map<uint32_t, EntityState> currentStates;
-        for (const auto& entity : m_entities) {
-            EntityState state;
-            state.entityId = entity.id;
-            state.entityType = static_cast<uint8_t>(entity.type);
-            state.x = entity.x;
-            state.y = entity.y;
-            state.vx = entity.vx;
-            state.vy = entity.vy;
-            state.health = entity.health;
-            state.flags = entity.flags;
-            state.ownerHash = entity.ownerHash;
-            state.score = entity.score;
-            state.powerUpFlags = entity.powerUpFlags;
-            state.speedMultiplier = entity.speedMultiplier;
-            state.weaponType = entity.weaponType;
-            state.fireRate = entity.fireRate;
-            currentStates[entity.id] = state;
-        }
-
-        uint32_t minAckedSeq = m_stateSequence;
-        for (const auto& [hash, connPlayer] : m_connectedPlayers) {
-            if (connPlayer.lastAckedStateSeq < minAckedSeq) {
-                minAckedSeq = connPlayer.lastAckedStateSeq;
+        // Serialized as kept by UpdateReplicatedStates(), no per-tick copy
+        const std::unordered_map<uint32_t, EntityState>& currentStates = m_replicator.GetStates();
+        std::unordered_map<uint64_t, uint32_t> playerShips;
+        for (auto playerEntity : players) {
+            const uint32_t networkId = m_replicator.GetNetworkId(playerEntity);
+            if (networkId != 0 && currentStates.count(networkId) > 0) {
+                playerShips[currentStates.at(networkId).ownerHash] = networkId;
             }
         }
 
-        bool sendFullSnapshot = (m_stateSequence % FULL_SNAPSHOT_INTERVAL == 0) ||
-                                (minAckedSeq == 0) ||
-                                (m_stateSequence - minAckedSeq > FULL_SNAPSHOT_INTERVAL);
-
-        if (sendFullSnapshot) {
-            StatePacketHeader header;
-            header.tick = m_currentTick;
-            header.timestamp = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::steady_clock::now().time_since_epoch()).count());
-            header.entityCount = static_cast<uint16_t>(m_entities.size());
-            header.scrollOffset = m_scrollOffset;
-            header.inputAckCount = static_cast<uint8_t>(inputAcks.size());
-            header.stateSequence = m_stateSequence;
-
-            size_t packetSize = sizeof(StatePacketHeader) +
-                               sizeof(InputAck) * inputAcks.size() +
-                               sizeof(EntityState) * m_entities.size();
-            std::vector<uint8_t> packet(packetSize);
-            std::memcpy(packet.data(), &header, sizeof(StatePacketHeader));
-
-            size_t offset = sizeof(StatePacketHeader);
-            for (const auto& ack : inputAcks) {
-                std::memcpy(packet.data() + offset, &ack, sizeof(InputAck));
-                offset += sizeof(InputAck);
-            }
-
-            for (const auto& [id, state] : currentStates) {
-                std::memcpy(packet.data() + offset, &state, sizeof(EntityState));
-                offset += sizeof(EntityState);
+        for (auto& [hash, connPlayer] : m_connectedPlayers) {
+            const EntityState* viewer = nullptr;
+            auto shipIt = playerShips.find(hash);
+            if (shipIt != playerShips.end()) {
+                viewer = &currentStates.at(shipIt->second);
             }
 
-            Broadcast(packet);
+            ClientSnapshotState& snapshot = connPlayer.snapshot;
+            bool resync = (snapshot.lastResyncSeq == 0) ||
+                          (m_stateSequence - snapshot.lastResyncSeq >= FULL_SNAPSHOT_INTERVAL);
 
-            m_totalBytesSent += packet.size() * m_connectedPlayers.size();
-            m_fullSnapshotBytesSent += packet.size() * m_connectedPlayers.size();
+            if (resync) {
+                snapshot.lastResyncSeq = m_stateSequence;
 
-            m_lastSentState = currentStates;
-            m_destroyedEntities.clear();
+                size_t fullSize = sizeof(StatePacketHeader) +
+                                  sizeof(InputAck) * inputAcks.size() +
+                                  sizeof(EntityState) * currentStates.size();
+                if (fullSize <= m_snapshotBudget.maxPacketBytes) {
+                    SendFullSnapshot(connPlayer, currentStates, inputAcks);
+                    continue;
+                }
 
-            static int fullCount = 0;
-            if (fullCount++ % 60 == 0) {
-                auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::steady_clock::now().time_since_epoch()).count();
-                std::cout << "[SERVER FULL] t=" << ms << " seq=" << m_stateSequence
-                          << " size=" << packet.size() << " bytes, entities=" << m_entities.size() << std::endl;
-            }
-        } else {
-            std::vector<EntityState> newEntities;
-            std::vector<std::pair<uint32_t, uint8_t>> deltaUpdates;
-            std::vector<uint8_t> deltaData;
-
-            std::vector<uint32_t> destroyedThisTick;
-            for (const auto& [id, oldState] : m_lastSentState) {
-                if (currentStates.find(id) == currentStates.end()) {
-                    destroyedThisTick.push_back(id);
+                // A full snapshot would not fit in one datagram: resend every entity
+                // in full through the prioritized delta path over the next ticks.
+                for (const auto& [id, state] : currentStates) {
+                    snapshot.needsFullResend.insert(id);
                 }
             }
 
-            for (const auto& [id, newState] : currentStates) {
-                auto it = m_lastSentState.find(id);
-                if (it == m_lastSentState.end()) {
-                    newEntities.push_back(newState);
-                } else {
-                    const EntityState& oldState = it->second;
-                    uint8_t deltaFlags = 0;
-
-                    if (std::abs(newState.x - oldState.x) > POSITION_DELTA_THRESHOLD ||
-                        std::abs(newState.y - oldState.y) > POSITION_DELTA_THRESHOLD) {
-                        deltaFlags |= DeltaFlags::DELTA_POSITION;
-                    }
-                    if (std::abs(newState.vx - oldState.vx) > 1.0f ||
-                        std::abs(newState.vy - oldState.vy) > 1.0f) {
-                        deltaFlags |= DeltaFlags::DELTA_VELOCITY;
-                    }
-                    if (newState.health != oldState.health) {
-                        deltaFlags |= DeltaFlags::DELTA_HEALTH;
-                    }
-                    if (newState.flags != oldState.flags) {
-                        deltaFlags |= DeltaFlags::DELTA_FLAGS;
-                    }
-                    if (newState.score != oldState.score) {
-                        deltaFlags |= DeltaFlags::DELTA_SCORE;
-                    }
-                    if (newState.powerUpFlags != oldState.powerUpFlags ||
-                        newState.speedMultiplier != oldState.speedMultiplier) {
-                        deltaFlags |= DeltaFlags::DELTA_POWERUP;
-                    }
-                    if (newState.weaponType != oldState.weaponType ||
-                        newState.fireRate != oldState.fireRate) {
-                        deltaFlags |= DeltaFlags::DELTA_WEAPON;
-                    }
+            SendDeltaSnapshot(connPlayer, currentStates, inputAcks, viewer);
+        }
 
-                    if (deltaFlags != 0) {
-                        deltaUpdates.push_back({id, deltaFlags});
-
-                        if (deltaFlags & DeltaFlags::DELTA_POSITION) {
-                            const uint8_t* px = reinterpret_cast<const uint8_t*>(&newState.x);
-                            const uint8_t* py = reinterpret_cast<const uint8_t*>(&newState.y);
-                            deltaData.insert(deltaData.end(), px, px + sizeof(float));
-                            deltaData.insert(deltaData.end(), py, py + sizeof(float));
-                        }
-                        if (deltaFlags & DeltaFlags::DELTA_VELOCITY) {
-                            const uint8_t* pvx = reinterpret_cast<const uint8_t*>(&newState.vx);
-                            const uint8_t* pvy = reinterpret_cast<const uint8_t*>(&newState.vy);
-                            deltaData.insert(deltaData.end(), pvx, pvx + sizeof(float));
-                            deltaData.insert(deltaData.end(), pvy, pvy + sizeof(float));
-                        }
-                        if (deltaFlags & DeltaFlags::DELTA_HEALTH) {
-                            const uint8_t* ph = reinterpret_cast<const uint8_t*>(&newState.health);
-                            deltaData.insert(deltaData.end(), ph, ph + sizeof(uint16_t));
-                        }
-                        if (deltaFlags & DeltaFlags::DELTA_FLAGS) {
-                            deltaData.push_back(newState.flags);
-                        }
-                        if (deltaFlags & DeltaFlags::DELTA_SCORE) {
-                            const uint8_t* ps = reinterpret_cast<const uint8_t*>(&newState.score);
-                            deltaData.insert(deltaData.end(), ps, ps + sizeof(uint32_t));
-                        }
-                        if (deltaFlags & DeltaFlags::DELTA_POWERUP) {
-                            deltaData.push_back(newState.powerUpFlags);
-                            deltaData.push_back(newState.speedMultiplier);
-                        }
-                        if (deltaFlags & DeltaFlags::DELTA_WEAPON) {
-                            deltaData.push_back(newState.weaponType);
-                            deltaData.push_back(newState.fireRate);
-                        }
-                    }
-                }
+        static int snapshotLog = 0;
+        if (snapshotLog++ % 120 == 0) {
+            for (const auto& [hash, connPlayer] : m_connectedPlayers) {
+                const auto& stats = connPlayer.snapshot.stats;
+                std::cout << "[SERVER SNAPSHOT] seq=" << m_stateSequence
+                          << " player=" << connPlayer.info.name
+                          << " last=" << stats.lastPacketBytes << "/" << m_snapshotBudget.maxPacketBytes << " bytes"
+                          << " max=" << stats.maxPacketBytes
+                          << " deferred=" << stats.deferredEntities
+                          << " starvation=" << stats.maxStarvationTicks << " ticks"
+                          << " entities=" << currentStates.size() << std::endl;
             }
+        }
+    }
 
-            size_t payloadSize = sizeof(InputAck) * inputAcks.size() +
-                                sizeof(uint32_t) * destroyedThisTick.size() +
-                                sizeof(EntityState) * newEntities.size() +
-                                sizeof(DeltaEntityHeader) * deltaUpdates.size() +
-                                deltaData.size();
+    void GameServer::SendFullSnapshot(ConnectedPlayer& player, const std::unordered_map<uint32_t, EntityState>& currentStates,
+        const std::vector<InputAck>& inputAcks) {
+        StatePacketHeader header;
+        header.tick = m_currentTick;
+        header.timestamp = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+        header.entityCount = static_cast<uint16_t>(currentStates.size());
+        header.scrollOffset = m_scrollOffset;
+        header.inputAckCount = static_cast<uint8_t>(inputAcks.size());
+        header.stateSequence = m_stateSequence;
+
+        size_t packetSize = sizeof(StatePacketHeader) +
+                           sizeof(InputAck) * inputAcks.size() +
+                           sizeof(EntityState) * currentStates.size();
+        std::vector<uint8_t> packet(packetSize);
+        std::memcpy(packet.data(), &header, sizeof(StatePacketHeader));
+
+        size_t offset = sizeof(StatePacketHeader);
+        for (const auto& ack : inputAcks) {
+            std::memcpy(packet.data() + offset, &ack, sizeof(InputAck));
+            offset += sizeof(InputAck);
+        }
 
-            std::vector<uint8_t> payload(payloadSize);
-            size_t offset = 0;
+        for (const auto& [id, state] : currentStates) {
+            std::memcpy(packet.data() + offset, &state, sizeof(EntityState));
+            offset += sizeof(EntityState);
+        }
 
-            for (const auto& ack : inputAcks) {
-                std::memcpy(payload.data() + offset, &ack, sizeof(InputAck));
-                offset += sizeof(InputAck);
-            }
+        SendTo(packet, player.endpoint);
 
-            for (uint32_t destroyedId : destroyedThisTick) {
-                std::memcpy(payload.data() + offset, &destroyedId, sizeof(uint32_t));
-                offset += sizeof(uint32_t);
-            }
+        m_fullSnapshotBytesSent += packet.size();
+        RecordSnapshotSent(player, packet.size());
 
-            for (const auto& newEntity : newEntities) {
-                std::memcpy(payload.data() + offset, &newEntity, sizeof(EntityState));
-                offset += sizeof(EntityState);
-            }
+        ClientSnapshotState& snapshot = player.snapshot;
+        snapshot.lastSent = currentStates;
+        snapshot.pending.clear();
+        snapshot.pendingDestroyed.clear();
+        snapshot.needsFullResend.clear();
+        snapshot.stats.deferredEntities = 0;
+        snapshot.stats.maxStarvationTicks = 0;
+    }
 
-            for (const auto& [entityId, deltaFlags] : deltaUpdates) {
-                DeltaEntityHeader deh;
-                deh.entityId = entityId;
-                deh.deltaFlags = deltaFlags;
-                std::memcpy(payload.data() + offset, &deh, sizeof(DeltaEntityHeader));
-                offset += sizeof(DeltaEntityHeader);
+    void GameServer::SendDeltaSnapshot(ConnectedPlayer& player, const std::unordered_map<uint32_t, EntityState>& currentStates,
+        const std::vector<InputAck>& inputAcks, const EntityState* viewer) {
+        ClientSnapshotState& snapshot = player.snapshot;
+        const size_t budget = m_snapshotBudget.maxPacketBytes;
+        size_t usedBytes = sizeof(StateDeltaHeader) + sizeof(InputAck) * inputAcks.size();
+
+        for (auto it = snapshot.lastSent.begin(); it != snapshot.lastSent.end();) {
+            if (currentStates.find(it->first) == currentStates.end()) {
+                snapshot.pendingDestroyed.emplace(it->first, m_stateSequence);
+                snapshot.pending.erase(it->first);
+                snapshot.needsFullResend.erase(it->first);
+                it = snapshot.lastSent.erase(it);
+            } else {
+                ++it;
             }
+        }
 
-            if (!deltaData.empty()) {
-                std::memcpy(payload.data() + offset, deltaData.data(), deltaData.size());
-                offset += deltaData.size();
+        // Destroy notices are repeated in every packet until the client acknowledges
+        // a sequence that carried them, so a lost datagram cannot leave a ghost entity.
+        std::vector<uint32_t> destroyedIds;
+        for (auto it = snapshot.pendingDestroyed.begin(); it != snapshot.pendingDestroyed.end();) {
+            if (player.lastAckedStateSeq >= it->second) {
+                it = snapshot.pendingDestroyed.erase(it);
+                continue;
             }
-
-            StateDeltaHeader deltaHeader;
-            deltaHeader.tick = m_currentTick;
-            deltaHeader.timestamp = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::steady_clock::now().time_since_epoch()).count());
-            deltaHeader.stateSequence = m_stateSequence;
-            deltaHeader.baseSequence = minAckedSeq;
-            deltaHeader.deltaEntityCount = static_cast<uint16_t>(deltaUpdates.size());
-            deltaHeader.destroyedCount = static_cast<uint16_t>(destroyedThisTick.size());
-            deltaHeader.newEntityCount = static_cast<uint16_t>(newEntities.size());
-            deltaHeader.scrollOffset = m_scrollOffset;
-            deltaHeader.inputAckCount = static_cast<uint8_t>(inputAcks.size());
-
-            std::vector<uint8_t> finalPayload;
-            bool useCompression = false;
-
-            if (payloadSize >= Compression::MIN_COMPRESSION_SIZE) {
-                auto compressed = Compression::CompressLZ4(payload.data(), payload.size());
-                if (!compressed.empty() && Compression::ShouldCompress(payloadSize, compressed.size())) {
-                    finalPayload = std::move(compressed);
-                    deltaHeader.compressionFlags = CompressionFlags::COMPRESSION_LZ4;
-                    deltaHeader.uncompressedSize = static_cast<uint32_t>(payloadSize);
-                    useCompression = true;
-                }
+            if (usedBytes + sizeof(uint32_t) <= budget) {
+                destroyedIds.push_back(it->first);
+                usedBytes += sizeof(uint32_t);
             }
+            ++it;
+        }
 
-            if (!useCompression) {
-                finalPayload = std::move(payload);
-                deltaHeader.compressionFlags = CompressionFlags::COMPRESSION_NONE;
-                deltaHeader.uncompressedSize = 0;
-            }
+        SnapshotSelection selection = SnapshotPrioritizer::SelectEntities(snapshot, currentStates, m_replicator.GetChangedIds(),
+            viewer, m_snapshotBudget, usedBytes);
+        const auto& newEntities = selection.newEntities;
+        const auto& deltaUpdates = selection.deltaUpdates;
+        const auto& deltaData = selection.deltaData;
+        const uint32_t deferred = selection.deferred;
+        const uint32_t maxStarvation = selection.maxStarvation;
+
+        size_t payloadSize = sizeof(InputAck) * inputAcks.size() +
+                            sizeof(uint32_t) * destroyedIds.size() +
+                            sizeof(EntityState) * newEntities.size() +
+                            sizeof(DeltaEntityHeader) * deltaUpdates.size() +
+                            deltaData.size();
+
+        std::vector<uint8_t> payload(payloadSize);
+        size_t offset = 0;
+
+        for (const auto& ack : inputAcks) {
+            std::memcpy(payload.data() + offset, &ack, sizeof(InputAck));
+            offset += sizeof(InputAck);
+        }
 
-            std::vector<uint8_t> packet(sizeof(StateDeltaHeader) + finalPayload.size());
-            std::memcpy(packet.data(), &deltaHeader, sizeof(StateDeltaHeader));
-            std::memcpy(packet.data() + sizeof(StateDeltaHeader), finalPayload.data(), finalPayload.size());
+        for (uint32_t destroyedId : destroyedIds) {
+            std::memcpy(payload.data() + offset, &destroyedId, sizeof(uint32_t));
+            offset += sizeof(uint32_t);
+        }
 
-            Broadcast(packet);
+        for (const auto& newEntity : newEntities) {
+            std::memcpy(payload.data() + offset, &newEntity, sizeof(EntityState));
+            offset += sizeof(EntityState);
+        }
 
-            m_totalBytesSent += packet.size() * m_connectedPlayers.size();
-            m_deltaBytesSent += packet.size() * m_connectedPlayers.size();
+        for (const auto& [entityId, deltaFlags] : deltaUpdates) {
+            DeltaEntityHeader deh;
+            deh.entityId = entityId;
+            deh.deltaFlags = deltaFlags;
+            std::memcpy(payload.data() + offset, &deh, sizeof(DeltaEntityHeader));
+            offset += sizeof(DeltaEntityHeader);
+        }
 
-            m_lastSentState = currentStates;
+        if (!deltaData.empty()) {
+            std::memcpy(payload.data() + offset, deltaData.data(), deltaData.size());
+            offset += deltaData.size();
+        }
 
-            static int deltaCount = 0;
-            if (deltaCount++ % 120 == 0) {
-                size_t fullSize = sizeof(StatePacketHeader) +
-                                 sizeof(InputAck) * inputAcks.size() +
-                                 sizeof(EntityState) * m_entities.size();
-                float savings = fullSize > 0 ? (1.0f - (float)packet.size() / (float)fullSize) * 100.0f : 0.0f;
-
-                auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                    std::chrono::steady_clock::now().time_since_epoch()).count();
-                std::cout << "[SERVER DELTA] t=" << ms << " seq=" << m_stateSequence
-                          << " size=" << packet.size() << "/" << fullSize << " bytes"
-                          << " (saved " << std::fixed << std::setprecision(1) << savings << "%)"
-                          << (useCompression ? " [LZ4]" : "")
-                          << " changed=" << deltaUpdates.size()
-                          << " new=" << newEntities.size()
-                          << " destroyed=" << destroyedThisTick.size() << std::endl;
+        StateDeltaHeader deltaHeader;
+        deltaHeader.tick = m_currentTick;
+        deltaHeader.timestamp = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+        deltaHeader.stateSequence = m_stateSequence;
+        deltaHeader.baseSequence = player.lastAckedStateSeq;
+        deltaHeader.deltaEntityCount = static_cast<uint16_t>(deltaUpdates.size());
+        deltaHeader.destroyedCount = static_cast<uint16_t>(destroyedIds.size());
+        deltaHeader.newEntityCount = static_cast<uint16_t>(newEntities.size());
+        deltaHeader.scrollOffset = m_scrollOffset;
+        deltaHeader.inputAckCount = static_cast<uint8_t>(inputAcks.size());
+
+        if (m_trafficRecorder.IsOpen()) {
+            m_trafficRecorder.Record(payload.data(), payload.size());
+        }
+
+        std::vector<uint8_t>* finalPayload = &payload;
+        deltaHeader.compressionFlags = CompressionFlags::COMPRESSION_NONE;
+        deltaHeader.uncompressedSize = 0;
+
+        if (m_snapshotCompressor && payloadSize >= m_snapshotCompressor->GetMinInputSize()) {
+            CompressionHistory history = player.sentPayloads.Find(deltaHeader.baseSequence);
+            if (m_snapshotCompressor->Compress(payload.data(), payload.size(), history, m_compressedScratch) &&
+                Compression::ShouldCompress(payloadSize, m_compressedScratch.size())) {
+                finalPayload = &m_compressedScratch;
+                deltaHeader.compressionFlags = m_snapshotCompressor->GetCompressionFlag();
+                deltaHeader.uncompressedSize = static_cast<uint32_t>(payloadSize);
             }
         }
+        player.sentPayloads.Store(m_stateSequence, payload.data(), payload.size());
+
+        std::vector<uint8_t> packet(sizeof(StateDeltaHeader) + finalPayload->size());
+        std::memcpy(packet.data(), &deltaHeader, sizeof(StateDeltaHeader));
+        std::memcpy(packet.data() + sizeof(StateDeltaHeader), finalPayload->data(), finalPayload->size());
+
+        SendTo(packet, player.endpoint);
+
+        m_deltaBytesSent += packet.size();
+        RecordSnapshotSent(player, packet.size());
+
+        snapshot.stats.deferredEntities = deferred;
+        snapshot.stats.totalDeferred += deferred;
+        snapshot.stats.maxStarvationTicks = maxStarvation;
+        snapshot.stats.peakStarvationTicks = std::max(snapshot.stats.peakStarvationTicks, maxStarvation);
+        m_maxStarvationTicks = std::max(m_maxStarvationTicks, maxStarvation);
+    }
+
+    void GameServer::RecordSnapshotSent(ConnectedPlayer& player, size_t packetSize) {
+        SnapshotStats& stats = player.snapshot.stats;
+        stats.packetsSent++;
+        stats.bytesSent += packetSize;
+        stats.lastPacketBytes = static_cast<uint32_t>(packetSize);
+        stats.maxPacketBytes = std::max(stats.maxPacketBytes, stats.lastPacketBytes);
+
+        m_totalBytesSent += packetSize;
+        m_maxSnapshotPacketBytes = std::max(m_maxSnapshotPacketBytes, stats.lastPacketBytes);
+    }
+
+    bool GameServer::SetSnapshotCompression(CompressionFlags flag, const std::vector<uint8_t>& dictionary) {
+        if (flag == COMPRESSION_NONE) {
+            m_snapshotCompressor.reset();
+            return true;
+        }
+        auto compressor = CreateSnapshotCompressor(flag, dictionary);
+        if (!compressor) {
+            std::cerr << "[SERVER] Unsupported snapshot compression " << static_cast<int>(flag) << ", keeping current one" << std::endl;
+            return false;
+        }
+        m_snapshotCompressor = std::move(compressor);
+        std::cout << "[SERVER] Snapshot compression: " << m_snapshotCompressor->GetName() << std::endl;
+        return true;
+    }
+
+    SnapshotStats GameServer::GetSnapshotStats(uint64_t playerHash) const {
+        auto it = m_connectedPlayers.find(playerHash);
+        if (it == m_connectedPlayers.end()) {
+            return SnapshotStats{};
+        }
+        return it->second.snapshot.stats;
     }
 
     void GameServer::SendTo(const std::vector<uint8_t>& data, const Network::Endpoint& to) {
@@ -721,8 +743,22 @@ namespace network {
             return;
         }
         try {
-            m_network->SendUdp(m_udpSocket, data, to);
-            m_packetsSent++;
+            if (data.size() <= MAX_UDP_DATAGRAM_SIZE) {
+                m_network->SendUdp(m_udpSocket, data, to);
+                m_packetsSent++;
+                return;
+            }
+
+            auto fragments = PacketFragmenter::Split(data, m_nextFragmentMessageId++);
+            if (fragments.empty()) {
+                std::cerr << "[SERVER] Dropping " << data.size() << " byte packet: too large to fragment" << std::endl;
+                return;
+            }
+            for (const auto& fragment : fragments) {
+                m_network->SendUdp(m_udpSocket, fragment, to);
+                m_packetsSent++;
+            }
+            m_fragmentedPacketsSent++;
         } catch (const std::exception& e) {
             std::cerr << "Error sending to " << to.address << ":" << to.port << " - " << e.what() << std::endl;
         }
@@ -735,9 +771,12 @@ namespace network {
     }
 
     void GameServer::UpdateGameLogic(float dt) {
-        m_scrollOffset += SCROLL_SPEED * dt;
-
         m_scrollingSystem->Update(m_registry, dt);
+        m_levelStreamer.Update(m_registry, dt);
+        m_scrollOffset = m_levelStreamer.GetScrollOffset();
+        if (!m_nextLevel.valid() && m_levelStreamer.GetSpawned().boss != RType::ECS::NULL_ENTITY) {
+            PreloadNextLevel();
+        }
         m_bossSystem->Update(m_registry, dt);
         m_bossAttackSystem->Update(m_registry, dt);
         m_mineSystem->Update(m_registry, dt);
@@ -765,15 +804,12 @@ namespace network {
 
         CheckBossDefeated();
 
-        UpdateLegacyEntitiesFromRegistry();
-        CleanupDeadEntities();
+        UpdateReplicatedStates();
 
-        auto now = std::chrono::steady_clock::now();
-        float elapsed = std::chrono::duration<float>(now - m_lastSpawnTime).count();
-
-        if (elapsed >= m_enemySpawnInterval && !IsBossActive()) {
+        const uint32_t spawnIntervalTicks = static_cast<uint32_t>(m_enemySpawnInterval * TICKS_PER_SECOND);
+        if (m_currentTick - m_lastSpawnTick >= spawnIntervalTicks && !IsBossActive()) {
             SpawnEnemy();
-            m_lastSpawnTime = now;
+            m_lastSpawnTick = m_currentTick;
         }
     }
 
@@ -784,13 +820,9 @@ namespace network {
     }
 
     void GameServer::SpawnEnemy() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_real_distribution<float> yDist(50.0f, 550.0f);
-
         EnemyType enemyType = GetRandomEnemyType();
         float spawnX = 1920.0f;
-        float spawnY = yDist(gen);
+        float spawnY = m_rng.NextFloat(50.0f, 550.0f);
 
         RType::ECS::EnemyType ecsEnemyType = static_cast<RType::ECS::EnemyType>(static_cast<uint8_t>(enemyType));
 
@@ -925,18 +957,15 @@ namespace network {
 
             uint32_t enemyId = static_cast<uint32_t>(enemy);
 
-            if (m_enemyShootCooldowns.find(enemyId) == m_enemyShootCooldowns.end()) {
-                m_enemyShootCooldowns[enemyId] = 0.0f;
-            }
-
-            m_enemyShootCooldowns[enemyId] -= dt;
+            float& cooldown = m_enemyShootCooldowns[enemyId];
+            cooldown -= dt;
 
-            if (m_enemyShootCooldowns[enemyId] <= 0.0f) {
+            if (cooldown <= 0.0f) {
                 EnemyType type = static_cast<EnemyType>(static_cast<uint8_t>(enemyComp.type));
                 const EnemyStats& stats = GetEnemyStats(type);
                 uint8_t enemyTypeValue = static_cast<uint8_t>(enemyComp.type);
                 SpawnEnemyBullet(enemyId, pos.x + stats.bulletXOffset, pos.y + stats.bulletYOffset, enemyTypeValue);
-                m_enemyShootCooldowns[enemyId] = stats.fireRate;
+                cooldown = stats.fireRate;
             }
         }
 
@@ -952,441 +981,189 @@ namespace network {
         }
     }
 
-    void GameServer::CleanupDeadEntities() {
-        m_entities.erase(
-            std::remove_if(
-                m_entities.begin(),
-                m_entities.end(),
-                [](const GameEntity& e) { return e.health == 0; }),
-            m_entities.end());
-    }
-
-    void GameServer::UpdateLegacyEntitiesFromRegistry() {
+    void GameServer::RegisterReplicatedTypes() {
         using namespace RType::ECS;
 
-        m_entities.clear();
-
-        auto players = m_registry.GetEntitiesWithComponent<Player>();
-        for (auto playerEntity : players) {
-            if (!m_registry.IsEntityAlive(playerEntity) ||
-                !m_registry.HasComponent<Position>(playerEntity) ||
-                !m_registry.HasComponent<Velocity>(playerEntity) ||
-                !m_registry.HasComponent<Health>(playerEntity)) {
-                continue;
-            }
-
-            const auto& pos = m_registry.GetComponent<Position>(playerEntity);
-            const auto& vel = m_registry.GetComponent<Velocity>(playerEntity);
-            const auto& health = m_registry.GetComponent<Health>(playerEntity);
-            const auto& player = m_registry.GetComponent<Player>(playerEntity);
-
-            GameEntity entity;
-            entity.id = GetOrAssignNetworkId(playerEntity);
-            entity.type = EntityType::PLAYER;
-            RegisterNetworkType(entity.id, entity.type);
-            entity.x = pos.x;
-            entity.y = pos.y;
-            entity.vx = vel.dx;
-            entity.vy = vel.dy;
-            entity.health = static_cast<uint16_t>(std::max(0, health.current));
-
-            uint8_t flags = player.playerNumber & 0x0F;
-            entity.flags = flags;
-            entity.ownerHash = player.playerHash;
-
-            if (m_registry.HasComponent<ScoreValue>(playerEntity)) {
-                entity.score = m_registry.GetComponent<ScoreValue>(playerEntity).points;
-            } else {
-                entity.score = 0;
-            }
-
-            entity.powerUpFlags = 0;
-            entity.speedMultiplier = 10;
-            entity.weaponType = 0;
-            entity.fireRate = 20;
-
-            if (m_registry.HasComponent<ActivePowerUps>(playerEntity)) {
-                const auto& powerUps = m_registry.GetComponent<ActivePowerUps>(playerEntity);
-
-                if (powerUps.hasFireRateBoost) {
-                    entity.powerUpFlags |= network::PowerUpFlags::POWERUP_FIRE_RATE_BOOST;
-                }
-                if (powerUps.hasSpreadShot) {
-                    entity.powerUpFlags |= network::PowerUpFlags::POWERUP_SPREAD_SHOT;
-                }
-                if (powerUps.hasLaserBeam) {
-                    entity.powerUpFlags |= network::PowerUpFlags::POWERUP_LASER_BEAM;
-                }
-                if (powerUps.hasShield) {
-                    entity.powerUpFlags |= network::PowerUpFlags::POWERUP_SHIELD;
+        // Players are few and their flags depend on force pods: no inputs, rebuilt every tick
+        m_replicator.AddType({EntityType::PLAYER, Registry::MakeSignature<Player, Position, Velocity, Health>(), {}, {}, 0,
+            [](const Registry& registry, Entity playerEntity, EntityState& state) {
+                Replication::CaptureComponents<Position, Velocity, Health>(registry, playerEntity, state);
+                const auto& player = registry.GetComponent<Player>(playerEntity);
+                state.flags = player.playerNumber & 0x0F;
+                state.ownerHash = player.playerHash;
+                if (registry.HasComponent<ScoreValue>(playerEntity)) {
+                    Replication::CaptureComponents<ScoreValue>(registry, playerEntity, state);
                 }
 
-                float speedMult = powerUps.speedMultiplier;
-                entity.speedMultiplier = static_cast<uint8_t>(std::min(255, std::max(0, static_cast<int>(speedMult * 10.0f))));
-            }
+                if (registry.HasComponent<ActivePowerUps>(playerEntity)) {
+                    Replication::CaptureComponents<ActivePowerUps>(registry, playerEntity, state);
+                }
 
-            auto forcePods = m_registry.GetEntitiesWithComponent<ForcePod>();
-            for (auto podEntity : forcePods) {
-                if (m_registry.IsEntityAlive(podEntity)) {
-                    const auto& pod = m_registry.GetComponent<ForcePod>(podEntity);
-                    if (pod.owner == playerEntity) {
-                        entity.powerUpFlags |= network::PowerUpFlags::POWERUP_FORCE_POD;
+                for (auto podEntity : registry.GetEntitiesWithComponent<ForcePod>()) {
+                    if (registry.GetComponent<ForcePod>(podEntity).owner == playerEntity) {
+                        state.powerUpFlags |= network::PowerUpFlags::POWERUP_FORCE_POD;
                         break;
                     }
                 }
-            }
-
-            if (m_registry.HasComponent<WeaponSlot>(playerEntity)) {
-                const auto& weaponSlot = m_registry.GetComponent<WeaponSlot>(playerEntity);
-                entity.weaponType = static_cast<uint8_t>(weaponSlot.type);
-                entity.fireRate = static_cast<uint8_t>(std::min(255, std::max(0, static_cast<int>(weaponSlot.fireRate * 10.0f))));
-            } else if (m_registry.HasComponent<Shooter>(playerEntity)) {
-                const auto& shooter = m_registry.GetComponent<Shooter>(playerEntity);
-                entity.fireRate = static_cast<uint8_t>(std::min(255, std::max(0, static_cast<int>(shooter.fireRate * 10.0f))));
-            }
-
-            m_entities.push_back(entity);
-        }
-
-        auto enemies = m_registry.GetEntitiesWithComponent<Enemy>();
-        for (auto enemyEntity : enemies) {
-            if (!m_registry.IsEntityAlive(enemyEntity) ||
-                !m_registry.HasComponent<Position>(enemyEntity) ||
-                !m_registry.HasComponent<Velocity>(enemyEntity) ||
-                !m_registry.HasComponent<Health>(enemyEntity)) {
-                continue;
-            }
-
-            const auto& pos = m_registry.GetComponent<Position>(enemyEntity);
-            const auto& vel = m_registry.GetComponent<Velocity>(enemyEntity);
-            const auto& health = m_registry.GetComponent<Health>(enemyEntity);
-            const auto& enemy = m_registry.GetComponent<Enemy>(enemyEntity);
-
-            GameEntity entity;
-            entity.id = GetOrAssignNetworkId(enemyEntity);
-            entity.type = EntityType::ENEMY;
-            RegisterNetworkType(entity.id, entity.type);
-            entity.flags = static_cast<uint8_t>(enemy.type);
-            entity.x = pos.x;
-            entity.y = pos.y;
-            entity.vx = vel.dx;
-            entity.vy = vel.dy;
-            entity.health = static_cast<uint8_t>(std::min(255, std::max(0, health.current)));
-            entity.ownerHash = 0;
-            entity.score = 0;
-            m_entities.push_back(entity);
-        }
-
-        auto bosses = m_registry.GetEntitiesWithComponent<Boss>();
-        for (auto bossEntity : bosses) {
-            if (!m_registry.IsEntityAlive(bossEntity) ||
-                !m_registry.HasComponent<Position>(bossEntity) ||
-                !m_registry.HasComponent<Velocity>(bossEntity) ||
-                !m_registry.HasComponent<Health>(bossEntity)) {
-                continue;
-            }
-
-            const auto& pos = m_registry.GetComponent<Position>(bossEntity);
-            const auto& vel = m_registry.GetComponent<Velocity>(bossEntity);
-            const auto& health = m_registry.GetComponent<Health>(bossEntity);
-
-            uint8_t flags = 0;
-            if (m_registry.HasComponent<RType::ECS::DamageFlash>(bossEntity)) {
-                const auto& flash = m_registry.GetComponent<RType::ECS::DamageFlash>(bossEntity);
-                if (flash.isActive) {
-                    flags = 1;
-                }
-            }
 
-            float healthPercent = (static_cast<float>(health.current) / static_cast<float>(health.max)) * 100.0f;
-            uint8_t healthValue = static_cast<uint8_t>(std::min(100.0f, std::max(0.0f, healthPercent)));
-
-            GameEntity entity;
-            entity.id = GetOrAssignNetworkId(bossEntity);
-            entity.type = EntityType::BOSS;
-            RegisterNetworkType(entity.id, entity.type);
-            entity.x = pos.x;
-            entity.y = pos.y;
-            entity.vx = vel.dx;
-            entity.vy = vel.dy;
-            entity.health = healthValue;
-            entity.flags = flags;
-            entity.ownerHash = 0;
-            entity.score = 0;
-            m_entities.push_back(entity);
-        }
-
-        auto bullets = m_registry.GetEntitiesWithComponent<Bullet>();
-        for (auto bulletEntity : bullets) {
-            if (m_registry.HasComponent<RType::ECS::Obstacle>(bulletEntity) ||
-                m_registry.HasComponent<RType::ECS::ObstacleMetadata>(bulletEntity)) {
-                std::cerr << "[SERVER CLEANUP] Bullet entity " << bulletEntity
-                          << " had Obstacle components; removing to prevent obstacle desync." << std::endl;
-                if (m_registry.HasComponent<RType::ECS::Obstacle>(bulletEntity)) {
-                    m_registry.RemoveComponent<RType::ECS::Obstacle>(bulletEntity);
+                if (registry.HasComponent<WeaponSlot>(playerEntity)) {
+                    Replication::CaptureComponents<WeaponSlot>(registry, playerEntity, state);
+                } else if (registry.HasComponent<Shooter>(playerEntity)) {
+                    Replication::CaptureComponents<Shooter>(registry, playerEntity, state);
                 }
-                if (m_registry.HasComponent<RType::ECS::ObstacleMetadata>(bulletEntity)) {
-                    m_registry.RemoveComponent<RType::ECS::ObstacleMetadata>(bulletEntity);
+            }});
+
+        m_replicator.AddType({EntityType::ENEMY, Registry::MakeSignature<Enemy, Position, Velocity, Health>(), {},
+            Registry::MakeSignature<Enemy, Position, Velocity, Health>(), 0,
+            [](const Registry& registry, Entity enemyEntity, EntityState& state) {
+                Replication::CaptureComponents<Position, Velocity, Health>(registry, enemyEntity, state);
+                state.flags = static_cast<uint8_t>(registry.GetComponent<Enemy>(enemyEntity).type);
+            }});
+
+        // Boss health goes out as a percent of its maximum, for the client's health bar
+        m_replicator.AddType({EntityType::BOSS, Registry::MakeSignature<Boss, Position, Velocity, Health>(), {},
+            Registry::MakeSignature<Position, Velocity, Health, DamageFlash>(), 0,
+            [](const Registry& registry, Entity bossEntity, EntityState& state) {
+                Replication::CaptureComponents<Position, Velocity>(registry, bossEntity, state);
+                if (registry.HasComponent<DamageFlash>(bossEntity)) {
+                    Replication::CaptureComponents<DamageFlash>(registry, bossEntity, state);
                 }
-            }
-        }
-
-        for (auto bulletEntity : bullets) {
-            if (!m_registry.IsEntityAlive(bulletEntity) ||
-                !m_registry.HasComponent<Position>(bulletEntity) ||
-                !m_registry.HasComponent<Velocity>(bulletEntity)) {
-                continue;
-            }
-
-            const auto& pos = m_registry.GetComponent<Position>(bulletEntity);
-            const auto& vel = m_registry.GetComponent<Velocity>(bulletEntity);
-            const auto& bullet = m_registry.GetComponent<Bullet>(bulletEntity);
-            (void)bullet;
-
-            uint32_t bulletId = static_cast<uint32_t>(bulletEntity);
-            uint8_t flags = 0;
-            if (m_registry.HasComponent<RType::ECS::FireBullet>(bulletEntity)) {
-                flags = 18;
-            } else if (m_registry.HasComponent<RType::ECS::SecondAttack>(bulletEntity)) {
-                flags = 17;
-            } else if (m_registry.HasComponent<RType::ECS::WaveAttack>(bulletEntity)) {
-                flags = 16;
-            } else if (m_registry.HasComponent<RType::ECS::ThirdBullet>(bulletEntity)) {
-                flags = 15;
-            } else if (m_registry.HasComponent<RType::ECS::BlackOrb>(bulletEntity)) {
-                flags = 14;
-            } else if (m_registry.HasComponent<RType::ECS::BossBullet>(bulletEntity)) {
-                flags = 13;
-            } else if (m_registry.HasComponent<CollisionLayer>(bulletEntity)) {
-                const auto& collLayer = m_registry.GetComponent<CollisionLayer>(bulletEntity);
-                if (collLayer.layer == CollisionLayers::ENEMY_BULLET) {
+                const auto& health = registry.GetComponent<Health>(bossEntity);
+                float healthPercent = (static_cast<float>(health.current) / static_cast<float>(health.max)) * 100.0f;
+                state.health = static_cast<uint8_t>(std::min(100.0f, std::max(0.0f, healthPercent)));
+            }});
+
+        m_replicator.AddType({EntityType::BULLET, Registry::MakeSignature<Bullet, Position, Velocity>(), {},
+            Registry::MakeSignature<Position, Velocity, CollisionLayer>(), 0,
+            [this](const Registry& registry, Entity bulletEntity, EntityState& state) {
+                Replication::CaptureComponents<Position, Velocity>(registry, bulletEntity, state);
+                if (registry.HasComponent<FireBullet>(bulletEntity)) {
+                    state.flags = 18;
+                } else if (registry.HasComponent<SecondAttack>(bulletEntity)) {
+                    state.flags = 17;
+                } else if (registry.HasComponent<WaveAttack>(bulletEntity)) {
+                    state.flags = 16;
+                } else if (registry.HasComponent<ThirdBullet>(bulletEntity)) {
+                    state.flags = 15;
+                } else if (registry.HasComponent<BlackOrb>(bulletEntity)) {
+                    state.flags = 14;
+                } else if (registry.HasComponent<BossBullet>(bulletEntity)) {
+                    state.flags = 13;
+                } else if (registry.HasComponent<CollisionLayer>(bulletEntity) &&
+                           registry.GetComponent<CollisionLayer>(bulletEntity).layer == CollisionLayers::ENEMY_BULLET) {
                     uint8_t enemyType = 0;
-                    auto it = m_enemyBulletTypes.find(bulletId);
+                    auto it = m_enemyBulletTypes.find(static_cast<uint32_t>(bulletEntity));
                     if (it != m_enemyBulletTypes.end()) {
                         enemyType = it->second;
                     }
-                    flags = 10 + enemyType;
-                }
-            }
-
-            GameEntity entity;
-            entity.id = GetOrAssignNetworkId(bulletEntity);
-            entity.type = EntityType::BULLET;
-            RegisterNetworkType(entity.id, entity.type);
-            entity.x = pos.x;
-            entity.y = pos.y;
-            entity.vx = vel.dx;
-            entity.vy = vel.dy;
-            entity.health = 1;
-            entity.flags = flags;
-            entity.ownerHash = 0;
-            entity.score = 0;
-            m_entities.push_back(entity);
-        }
-
-        auto mines = m_registry.GetEntitiesWithComponent<RType::ECS::Mine>();
-        for (auto mineEntity : mines) {
-            if (!m_registry.IsEntityAlive(mineEntity) ||
-                !m_registry.HasComponent<Position>(mineEntity)) {
-                continue;
-            }
-
-            const auto& pos = m_registry.GetComponent<Position>(mineEntity);
-            const auto& mine = m_registry.GetComponent<RType::ECS::Mine>(mineEntity);
-
-            GameEntity entity;
-            entity.id = GetOrAssignNetworkId(mineEntity);
-            entity.type = EntityType::BULLET;
-            RegisterNetworkType(entity.id, entity.type);
-            entity.x = pos.x;
-            entity.y = pos.y;
-            entity.vx = 0.0f;
-            entity.vy = 0.0f;
-            entity.health = 1;
-            entity.flags = mine.isExploding ? 20 : 19;
-            entity.ownerHash = 0;
-            entity.score = 0;
-            m_entities.push_back(entity);
-        }
-
-        auto obstacles = m_registry.GetEntitiesWithComponent<Obstacle>();
-        const size_t maxObstaclesPerSnapshot = 256;
-
-        static bool loggedObstacleCount = false;
-        if (!loggedObstacleCount) {
-            std::cout << "[SERVER OBSTACLE SYNC] Total obstacles with Obstacle component: " << obstacles.size() << std::endl;
-            loggedObstacleCount = true;
-        }
-
-        size_t obstacleCount = 0;
-        static int serverObstacleLog = 0;
-        for (auto obstacleEntity : obstacles) {
-            if (!m_registry.IsEntityAlive(obstacleEntity) ||
-                !m_registry.HasComponent<Position>(obstacleEntity)) {
-                continue;
-            }
-
-            bool contaminated = false;
-            if (m_registry.HasComponent<Velocity>(obstacleEntity) ||
-                m_registry.HasComponent<Bullet>(obstacleEntity) ||
-                m_registry.HasComponent<Shooter>(obstacleEntity) ||
-                m_registry.HasComponent<WeaponSlot>(obstacleEntity)) {
-                contaminated = true;
-            }
-            if (contaminated) {
-                std::cerr << "[SERVER OBSTACLE SCRUB] Entity " << obstacleEntity
-                          << " had invalid components (Velocity/Bullet/Shooter/WeaponSlot); "
-                          << "removing Obstacle/ObstacleMetadata to prevent desync." << std::endl;
-                if (m_registry.HasComponent<Obstacle>(obstacleEntity)) {
-                    m_registry.RemoveComponent<Obstacle>(obstacleEntity);
+                    state.flags = 10 + enemyType;
                 }
-                if (m_registry.HasComponent<ObstacleMetadata>(obstacleEntity)) {
-                    m_registry.RemoveComponent<ObstacleMetadata>(obstacleEntity);
+                state.health = 1;
+            }});
+
+        m_replicator.AddType({EntityType::BULLET, Registry::MakeSignature<Mine, Position>(), {},
+            Registry::MakeSignature<Mine, Position>(), 0,
+            [](const Registry& registry, Entity mineEntity, EntityState& state) {
+                Replication::CaptureComponents<Position>(registry, mineEntity, state);
+                state.health = 1;
+                state.flags = registry.GetComponent<Mine>(mineEntity).isExploding ? 20 : 19;
+            }});
+
+        // Obstacles travel in level space: constant for LevelSpace geometry, so an
+        // unchanged obstacle costs nothing. Screen-space ones follow the scroll
+        // offset, which no component records, so they are listed without inputs.
+        // Both kinds draw on one MAX_OBSTACLES_PER_SNAPSHOT budget, level space first.
+        m_replicator.AddType({EntityType::OBSTACLE, Registry::MakeSignature<Obstacle, Position, LevelSpace>(), {},
+            Registry::MakeSignature<Position, ObstacleMetadata>(), MAX_OBSTACLES_PER_SNAPSHOT,
+            [](const Registry& registry, Entity obstacleEntity, EntityState& state) {
+                Replication::CaptureComponents<Position>(registry, obstacleEntity, state);
+                state.health = 255;
+                if (registry.HasComponent<ObstacleMetadata>(obstacleEntity)) {
+                    state.ownerHash = registry.GetComponent<ObstacleMetadata>(obstacleEntity).uniqueId;
                 }
-                if (m_registry.HasComponent<Velocity>(obstacleEntity)) {
-                    m_registry.RemoveComponent<Velocity>(obstacleEntity);
+            }});
+        m_replicator.AddType({EntityType::OBSTACLE, Registry::MakeSignature<Obstacle, Position>(),
+            Registry::MakeSignature<LevelSpace>(), {},
+            MAX_OBSTACLES_PER_SNAPSHOT,
+            [this](const Registry& registry, Entity obstacleEntity, EntityState& state) {
+                const auto& pos = registry.GetComponent<Position>(obstacleEntity);
+                state.x = pos.x - m_scrollOffset;
+                state.y = pos.y;
+                state.health = 255;
+                if (registry.HasComponent<ObstacleMetadata>(obstacleEntity)) {
+                    state.ownerHash = registry.GetComponent<ObstacleMetadata>(obstacleEntity).uniqueId;
                 }
-                continue;
-            }
-
-            if (m_registry.HasComponent<Bullet>(obstacleEntity) ||
-                m_registry.HasComponent<Shooter>(obstacleEntity) ||
-                m_registry.HasComponent<WeaponSlot>(obstacleEntity)) {
-                std::cerr << "[SERVER BUG] Entity " << obstacleEntity
-                          << " has Obstacle + Bullet/Shooter; removing Obstacle to avoid desync." << std::endl;
-                if (m_registry.HasComponent<Obstacle>(obstacleEntity)) {
-                    m_registry.RemoveComponent<Obstacle>(obstacleEntity);
+            }});
+
+        m_replicator.AddType({EntityType::POWERUP, Registry::MakeSignature<PowerUp, Position, Velocity>(), {},
+            Registry::MakeSignature<PowerUp, Position, Velocity>(), 0,
+            [](const Registry& registry, Entity powerupEntity, EntityState& state) {
+                Replication::CaptureComponents<Position, Velocity>(registry, powerupEntity, state);
+                state.health = 1;
+                state.flags = static_cast<uint8_t>(registry.GetComponent<PowerUp>(powerupEntity).type);
+            }});
+
+        // Pods are sent as player entities flagged 0x80 and follow their owner's
+        // Player: rebuilt every tick, like players
+        m_replicator.AddType({EntityType::PLAYER, Registry::MakeSignature<ForcePod, Position>(), {}, {}, 0,
+            [](const Registry& registry, Entity podEntity, EntityState& state) {
+                Replication::CaptureComponents<Position>(registry, podEntity, state);
+                const auto& pod = registry.GetComponent<ForcePod>(podEntity);
+                if (registry.IsEntityAlive(pod.owner) && registry.HasComponent<Player>(pod.owner)) {
+                    state.ownerHash = registry.GetComponent<Player>(pod.owner).playerHash;
                 }
-                if (m_registry.HasComponent<ObstacleMetadata>(obstacleEntity)) {
-                    m_registry.RemoveComponent<ObstacleMetadata>(obstacleEntity);
+                if (registry.HasComponent<Velocity>(podEntity)) {
+                    Replication::CaptureComponents<Velocity>(registry, podEntity, state);
                 }
-                continue;
-            }
-
-            const auto& pos = m_registry.GetComponent<Position>(obstacleEntity);
+                state.health = 1;
+                state.flags = 0x80;
+            }});
+    }
 
-            static int broadcastLog = 0;
-            if (broadcastLog < 10 || (broadcastLog % 100 == 0)) {
-                std::cerr << "[OBSTACLE BROADCAST] Entity " << obstacleEntity
-                          << " pos=(" << pos.x << "," << pos.y << ")"
-                          << " hasVelocity=" << m_registry.HasComponent<Velocity>(obstacleEntity)
-                          << " hasBullet=" << m_registry.HasComponent<Bullet>(obstacleEntity) << std::endl;
-                broadcastLog++;
-            }
+    void GameServer::ScrubObstacleComponents() {
+        using namespace RType::ECS;
 
-            if (serverObstacleLog < 5) {
-                std::cout << "[SERVER SEND] Obstacle " << obstacleEntity
-                          << " sending pos=(" << pos.x << "," << pos.y << ")";
-                if (m_registry.HasComponent<RType::ECS::ObstacleMetadata>(obstacleEntity)) {
-                    const auto& meta = m_registry.GetComponent<RType::ECS::ObstacleMetadata>(obstacleEntity);
-                    std::cout << " uniqueId=" << meta.uniqueId
-                              << " visualEntity=" << meta.visualEntity
-                              << " offset=(" << meta.offsetX << "," << meta.offsetY << ")";
+        for (auto bulletEntity : m_registry.GetEntitiesWithComponent<Bullet>()) {
+            if (m_registry.HasComponent<Obstacle>(bulletEntity) ||
+                m_registry.HasComponent<ObstacleMetadata>(bulletEntity)) {
+                std::cerr << "[SERVER CLEANUP] Bullet entity " << bulletEntity
+                          << " had Obstacle components; removing to prevent obstacle desync." << std::endl;
+                if (m_registry.HasComponent<Obstacle>(bulletEntity)) {
+                    m_registry.RemoveComponent<Obstacle>(bulletEntity);
+                }
+                if (m_registry.HasComponent<ObstacleMetadata>(bulletEntity)) {
+                    m_registry.RemoveComponent<ObstacleMetadata>(bulletEntity);
                 }
-                std::cout << std::endl;
-                serverObstacleLog++;
-            }
-
-            GameEntity entity;
-            entity.id = GetOrAssignNetworkId(obstacleEntity);
-            entity.type = EntityType::OBSTACLE;
-            RegisterNetworkType(entity.id, entity.type);
-            entity.x = pos.x;
-            entity.y = pos.y;
-            entity.vx = 0.0f;
-            entity.vy = 0.0f;
-            entity.health = 255;
-            entity.flags = 0;
-            uint64_t obstacleIndex = 0;
-            if (m_registry.HasComponent<RType::ECS::ObstacleMetadata>(obstacleEntity)) {
-                obstacleIndex = m_registry.GetComponent<RType::ECS::ObstacleMetadata>(obstacleEntity).uniqueId;
-            }
-            entity.ownerHash = obstacleIndex;
-            entity.score = 0;
-
-            m_entities.push_back(entity);
-            obstacleCount++;
-            if (obstacleCount >= maxObstaclesPerSnapshot) {
-                break;
             }
         }
 
-        static bool loggedObstacleSend = false;
-        if (!loggedObstacleSend) {
-            std::cout << "[SERVER OBSTACLE SYNC] Added " << obstacleCount << " obstacles to network snapshot" << std::endl;
-            loggedObstacleSend = true;
-        }
-
-        auto powerups = m_registry.GetEntitiesWithComponent<PowerUp>();
-        for (auto powerupEntity : powerups) {
-            if (!m_registry.IsEntityAlive(powerupEntity) ||
-                !m_registry.HasComponent<Position>(powerupEntity) ||
-                !m_registry.HasComponent<Velocity>(powerupEntity)) {
+        const Signature& contaminants = Registry::MakeSignature<Velocity, Bullet, Shooter, WeaponSlot>();
+        for (auto obstacleEntity : m_registry.GetEntitiesWithComponent<Obstacle>()) {
+            if (!(m_registry.GetSignature(obstacleEntity) & contaminants).any()) {
                 continue;
             }
-
-            const auto& pos = m_registry.GetComponent<Position>(powerupEntity);
-            const auto& vel = m_registry.GetComponent<Velocity>(powerupEntity);
-            const auto& powerup = m_registry.GetComponent<PowerUp>(powerupEntity);
-
-            GameEntity entity;
-            entity.id = GetOrAssignNetworkId(powerupEntity);
-            entity.type = EntityType::POWERUP;
-            RegisterNetworkType(entity.id, entity.type);
-            entity.x = pos.x;
-            entity.y = pos.y;
-            entity.vx = vel.dx;
-            entity.vy = vel.dy;
-            entity.health = 1;
-            entity.flags = static_cast<uint8_t>(powerup.type);
-            entity.ownerHash = 0;
-            m_entities.push_back(entity);
-        }
-
-        auto forcePods = m_registry.GetEntitiesWithComponent<ForcePod>();
-        for (auto podEntity : forcePods) {
-            if (!m_registry.IsEntityAlive(podEntity) ||
-                !m_registry.HasComponent<Position>(podEntity)) {
-                continue;
+            std::cerr << "[SERVER OBSTACLE SCRUB] Entity " << obstacleEntity
+                      << " had invalid components (Velocity/Bullet/Shooter/WeaponSlot); "
+                      << "removing Obstacle/ObstacleMetadata to prevent desync." << std::endl;
+            m_registry.RemoveComponent<Obstacle>(obstacleEntity);
+            if (m_registry.HasComponent<ObstacleMetadata>(obstacleEntity)) {
+                m_registry.RemoveComponent<ObstacleMetadata>(obstacleEntity);
             }
-
-            const auto& pos = m_registry.GetComponent<Position>(podEntity);
-            const auto& pod = m_registry.GetComponent<ForcePod>(podEntity);
-
-            uint64_t ownerHash = 0;
-            if (m_registry.IsEntityAlive(pod.owner) &&
-                m_registry.HasComponent<Player>(pod.owner)) {
-                const auto& owner = m_registry.GetComponent<Player>(pod.owner);
-                ownerHash = owner.playerHash;
+            if (m_registry.HasComponent<Velocity>(obstacleEntity)) {
+                m_registry.RemoveComponent<Velocity>(obstacleEntity);
             }
+        }
+    }
 
-            float vx = 0.0f, vy = 0.0f;
-            if (m_registry.HasComponent<Velocity>(podEntity)) {
-                const auto& vel = m_registry.GetComponent<Velocity>(podEntity);
-                vx = vel.dx;
-                vy = vel.dy;
-            }
+    void GameServer::UpdateReplicatedStates() {
+        using namespace RType::ECS;
 
-            GameEntity entity;
-            entity.id = GetOrAssignNetworkId(podEntity);
-            entity.type = EntityType::PLAYER;
-            RegisterNetworkType(entity.id, entity.type);
-            entity.x = pos.x;
-            entity.y = pos.y;
-            entity.vx = vx;
-            entity.vy = vy;
-            entity.health = 1;
-            entity.flags = 0x80;
-            entity.ownerHash = ownerHash;
-            m_entities.push_back(entity);
-        }
+        ScrubObstacleComponents();
+        m_replicator.Update(m_registry);
     }
 
     EnemyType GameServer::GetRandomEnemyType() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_int_distribution<int> dist(0, 2);
-        return static_cast<EnemyType>(dist(gen));
+        return static_cast<EnemyType>(m_rng.NextInt(0, 2));
     }
 
     const EnemyStats& GameServer::GetEnemyStats(EnemyType type) const {
@@ -1460,130 +1237,114 @@ namespace network {
         }
     }
 
-    void GameServer::LoadNextLevelIfNeeded() {
-        if (m_waitingForLevelTransition) {
-            m_levelTransitionTimer += (1.0f / 60.0f);
-
-            const float TRANSITION_DELAY = 0.1f;
-            if (m_levelTransitionTimer >= TRANSITION_DELAY) {
-                std::cout << "[GameServer] Transition delay complete - loading next level" << std::endl;
-                m_waitingForLevelTransition = false;
-
-                m_currentLevel++;
-                std::string nextLevelPath = "assets/levels/level" + std::to_string(m_currentLevel) + ".json";
-
-                std::cout << "[GameServer] Loading next level: " << nextLevelPath << std::endl;
-                std::cout << "[GameServer] Entity count before cleanup: " << m_registry.GetEntityCount() << std::endl;
-
-                std::vector<RType::ECS::Entity> toDestroy;
-
-                auto positionEntities = m_registry.GetEntitiesWithComponent<RType::ECS::Position>();
-                std::cout << "[GameServer] Found " << positionEntities.size() << " entities with Position" << std::endl;
+    void GameServer::PreloadNextLevel() {
+        const int levelNumber = m_currentLevel + 1;
+        std::string path = "assets/levels/level" + std::to_string(levelNumber) + ".json";
+        std::cout << "[GameServer] Preloading level " << levelNumber << " from " << path << std::endl;
+
+        // Only level data is touched here; the registry stays with the tick thread
+        m_nextLevel = std::async(std::launch::async, [levelNumber, path]() {
+            PreloadedLevel level;
+            level.levelNumber = levelNumber;
+            level.path = path;
+            try {
+                level.data = RType::ECS::LevelLoader::LoadFromFile(path);
+                level.streamer.Prepare(level.data);
+                level.loaded = true;
+            } catch (const std::exception& e) {
+                std::cerr << "[GameServer] Failed to load level " << levelNumber << ": " << e.what() << std::endl;
+            }
+            return level;
+        });
+    }
 
-                auto colliderEntities = m_registry.GetEntitiesWithComponent<RType::ECS::BoxCollider>();
-                std::cout << "[GameServer] Found " << colliderEntities.size() << " entities with BoxCollider" << std::endl;
+    void GameServer::CleanupLevelEntities() {
+        std::unordered_set<RType::ECS::Entity> entitySet;
 
-                auto drawableEntities = m_registry.GetEntitiesWithComponent<RType::ECS::Drawable>();
-                std::cout << "[GameServer] Found " << drawableEntities.size() << " entities with Drawable" << std::endl;
+        for (auto entity : m_registry.GetEntitiesWithComponent<RType::ECS::Position>()) {
+            if (!m_registry.HasComponent<RType::ECS::Player>(entity)) {
+                entitySet.insert(entity);
+            }
+        }
+        for (auto entity : m_registry.GetEntitiesWithComponent<RType::ECS::BoxCollider>()) {
+            if (!m_registry.HasComponent<RType::ECS::Player>(entity)) {
+                entitySet.insert(entity);
+            }
+        }
+        for (auto entity : m_registry.GetEntitiesWithComponent<RType::ECS::Drawable>()) {
+            if (!m_registry.HasComponent<RType::ECS::Player>(entity)) {
+                entitySet.insert(entity);
+            }
+        }
 
-                std::unordered_set<RType::ECS::Entity> entitySet;
+        for (RType::ECS::Entity entity : entitySet) {
+            m_registry.DestroyEntity(entity);
+        }
 
-                for (auto entity : positionEntities) {
-                    if (!m_registry.HasComponent<RType::ECS::Player>(entity)) {
-                        entitySet.insert(entity);
-                    }
-                }
+        std::cout << "[GameServer] Destroyed " << entitySet.size() << " non-player entities" << std::endl;
+    }
 
-                for (auto entity : colliderEntities) {
-                    if (!m_registry.HasComponent<RType::ECS::Player>(entity)) {
-                        entitySet.insert(entity);
-                    }
-                }
+    void GameServer::LoadNextLevelIfNeeded() {
+        if (!m_waitingForLevelTransition) {
+            return;
+        }
 
-                for (auto entity : drawableEntities) {
-                    if (!m_registry.HasComponent<RType::ECS::Player>(entity)) {
-                        entitySet.insert(entity);
-                    }
-                }
+        m_levelTransitionTimer += (1.0f / 60.0f);
+        const float TRANSITION_DELAY = 0.1f;
+        if (m_levelTransitionTimer < TRANSITION_DELAY) {
+            return;
+        }
 
-                toDestroy.assign(entitySet.begin(), entitySet.end());
+        // Normally started when the boss spawned; a level without a boss starts it now
+        if (!m_nextLevel.valid()) {
+            PreloadNextLevel();
+        }
+        // Never block the tick: keep simulating the empty level until the loader is done
+        if (m_nextLevel.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return;
+        }
 
-                std::cout << "[GameServer] Total unique entities to destroy: " << toDestroy.size() << std::endl;
+        PreloadedLevel next = m_nextLevel.get();
+        std::cout << "[GameServer] Switching to level " << next.levelNumber << std::endl;
+        m_waitingForLevelTransition = false;
+        m_currentLevel = next.levelNumber;
+        m_levelPath = next.path;
 
-                auto playerEntitiesVec = m_registry.GetEntitiesWithComponent<RType::ECS::Player>();
-                std::cout << "[GameServer] Preserving " << playerEntitiesVec.size() << " player entities:" << std::endl;
-                for (auto entity : playerEntitiesVec) {
-                    std::cout << "  - Player entity " << entity << std::endl;
-                }
+        CleanupLevelEntities();
 
-                for (RType::ECS::Entity entity : toDestroy) {
-                    m_registry.DestroyEntity(entity);
-                }
+        // Reset level state
+        m_bossDefeated = false;
+        m_levelComplete = false;
+        m_scrollOffset = 0.0f;
+        m_levelStreamer.Clear();
+        m_enemyShootCooldowns.clear();
+        m_enemyBulletTypes.clear();
 
-                std::cout << "[GameServer] Destroyed " << toDestroy.size() << " non-player entities (preserved " << playerEntitiesVec.size() << " players)" << std::endl;
-                std::cout << "[GameServer] Entity count after cleanup: " << m_registry.GetEntityCount() << std::endl;
+        if (!next.loaded) {
+            return;
+        }
 
-                std::vector<GameEntity> playerEntities;
-                for (const auto& ge : m_entities) {
-                    if (ge.type == EntityType::PLAYER) {
-                        playerEntities.push_back(ge);
-                    }
-                }
-                m_entities = playerEntities;
-
-                std::cout << "[GameServer] Kept " << m_entities.size() << " player GameEntity entries" << std::endl;
-
-                // Reset level state
-                m_bossDefeated = false;
-                m_levelComplete = false;
-                m_scrollOffset = 0.0f;
-                m_enemyShootCooldowns.clear();
-                m_enemyBulletTypes.clear();
-
-                // Load new level
-                m_levelPath = nextLevelPath;
-                try {
-                    auto levelData = RType::ECS::LevelLoader::LoadFromFile(m_levelPath);
-                    std::cout << "[GameServer] Level " << m_currentLevel << " loaded" << std::endl;
-
-                    auto createdEntities = RType::ECS::LevelLoader::CreateServerEntities(m_registry, levelData);
-                    std::cout << "[GameServer] Level entities created: "
-                              << createdEntities.obstacleColliders.size() << " obstacles, "
-                              << createdEntities.enemies.size() << " enemies, "
-                              << "boss: " << (createdEntities.boss != RType::ECS::NULL_ENTITY ? "YES" : "NO")
-                              << std::endl;
-
-                    auto playerEntities = m_registry.GetEntitiesWithComponent<RType::ECS::Player>();
-                    std::cout << "[GameServer] Repositioning " << playerEntities.size() << " players to spawn points" << std::endl;
-
-                    size_t spawnIndex = 0;
-                    for (auto playerEntity : playerEntities) {
-                        if (spawnIndex < levelData.playerSpawns.size()) {
-                            const auto& spawn = levelData.playerSpawns[spawnIndex];
-
-                            if (m_registry.HasComponent<RType::ECS::Position>(playerEntity)) {
-                                auto& pos = m_registry.GetComponent<RType::ECS::Position>(playerEntity);
-                                pos.x = spawn.x;
-                                pos.y = spawn.y;
-                                std::cout << "[GameServer] Player " << playerEntity << " repositioned to ("
-                                          << spawn.x << ", " << spawn.y << ")" << std::endl;
-                            }
-
-                            if (m_registry.HasComponent<RType::ECS::Health>(playerEntity)) {
-                                auto& health = m_registry.GetComponent<RType::ECS::Health>(playerEntity);
-                                health.current = health.max;
-                                std::cout << "[GameServer] Player " << playerEntity << " health reset to "
-                                          << health.max << std::endl;
-                            }
-
-                            spawnIndex++;
-                        }
-                    }
+        m_levelStreamer = std::move(next.streamer);
+        m_levelStreamer.Begin(m_registry);
+        std::cout << "[GameServer] Level " << m_currentLevel << " streaming: " << m_levelStreamer.GetTimelineSize()
+                  << " timeline items, " << m_levelStreamer.GetPendingCount() << " pending" << std::endl;
 
-                } catch (const std::exception& e) {
-                    std::cerr << "[GameServer] Failed to load level " << m_currentLevel << ": " << e.what() << std::endl;
-                }
+        const auto& spawns = next.data.playerSpawns;
+        size_t spawnIndex = 0;
+        for (auto playerEntity : m_registry.GetEntitiesWithComponent<RType::ECS::Player>()) {
+            if (spawnIndex >= spawns.size()) {
+                break;
+            }
+            if (m_registry.HasComponent<RType::ECS::Position>(playerEntity)) {
+                auto& pos = m_registry.GetComponent<RType::ECS::Position>(playerEntity);
+                pos.x = spawns[spawnIndex].x;
+                pos.y = spawns[spawnIndex].y;
+            }
+            if (m_registry.HasComponent<RType::ECS::Health>(playerEntity)) {
+                auto& health = m_registry.GetComponent<RType::ECS::Health>(playerEntity);
+                health.current = health.max;
             }
+            spawnIndex++;
         }
     }
 
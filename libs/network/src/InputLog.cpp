@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** InputLog implementation
+*/
+
+#include "InputLog.hpp"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace network {
+
+    bool InputLogWriter::Open(const std::string& path, uint64_t seed, const std::string& levelPath,
+        const std::vector<PlayerInfo>& players) {
+        m_file.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_file.is_open()) {
+            return false;
+        }
+
+        InputLogHeader header;
+        header.seed = seed;
+        header.playerCount = static_cast<uint8_t>(players.size());
+        header.levelPathLength = static_cast<uint16_t>(std::min(levelPath.size(),
+            static_cast<size_t>(std::numeric_limits<uint16_t>::max())));
+        m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_file.write(levelPath.data(), header.levelPathLength);
+
+        for (const auto& player : players) {
+            InputLogPlayer entry;
+            entry.hash = player.hash;
+            entry.number = player.number;
+            std::memcpy(entry.name, player.name, PLAYER_NAME_SIZE);
+            m_file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        }
+        return m_file.good();
+    }
+
+    void InputLogWriter::EndTick(uint32_t tick) {
+        m_lastTick = tick;
+        if (m_pending.empty() || !m_file.is_open()) {
+            m_pending.clear();
+            return;
+        }
+        uint16_t count = static_cast<uint16_t>(m_pending.size());
+        m_file.write(reinterpret_cast<const char*>(&tick), sizeof(tick));
+        m_file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        m_file.write(reinterpret_cast<const char*>(m_pending.data()), sizeof(InputLogEvent) * count);
+        m_pending.clear();
+    }
+
+    void InputLogWriter::Close() {
+        if (m_file.is_open()) {
+            uint16_t count = 0;
+            m_file.write(reinterpret_cast<const char*>(&m_lastTick), sizeof(m_lastTick));
+            m_file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            m_file.close();
+        }
+        m_pending.clear();
+    }
+
+    bool InputLogReader::Open(const std::string& path) {
+        m_file.open(path, std::ios::binary);
+        if (!m_file.is_open()) {
+            return false;
+        }
+        if (!m_file.read(reinterpret_cast<char*>(&m_header), sizeof(m_header)) ||
+            m_header.magic != INPUT_LOG_MAGIC || m_header.version != INPUT_LOG_VERSION) {
+            return false;
+        }
+
+        m_levelPath.resize(m_header.levelPathLength);
+        if (!m_file.read(m_levelPath.data(), m_header.levelPathLength)) {
+            return false;
+        }
+
+        m_players.clear();
+        for (uint8_t i = 0; i < m_header.playerCount; i++) {
+            InputLogPlayer entry;
+            if (!m_file.read(reinterpret_cast<char*>(&entry), sizeof(entry))) {
+                return false;
+            }
+            PlayerInfo player;
+            player.hash = entry.hash;
+            player.number = entry.number;
+            std::memcpy(player.name, entry.name, PLAYER_NAME_SIZE);
+            m_players.push_back(player);
+        }
+        return true;
+    }
+
+    bool InputLogReader::ReadTick(uint32_t& tick, std::vector<InputLogEvent>& events) {
+        uint16_t count = 0;
+        if (!m_file.read(reinterpret_cast<char*>(&tick), sizeof(tick)) ||
+            !m_file.read(reinterpret_cast<char*>(&count), sizeof(count))) {
+            return false;
+        }
+        events.resize(count);
+        return static_cast<bool>(m_file.read(reinterpret_cast<char*>(events.data()), sizeof(InputLogEvent) * count));
+    }
+
+}
@@ -0,0 +1,476 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** LoopbackNetworkModule implementation
+*/
+
+#include "LoopbackNetworkModule.hpp"
+#include <algorithm>
+#include <functional>
+
+namespace Network {
+
+    bool LoopbackNetworkModule::Initialize(RType::Core::Engine* /*engine*/) {
+        return true;
+    }
+
+    void LoopbackNetworkModule::Shutdown() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_udpSockets.clear();
+        m_tcpSockets.clear();
+        m_boundUdpPorts.clear();
+        m_tcpListeners.clear();
+        m_links.clear();
+        m_inFlight.clear();
+    }
+
+    SocketId LoopbackNetworkModule::CreateTcpSocket(const SocketConfig& /*config*/) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        SocketId id = m_nextSocketId++;
+        m_tcpSockets[id].localEndpoint = Endpoint(GetLocalAddress(), 0);
+        setLastError(SocketError::None);
+        return id;
+    }
+
+    bool LoopbackNetworkModule::ConnectTcp(SocketId socketId, const Endpoint& endpoint) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tcpSockets.find(socketId);
+        if (it == m_tcpSockets.end() || it->second.listening || it->second.peer != INVALID_SOCKET_ID) {
+            setLastError(SocketError::InvalidSocket);
+            return false;
+        }
+
+        auto listener = m_tcpListeners.find(endpoint.port);
+        if (listener == m_tcpListeners.end()) {
+            setLastError(SocketError::ConnectionRefused);
+            return false;
+        }
+        TcpSocketData& server = m_tcpSockets[listener->second];
+        if (server.acceptQueue.size() >= server.backlog) {
+            setLastError(SocketError::ConnectionRefused);
+            return false;
+        }
+
+        if (it->second.localEndpoint.port == 0) {
+            it->second.localEndpoint.port = AllocatePort();
+        }
+
+        // The accepted side shares the listener's port, like a real TCP server
+        SocketId acceptedId = m_nextSocketId++;
+        TcpSocketData& accepted = m_tcpSockets[acceptedId];
+        accepted.localEndpoint = Endpoint(GetLocalAddress(), endpoint.port);
+        accepted.peer = socketId;
+
+        it = m_tcpSockets.find(socketId);
+        it->second.peer = acceptedId;
+        m_tcpSockets[listener->second].acceptQueue.push_back(acceptedId);
+        setLastError(SocketError::None);
+        return true;
+    }
+
+    bool LoopbackNetworkModule::BindTcp(SocketId socketId, std::uint16_t port) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tcpSockets.find(socketId);
+        if (it == m_tcpSockets.end()) {
+            setLastError(SocketError::InvalidSocket);
+            return false;
+        }
+        if (port == 0) {
+            port = AllocatePort();
+        } else if (m_tcpListeners.count(port)) {
+            setLastError(SocketError::Unknown);
+            return false;
+        }
+        it->second.localEndpoint.port = port;
+        setLastError(SocketError::None);
+        return true;
+    }
+
+    bool LoopbackNetworkModule::ListenTcp(SocketId socketId, std::uint32_t backlog) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tcpSockets.find(socketId);
+        if (it == m_tcpSockets.end() || it->second.localEndpoint.port == 0 ||
+            m_tcpListeners.count(it->second.localEndpoint.port)) {
+            setLastError(SocketError::InvalidSocket);
+            return false;
+        }
+        it->second.listening = true;
+        it->second.backlog = std::max<std::uint32_t>(backlog, 1);
+        m_tcpListeners[it->second.localEndpoint.port] = socketId;
+        setLastError(SocketError::None);
+        return true;
+    }
+
+    std::optional<SocketId> LoopbackNetworkModule::AcceptTcp(SocketId serverSocketId, Endpoint& clientEndpoint) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tcpSockets.find(serverSocketId);
+        if (it == m_tcpSockets.end() || !it->second.listening) {
+            setLastError(SocketError::InvalidSocket);
+            return std::nullopt;
+        }
+        setLastError(SocketError::None);
+        if (it->second.acceptQueue.empty()) {
+            return std::nullopt;
+        }
+
+        SocketId acceptedId = it->second.acceptQueue.front();
+        it->second.acceptQueue.pop_front();
+        auto accepted = m_tcpSockets.find(acceptedId);
+        auto client = m_tcpSockets.find(accepted->second.peer);
+        if (client != m_tcpSockets.end()) {
+            clientEndpoint = client->second.localEndpoint;
+        }
+        return acceptedId;
+    }
+
+    bool LoopbackNetworkModule::SendTcp(SocketId socketId, const std::vector<std::uint8_t>& data) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_tcpSockets.find(socketId);
+        if (it == m_tcpSockets.end() || it->second.listening || it->second.peer == INVALID_SOCKET_ID) {
+            setLastError(SocketError::InvalidSocket);
+            return false;
+        }
+        auto peer = m_tcpSockets.find(it->second.peer);
+        if (it->second.peerClosed || peer == m_tcpSockets.end()) {
+            setLastError(SocketError::Disconnected);
+            return false;
+        }
+
+        std::uint16_t fromPort = it->second.localEndpoint.port;
+        std::uint16_t toPort = peer->second.localEndpoint.port;
+        auto arrival = Schedule(fromPort, toPort, data.size() + sizeof(std::uint32_t), true);
+
+        InFlight message;
+        message.deliverAt = *arrival;
+        message.order = m_nextOrder++;
+        message.tcp = true;
+        message.tcpTarget = it->second.peer;
+        message.packet.data = data;
+        m_inFlight.push_back(std::move(message));
+        std::push_heap(m_inFlight.begin(), m_inFlight.end(), std::greater<InFlight>());
+
+        m_stats.tcpMessagesSent++;
+        m_stats.tcpBytesSent += data.size();
+        setLastError(SocketError::None);
+        return true;
+    }
+
+    std::optional<std::vector<std::uint8_t>> LoopbackNetworkModule::ReceiveTcp(SocketId socketId, std::size_t maxSize) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        DeliverDue();
+
+        auto it = m_tcpSockets.find(socketId);
+        if (it == m_tcpSockets.end() || it->second.listening) {
+            setLastError(SocketError::InvalidSocket);
+            return std::nullopt;
+        }
+
+        auto& inbox = it->second.inbox;
+        if (inbox.empty()) {
+            setLastError(it->second.peerClosed ? SocketError::Disconnected : SocketError::None);
+            return std::nullopt;
+        }
+        if (inbox.front().size() > maxSize) {
+            // Same contract as AsioNetworkModule: an oversized message is discarded
+            inbox.pop_front();
+            setLastError(SocketError::BufferOverflow);
+            return std::nullopt;
+        }
+
+        std::vector<std::uint8_t> data = std::move(inbox.front());
+        inbox.pop_front();
+        setLastError(SocketError::None);
+        return data;
+    }
+
+    SocketId LoopbackNetworkModule::CreateUdpSocket(const SocketConfig& /*config*/) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        SocketId id = m_nextSocketId++;
+        m_udpSockets[id].localEndpoint = Endpoint(GetLocalAddress(), 0);
+        setLastError(SocketError::None);
+        return id;
+    }
+
+    bool LoopbackNetworkModule::BindUdp(SocketId socketId, std::uint16_t port) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_udpSockets.find(socketId);
+        if (it == m_udpSockets.end()) {
+            setLastError(SocketError::InvalidSocket);
+            return false;
+        }
+        if (port == 0) {
+            port = AllocatePort();
+        } else if (m_boundUdpPorts.count(port)) {
+            setLastError(SocketError::Unknown);
+            return false;
+        }
+        if (it->second.localEndpoint.port != 0) {
+            m_boundUdpPorts.erase(it->second.localEndpoint.port);
+        }
+        it->second.localEndpoint.port = port;
+        m_boundUdpPorts[port] = socketId;
+        setLastError(SocketError::None);
+        return true;
+    }
+
+    bool LoopbackNetworkModule::SendUdp(SocketId socketId, const std::vector<std::uint8_t>& data, const Endpoint& to) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_udpSockets.find(socketId);
+        if (it == m_udpSockets.end()) {
+            setLastError(SocketError::InvalidSocket);
+            return false;
+        }
+
+        // Unbound senders get an ephemeral port, like a real socket on first send
+        if (it->second.localEndpoint.port == 0) {
+            std::uint16_t port = AllocatePort();
+            it->second.localEndpoint.port = port;
+            m_boundUdpPorts[port] = socketId;
+        }
+
+        m_stats.datagramsSent++;
+        m_stats.bytesSent += data.size();
+        setLastError(SocketError::None);
+
+        // Like real UDP, a datagram lost on the way is still a successful send
+        auto arrival = Schedule(it->second.localEndpoint.port, to.port, data.size(), false);
+        if (!arrival) {
+            return true;
+        }
+
+        InFlight datagram;
+        datagram.deliverAt = *arrival;
+        datagram.order = m_nextOrder++;
+        datagram.packet.data = data;
+        datagram.packet.from = it->second.localEndpoint;
+        datagram.udpPort = to.port;
+        m_inFlight.push_back(std::move(datagram));
+        std::push_heap(m_inFlight.begin(), m_inFlight.end(), std::greater<InFlight>());
+        return true;
+    }
+
+    std::optional<ReceivedPacket> LoopbackNetworkModule::ReceiveUdp(SocketId socketId, std::size_t maxSize) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        DeliverDue();
+
+        auto it = m_udpSockets.find(socketId);
+        if (it == m_udpSockets.end()) {
+            setLastError(SocketError::InvalidSocket);
+            return std::nullopt;
+        }
+        setLastError(SocketError::None);
+        if (it->second.queue.empty()) {
+            return std::nullopt;
+        }
+
+        ReceivedPacket packet = std::move(it->second.queue.front());
+        it->second.queue.pop_front();
+        if (packet.data.size() > maxSize) {
+            packet.data.resize(maxSize);
+        }
+        return packet;
+    }
+
+    void LoopbackNetworkModule::CloseSocket(SocketId socketId) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto udp = m_udpSockets.find(socketId);
+        if (udp != m_udpSockets.end()) {
+            if (udp->second.localEndpoint.port != 0) {
+                m_boundUdpPorts.erase(udp->second.localEndpoint.port);
+            }
+            m_udpSockets.erase(udp);
+            return;
+        }
+
+        auto tcp = m_tcpSockets.find(socketId);
+        if (tcp == m_tcpSockets.end()) {
+            return;
+        }
+        if (tcp->second.listening) {
+            m_tcpListeners.erase(tcp->second.localEndpoint.port);
+            for (SocketId pending : tcp->second.acceptQueue) {
+                auto accepted = m_tcpSockets.find(pending);
+                if (accepted != m_tcpSockets.end()) {
+                    auto client = m_tcpSockets.find(accepted->second.peer);
+                    if (client != m_tcpSockets.end()) {
+                        client->second.peerClosed = true;
+                    }
+                    m_tcpSockets.erase(accepted);
+                }
+            }
+        } else {
+            auto peer = m_tcpSockets.find(tcp->second.peer);
+            if (peer != m_tcpSockets.end()) {
+                peer->second.peerClosed = true;
+            }
+        }
+        m_tcpSockets.erase(tcp);
+    }
+
+    bool LoopbackNetworkModule::IsSocketValid(SocketId socketId) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_udpSockets.count(socketId) || m_tcpSockets.count(socketId);
+    }
+
+    SocketError LoopbackNetworkModule::GetLastError() const {
+        return m_lastError;
+    }
+
+    SocketInfo LoopbackNetworkModule::GetSocketInfo(SocketId socketId) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        SocketInfo info{socketId, SocketType::UDP, Endpoint{}, false};
+        auto udp = m_udpSockets.find(socketId);
+        if (udp != m_udpSockets.end()) {
+            info.localEndpoint = udp->second.localEndpoint;
+            return info;
+        }
+        auto tcp = m_tcpSockets.find(socketId);
+        if (tcp != m_tcpSockets.end()) {
+            info.type = SocketType::TCP;
+            info.localEndpoint = tcp->second.localEndpoint;
+            info.connected = tcp->second.peer != INVALID_SOCKET_ID && !tcp->second.peerClosed;
+        }
+        return info;
+    }
+
+    Endpoint LoopbackNetworkModule::ResolveHostname(const std::string& hostname, std::uint16_t port) {
+        return Endpoint(hostname, port);
+    }
+
+    void LoopbackNetworkModule::AdvanceTime(double seconds) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (seconds > 0.0) {
+            m_now += seconds;
+        }
+    }
+
+    double LoopbackNetworkModule::GetTime() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_now;
+    }
+
+    double LoopbackNetworkModule::GetNextDeliveryTime() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_inFlight.empty() ? -1.0 : m_inFlight.front().deliverAt;
+    }
+
+    void LoopbackNetworkModule::SetConditions(const LinkConditions& conditions) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_defaultConditions = conditions;
+    }
+
+    void LoopbackNetworkModule::SetPortConditions(std::uint16_t port, const LinkConditions& conditions) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_portConditions[port] = conditions;
+    }
+
+    void LoopbackNetworkModule::ClearPortConditions(std::uint16_t port) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_portConditions.erase(port);
+    }
+
+    void LoopbackNetworkModule::SetSeed(std::uint32_t seed) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_rng.seed(seed);
+    }
+
+    LoopbackNetworkModule::Stats LoopbackNetworkModule::GetStats() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    const LinkConditions& LoopbackNetworkModule::GetConditions(std::uint16_t fromPort, std::uint16_t toPort) const {
+        auto it = m_portConditions.find(fromPort);
+        if (it == m_portConditions.end()) {
+            it = m_portConditions.find(toPort);
+        }
+        return it != m_portConditions.end() ? it->second : m_defaultConditions;
+    }
+
+    std::optional<double> LoopbackNetworkModule::Schedule(std::uint16_t fromPort, std::uint16_t toPort, std::size_t size, bool reliable) {
+        const LinkConditions& conditions = GetConditions(fromPort, toPort);
+
+        if (!reliable && conditions.lossRate > 0.0f && m_unit(m_rng) < conditions.lossRate) {
+            m_stats.datagramsLost++;
+            return std::nullopt;
+        }
+
+        LinkState& link = m_links[(static_cast<std::uint32_t>(fromPort) << 16) | toPort];
+        double departure = m_now;
+        if (conditions.bandwidth > 0) {
+            const double start = std::max(m_now, link.busyUntil);
+            const double queuedBytes = (start - m_now) * conditions.bandwidth;
+            if (!reliable && queuedBytes + static_cast<double>(size) > static_cast<double>(conditions.queueLimit)) {
+                m_stats.datagramsOverflowed++;
+                return std::nullopt;
+            }
+            link.busyUntil = start + static_cast<double>(size) / conditions.bandwidth;
+            departure = link.busyUntil;
+        }
+
+        double arrival = departure + conditions.latency;
+        if (conditions.jitter > 0.0) {
+            arrival += m_unit(m_rng) * conditions.jitter;
+        }
+        if (reliable) {
+            // TCP never overtakes itself
+            arrival = std::max(arrival, link.lastArrival);
+            link.lastArrival = arrival;
+        } else if (conditions.reorderRate > 0.0f && m_unit(m_rng) < conditions.reorderRate) {
+            arrival += conditions.reorderDelay;
+            m_stats.datagramsReordered++;
+        }
+        return arrival;
+    }
+
+    void LoopbackNetworkModule::DeliverDue() {
+        while (!m_inFlight.empty() && m_inFlight.front().deliverAt <= m_now) {
+            std::pop_heap(m_inFlight.begin(), m_inFlight.end(), std::greater<InFlight>());
+            InFlight message = std::move(m_inFlight.back());
+            m_inFlight.pop_back();
+
+            if (message.tcp) {
+                auto target = m_tcpSockets.find(message.tcpTarget);
+                if (target != m_tcpSockets.end()) {
+                    target->second.inbox.push_back(std::move(message.packet.data));
+                }
+                continue;
+            }
+
+            auto port = m_boundUdpPorts.find(message.udpPort);
+            if (port == m_boundUdpPorts.end()) {
+                m_stats.datagramsUnreachable++;
+                continue;
+            }
+            m_stats.datagramsDelivered++;
+            m_stats.bytesDelivered += message.packet.data.size();
+            m_udpSockets[port->second].queue.push_back(std::move(message.packet));
+        }
+    }
+
+    std::uint16_t LoopbackNetworkModule::AllocatePort() {
+        auto next = [this]() {
+            m_nextEphemeralPort = m_nextEphemeralPort == 65535 ? FIRST_EPHEMERAL_PORT : m_nextEphemeralPort + 1;
+        };
+        while (IsPortUsed(m_nextEphemeralPort)) {
+            next();
+        }
+        std::uint16_t port = m_nextEphemeralPort;
+        next();
+        return port;
+    }
+
+    bool LoopbackNetworkModule::IsPortUsed(std::uint16_t port) const {
+        if (m_boundUdpPorts.count(port) || m_tcpListeners.count(port)) {
+            return true;
+        }
+        for (const auto& [id, socket] : m_tcpSockets) {
+            if (socket.localEndpoint.port == port) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+}
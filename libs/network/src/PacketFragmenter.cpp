@@ -0,0 +1,155 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** PacketFragmenter implementation
+*/
+
+#include "PacketFragmenter.hpp"
+#include <cstring>
+#include <limits>
+
+namespace network {
+
+    std::vector<std::vector<uint8_t>> PacketFragmenter::Split(const std::vector<uint8_t>& packet, uint16_t messageId,
+        size_t maxDatagramSize) {
+        std::vector<std::vector<uint8_t>> datagrams;
+        if (packet.size() <= maxDatagramSize) {
+            datagrams.push_back(packet);
+            return datagrams;
+        }
+        if (maxDatagramSize <= sizeof(FragmentHeader)) {
+            return datagrams;
+        }
+
+        const size_t chunkSize = std::min(maxDatagramSize - sizeof(FragmentHeader),
+            static_cast<size_t>(std::numeric_limits<uint16_t>::max()));
+        const size_t fragmentCount = (packet.size() + chunkSize - 1) / chunkSize;
+        if (fragmentCount > std::numeric_limits<uint8_t>::max()) {
+            return datagrams;
+        }
+
+        datagrams.reserve(fragmentCount);
+        for (size_t i = 0; i < fragmentCount; i++) {
+            const size_t offset = i * chunkSize;
+            const size_t size = std::min(chunkSize, packet.size() - offset);
+
+            FragmentHeader header;
+            header.messageId = messageId;
+            header.fragmentIndex = static_cast<uint8_t>(i);
+            header.fragmentCount = static_cast<uint8_t>(fragmentCount);
+            header.fragmentSize = static_cast<uint16_t>(size);
+            header.offset = static_cast<uint32_t>(offset);
+            header.totalSize = static_cast<uint32_t>(packet.size());
+
+            std::vector<uint8_t> datagram(sizeof(FragmentHeader) + size);
+            std::memcpy(datagram.data(), &header, sizeof(FragmentHeader));
+            std::memcpy(datagram.data() + sizeof(FragmentHeader), packet.data() + offset, size);
+            datagrams.push_back(std::move(datagram));
+        }
+        return datagrams;
+    }
+
+    std::optional<std::vector<uint8_t>> FragmentReassembler::AddFragment(const std::vector<uint8_t>& datagram, double now) {
+        if (datagram.size() < sizeof(FragmentHeader)) {
+            m_stats.invalidFragments++;
+            return std::nullopt;
+        }
+
+        FragmentHeader header;
+        std::memcpy(&header, datagram.data(), sizeof(FragmentHeader));
+        if (header.type != static_cast<uint8_t>(GamePacket::FRAGMENT) || header.fragmentCount == 0 ||
+            header.fragmentIndex >= header.fragmentCount ||
+            datagram.size() != sizeof(FragmentHeader) + header.fragmentSize ||
+            static_cast<uint64_t>(header.offset) + header.fragmentSize > header.totalSize ||
+            header.totalSize > static_cast<uint32_t>(header.fragmentCount) * std::numeric_limits<uint16_t>::max()) {
+            m_stats.invalidFragments++;
+            return std::nullopt;
+        }
+        m_stats.fragmentsReceived++;
+
+        // Late piece of a packet that was already completed or superseded
+        if (m_config.dropStalePartials && m_hasCompleted && !IsNewer(header.messageId, m_lastCompletedId)) {
+            return std::nullopt;
+        }
+
+        auto it = m_pending.find(header.messageId);
+        if (it == m_pending.end()) {
+            if (m_pending.size() >= m_config.maxPendingPackets) {
+                // Evict the oldest partial to make room for the incoming one
+                auto oldest = m_pending.begin();
+                for (auto candidate = m_pending.begin(); candidate != m_pending.end(); ++candidate) {
+                    if (candidate->second.firstSeen < oldest->second.firstSeen) {
+                        oldest = candidate;
+                    }
+                }
+                m_pending.erase(oldest);
+                m_stats.timedOutPackets++;
+            }
+
+            PartialPacket partial;
+            partial.data.resize(header.totalSize);
+            partial.received.assign(header.fragmentCount, false);
+            partial.fragmentCount = header.fragmentCount;
+            partial.firstSeen = now;
+            it = m_pending.emplace(header.messageId, std::move(partial)).first;
+        }
+
+        PartialPacket& partial = it->second;
+        if (partial.fragmentCount != header.fragmentCount || partial.data.size() != header.totalSize) {
+            m_stats.invalidFragments++;
+            return std::nullopt;
+        }
+        if (partial.received[header.fragmentIndex]) {
+            return std::nullopt;
+        }
+
+        std::memcpy(partial.data.data() + header.offset, datagram.data() + sizeof(FragmentHeader), header.fragmentSize);
+        partial.received[header.fragmentIndex] = true;
+        partial.receivedCount++;
+
+        if (partial.receivedCount < partial.fragmentCount) {
+            return std::nullopt;
+        }
+
+        std::vector<uint8_t> packet = std::move(partial.data);
+        m_pending.erase(it);
+        m_stats.packetsReassembled++;
+
+        if (m_config.dropStalePartials) {
+            DropOlderThan(header.messageId);
+            m_hasCompleted = true;
+            m_lastCompletedId = header.messageId;
+        }
+        return packet;
+    }
+
+    void FragmentReassembler::DropOlderThan(uint16_t messageId) {
+        for (auto it = m_pending.begin(); it != m_pending.end();) {
+            if (IsNewer(messageId, it->first)) {
+                it = m_pending.erase(it);
+                m_stats.stalePackets++;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void FragmentReassembler::Expire(double now) {
+        for (auto it = m_pending.begin(); it != m_pending.end();) {
+            if (now - it->second.firstSeen > m_config.timeout) {
+                it = m_pending.erase(it);
+                m_stats.timedOutPackets++;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void FragmentReassembler::Clear() {
+        m_pending.clear();
+        m_hasCompleted = false;
+        m_lastCompletedId = 0;
+    }
+
+}
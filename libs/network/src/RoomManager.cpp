@@ -305,17 +305,23 @@ namespace network {
     }
 
     void RoomManager::handleStart(Room& room, size_t) {
-        if (!isRoomReady(room))
+        if (room.inGame || !isRoomReady(room))
             return;
 
         room.inGame = true;
+        room.countdownActive = false;
+        room.gameSeed = static_cast<uint32_t>(_rng());
 
         Serializer s;
-        s.writeU32(static_cast<uint32_t>(_rng()));
+        s.writeU32(room.gameSeed);
         s.writeU16(60);
         broadcastToRoom(room, LobbyPacket::GAME_START, s.finalize());
 
         std::cout << "[RoomManager] Game starting in room!" << std::endl;
+
+        if (_onGameStart) {
+            _onGameStart(room.id, room);
+        }
     }
 
     void RoomManager::handleDisconnect(Room& room, size_t clientIdx) {
@@ -395,9 +401,10 @@ namespace network {
                 room.countdownActive = false;
                 room.inGame = true;
                 room.lastBroadcastedSecond = -1;
+                room.gameSeed = static_cast<uint32_t>(_rng());
 
                 Serializer s;
-                s.writeU32(static_cast<uint32_t>(_rng()));
+                s.writeU32(room.gameSeed);
                 s.writeU16(60);
                 broadcastToRoom(room, LobbyPacket::GAME_START, s.finalize());
 
@@ -0,0 +1,149 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotBudget implementation
+*/
+
+#include "SnapshotBudget.hpp"
+#include "ReplicationSchema.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace network {
+
+    namespace {
+        constexpr uint8_t ENEMY_BULLET_FLAGS_START = 10;
+    }
+
+    float SnapshotPrioritizer::GetBaseWeight(const EntityState& state) {
+        switch (static_cast<EntityType>(state.entityType)) {
+        case EntityType::PLAYER:
+            return 10.0f;
+        case EntityType::BOSS:
+            return 8.0f;
+        case EntityType::BULLET:
+            return state.flags >= ENEMY_BULLET_FLAGS_START ? 6.0f : 3.0f;
+        case EntityType::ENEMY:
+            return 5.0f;
+        case EntityType::POWERUP:
+            return 4.0f;
+        case EntityType::OBSTACLE:
+            return 0.5f;
+        default:
+            return 1.0f;
+        }
+    }
+
+    float SnapshotPrioritizer::GetRelevance(const EntityState& state, const EntityState* viewer, const SnapshotBudgetConfig& config) {
+        if (!viewer || config.relevanceRadius <= 0.0f) {
+            return 1.0f;
+        }
+        const float dx = state.x - viewer->x;
+        const float dy = state.y - viewer->y;
+        const float distance = std::sqrt(dx * dx + dy * dy);
+        return std::max(config.minRelevance, 1.0f - distance / config.relevanceRadius);
+    }
+
+    float SnapshotPrioritizer::GetChangePriority(uint8_t deltaFlags) {
+        return Replication::EntitySchema::GetPriority(deltaFlags);
+    }
+
+    uint8_t SnapshotPrioritizer::ComputeDeltaFlags(const EntityState& oldState, const EntityState& newState, const SnapshotBudgetConfig& config) {
+        return Replication::EntitySchema::ComputeDeltaFlags(oldState, newState, config);
+    }
+
+    size_t SnapshotPrioritizer::GetDeltaFieldsSize(uint8_t deltaFlags) {
+        return Replication::EntitySchema::GetFieldsSize(deltaFlags);
+    }
+
+    void SnapshotPrioritizer::AppendDeltaFields(std::vector<uint8_t>& out, const EntityState& state, uint8_t deltaFlags) {
+        Replication::EntitySchema::Write(out, state, deltaFlags);
+    }
+
+    SnapshotSelection SnapshotPrioritizer::SelectEntities(ClientSnapshotState& snapshot,
+        const std::unordered_map<uint32_t, EntityState>& currentStates, const std::unordered_set<uint32_t>& changedIds,
+        const EntityState* viewer, const SnapshotBudgetConfig& config, size_t usedBytes) {
+        struct Candidate {
+            uint32_t id;
+            uint8_t deltaFlags;
+            bool full;
+            size_t cost;
+            float priority;
+        };
+        std::vector<Candidate> candidates;
+
+        // Only entities rebuilt this tick, or still owed to this client, can differ
+        // from what it last received; the rest are not diffed at all
+        std::vector<uint32_t> candidateIds(changedIds.begin(), changedIds.end());
+        for (const auto& [id, pending] : snapshot.pending) {
+            candidateIds.push_back(id);
+        }
+        candidateIds.insert(candidateIds.end(), snapshot.needsFullResend.begin(), snapshot.needsFullResend.end());
+        std::sort(candidateIds.begin(), candidateIds.end());
+        candidateIds.erase(std::unique(candidateIds.begin(), candidateIds.end()), candidateIds.end());
+
+        for (uint32_t id : candidateIds) {
+            auto stateIt = currentStates.find(id);
+            if (stateIt == currentStates.end()) {
+                snapshot.pending.erase(id);
+                snapshot.needsFullResend.erase(id);
+                continue;
+            }
+            const EntityState& state = stateIt->second;
+            auto lastIt = snapshot.lastSent.find(id);
+            bool full = lastIt == snapshot.lastSent.end() || snapshot.needsFullResend.count(id) > 0;
+            uint8_t deltaFlags = full ? 0 : ComputeDeltaFlags(lastIt->second, state, config);
+            if (!full && deltaFlags == 0) {
+                snapshot.pending.erase(id);
+                continue;
+            }
+
+            PendingEntity& pending = snapshot.pending[id];
+            pending.priority += GetBaseWeight(state) *
+                                GetChangePriority(deltaFlags) *
+                                GetRelevance(state, viewer, config);
+            pending.waitingTicks++;
+
+            size_t cost = full ? sizeof(EntityState)
+                               : sizeof(DeltaEntityHeader) + GetDeltaFieldsSize(deltaFlags);
+            candidates.push_back({id, deltaFlags, full, cost, pending.priority});
+        }
+
+        std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+            if (a.priority != b.priority) {
+                return a.priority > b.priority;
+            }
+            return a.id < b.id;
+        });
+
+        SnapshotSelection selection;
+        for (const auto& candidate : candidates) {
+            if (usedBytes + candidate.cost > config.maxPacketBytes) {
+                selection.deferred++;
+                selection.maxStarvation = std::max(selection.maxStarvation, snapshot.pending[candidate.id].waitingTicks);
+                continue;
+            }
+            usedBytes += candidate.cost;
+
+            const EntityState& state = currentStates.at(candidate.id);
+            if (candidate.full) {
+                selection.newEntities.push_back(state);
+                snapshot.lastSent[candidate.id] = state;
+                snapshot.needsFullResend.erase(candidate.id);
+            } else {
+                selection.deltaUpdates.push_back({candidate.id, candidate.deltaFlags});
+                AppendDeltaFields(selection.deltaData, state, candidate.deltaFlags);
+                EntityState& lastSent = snapshot.lastSent[candidate.id];
+                lastSent = ApplyDelta(lastSent, state, candidate.deltaFlags);
+            }
+            snapshot.pending.erase(candidate.id);
+        }
+        return selection;
+    }
+
+    EntityState SnapshotPrioritizer::ApplyDelta(const EntityState& oldState, const EntityState& newState, uint8_t deltaFlags) {
+        return Replication::EntitySchema::Apply(oldState, newState, deltaFlags);
+    }
+
+}
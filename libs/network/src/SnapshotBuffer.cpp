@@ -0,0 +1,181 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotBuffer implementation
+*/
+
+#include "SnapshotBuffer.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace network {
+
+    namespace {
+        constexpr float JITTER_GAIN = 1.0f / 16.0f;   // RFC 3550 interarrival jitter estimator
+        constexpr float INTERVAL_GAIN = 0.1f;
+        constexpr double CLOCK_DRIFT_GAIN = 0.01;
+        constexpr float VELOCITY_MISMATCH_MIN = 8.0f;
+
+        float Hermite(float p0, float v0, float p1, float v1, float span, float t) {
+            const float t2 = t * t;
+            const float t3 = t2 * t;
+            const float h00 = 2.0f * t3 - 3.0f * t2 + 1.0f;
+            const float h10 = t3 - 2.0f * t2 + t;
+            const float h01 = -2.0f * t3 + 3.0f * t2;
+            const float h11 = t3 - t2;
+            return h00 * p0 + h10 * span * v0 + h01 * p1 + h11 * span * v1;
+        }
+    }
+
+    void SnapshotBuffer::OnSnapshotReceived(uint32_t serverTick, double localTime) {
+        const double serverTime = TickToTime(serverTick);
+        const double offset = localTime - serverTime;
+
+        if (!m_hasClock) {
+            m_hasClock = true;
+            m_clockOffset = offset;
+            m_lastArrival = localTime;
+            m_lastServerTime = serverTime;
+            m_latestTick = serverTick;
+            m_playoutDelay = GetTargetPlayoutDelay();
+            return;
+        }
+
+        if (serverTick <= m_latestTick) {
+            return;
+        }
+
+        const double transitDelta = (localTime - m_lastArrival) - (serverTime - m_lastServerTime);
+        m_jitter += (static_cast<float>(std::abs(transitDelta)) - m_jitter) * JITTER_GAIN;
+
+        const float serverDelta = static_cast<float>(serverTime - m_lastServerTime);
+        m_snapshotInterval += (serverDelta - m_snapshotInterval) * INTERVAL_GAIN;
+
+        // The least-delayed packet gives the best estimate of the clock offset; follow
+        // it immediately downward, and only drift upward slowly (server tick slowdowns).
+        if (offset < m_clockOffset) {
+            m_clockOffset = offset;
+        } else {
+            m_clockOffset += (offset - m_clockOffset) * CLOCK_DRIFT_GAIN;
+        }
+
+        m_lastArrival = localTime;
+        m_lastServerTime = serverTime;
+        m_latestTick = serverTick;
+    }
+
+    void SnapshotBuffer::PushEntityState(uint32_t serverTick, const EntityState& state) {
+        EntityHistory& history = m_entities[state.entityId];
+
+        HistorySample sample;
+        sample.tick = serverTick;
+        sample.x = state.x;
+        sample.y = state.y;
+        sample.vx = state.vx;
+        sample.vy = state.vy;
+
+        if (history.count > 0) {
+            const uint32_t newestTick = history.At(0).tick;
+            if (serverTick == newestTick) {
+                history.samples[history.head] = sample;
+                return;
+            }
+            if (serverTick < newestTick) {
+                return;
+            }
+            history.head = (history.head + 1) % HISTORY_SIZE;
+        }
+
+        history.samples[history.head] = sample;
+        history.count = std::min(history.count + 1, HISTORY_SIZE);
+    }
+
+    void SnapshotBuffer::Update(float dt) {
+        const float target = GetTargetPlayoutDelay();
+        const float blend = std::min(1.0f, m_config.delayAdaptRate * dt);
+        m_playoutDelay += (target - m_playoutDelay) * blend;
+    }
+
+    float SnapshotBuffer::GetTargetPlayoutDelay() const {
+        const float target = m_snapshotInterval + m_config.jitterMultiplier * m_jitter;
+        return std::clamp(target, m_config.minPlayoutDelay, m_config.maxPlayoutDelay);
+    }
+
+    double SnapshotBuffer::GetRenderTime(double localTime) const {
+        return localTime - m_clockOffset - static_cast<double>(m_playoutDelay);
+    }
+
+    bool SnapshotBuffer::Sample(uint32_t entityId, double renderTime, float& outX, float& outY) const {
+        auto it = m_entities.find(entityId);
+        if (it == m_entities.end() || it->second.count == 0) {
+            return false;
+        }
+        const EntityHistory& history = it->second;
+
+        const auto& newest = history.At(0);
+        const double newestTime = TickToTime(newest.tick);
+        if (renderTime >= newestTime) {
+            const float ahead = static_cast<float>(std::min(renderTime - newestTime, static_cast<double>(m_config.maxExtrapolation)));
+            if (ahead > 0.0f) {
+                m_extrapolatedSamples++;
+            }
+            outX = newest.x + newest.vx * ahead;
+            outY = newest.y + newest.vy * ahead;
+            return true;
+        }
+
+        for (size_t age = 0; age + 1 < history.count; age++) {
+            const auto& to = history.At(age);
+            const auto& from = history.At(age + 1);
+            const double fromTime = TickToTime(from.tick);
+            if (fromTime > renderTime) {
+                continue;
+            }
+
+            const float span = static_cast<float>(TickToTime(to.tick) - fromTime);
+            const float dx = to.x - from.x;
+            const float dy = to.y - from.y;
+            if (span <= 0.0f || std::sqrt(dx * dx + dy * dy) > m_config.teleportDistance) {
+                outX = to.x;
+                outY = to.y;
+                return true;
+            }
+
+            const float t = static_cast<float>(renderTime - fromTime) / span;
+
+            // Velocities that do not explain the observed displacement (scripted
+            // movement, collisions) would make the curve overshoot: blend linearly.
+            const float expectedDx = (from.vx + to.vx) * 0.5f * span;
+            const float expectedDy = (from.vy + to.vy) * 0.5f * span;
+            const float tolerance = std::max(VELOCITY_MISMATCH_MIN, 0.5f * std::sqrt(dx * dx + dy * dy));
+            if (std::abs(expectedDx - dx) > tolerance || std::abs(expectedDy - dy) > tolerance) {
+                outX = from.x + dx * t;
+                outY = from.y + dy * t;
+                return true;
+            }
+
+            outX = Hermite(from.x, from.vx, to.x, to.vx, span, t);
+            outY = Hermite(from.y, from.vy, to.y, to.vy, span, t);
+            return true;
+        }
+
+        const auto& oldest = history.At(history.count - 1);
+        outX = oldest.x;
+        outY = oldest.y;
+        return true;
+    }
+
+    void SnapshotBuffer::Clear() {
+        m_entities.clear();
+        m_hasClock = false;
+        m_clockOffset = 0.0;
+        m_lastArrival = 0.0;
+        m_lastServerTime = 0.0;
+        m_jitter = 0.0f;
+        m_snapshotInterval = 1.0f / m_config.tickRate;
+        m_playoutDelay = INITIAL_PLAYOUT_DELAY;
+        m_latestTick = 0;
+    }
+
+}
@@ -0,0 +1,157 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotCodec implementation
+*/
+
+#include "SnapshotCodec.hpp"
+#include "SnapshotBudget.hpp"
+#include "ReplicationSchema.hpp"
+#include <cstring>
+#include <iostream>
+
+namespace network {
+
+    namespace {
+        template <typename T>
+        void Read(const uint8_t* data, size_t& offset, T& value) {
+            std::memcpy(&value, data + offset, sizeof(T));
+            offset += sizeof(T);
+        }
+    }
+
+    SnapshotCodec::SnapshotCodec() {
+        m_inputAcks.reserve(MAX_PLAYERS);
+        m_flattened.reserve(MAX_ENTITIES);
+        m_changedFields.reserve(MAX_ENTITIES);
+    }
+
+    void SnapshotCodec::SetDictionary(const std::vector<uint8_t>& dictionary) {
+        m_dictionary = dictionary;
+        m_compressors.erase(CompressionFlags::COMPRESSION_ZSTD_DICT);
+    }
+
+    ISnapshotCompressor* SnapshotCodec::GetCompressor(uint8_t compressionFlag) {
+        auto it = m_compressors.find(compressionFlag);
+        if (it == m_compressors.end()) {
+            auto compressor = CreateSnapshotCompressor(static_cast<CompressionFlags>(compressionFlag), m_dictionary);
+            if (!compressor) {
+                return nullptr;
+            }
+            it = m_compressors.emplace(compressionFlag, std::move(compressor)).first;
+        }
+        return it->second.get();
+    }
+
+    void SnapshotCodec::ReadInputAcks(const uint8_t* data, size_t size, size_t& offset, uint8_t count) {
+        m_inputAcks.clear();
+        for (uint8_t i = 0; i < count && offset + sizeof(InputAck) <= size; i++) {
+            Read(data, offset, m_inputAcks.emplace_back());
+        }
+    }
+
+    bool SnapshotCodec::DecodeState(const uint8_t* packet, size_t size, EntityStateTable& entities) {
+        if (size < sizeof(StatePacketHeader)) {
+            return false;
+        }
+        StatePacketHeader header;
+        std::memcpy(&header, packet, sizeof(StatePacketHeader));
+
+        size_t offset = sizeof(StatePacketHeader);
+        ReadInputAcks(packet, size, offset, header.inputAckCount);
+
+        entities.clear();
+        m_changedFields.clear();
+        for (uint16_t i = 0; i < header.entityCount; i++) {
+            if (offset + sizeof(EntityState) > size) {
+                break;
+            }
+            uint32_t entityId = 0;
+            std::memcpy(&entityId, packet + offset, sizeof(uint32_t));
+            Read(packet, offset, entities[entityId]);
+            m_changedFields[entityId] = Replication::EntitySchema::ALL_FIELDS;
+        }
+        return true;
+    }
+
+    bool SnapshotCodec::DecodeDelta(const uint8_t* packet, size_t size, EntityStateTable& entities) {
+        if (size < sizeof(StateDeltaHeader)) {
+            return false;
+        }
+        StateDeltaHeader header;
+        std::memcpy(&header, packet, sizeof(StateDeltaHeader));
+
+        const uint8_t* payload = packet + sizeof(StateDeltaHeader);
+        size_t payloadSize = size - sizeof(StateDeltaHeader);
+
+        if (header.compressionFlags != CompressionFlags::COMPRESSION_NONE) {
+            if (header.uncompressedSize == 0) {
+                return false;
+            }
+            ISnapshotCompressor* compressor = GetCompressor(header.compressionFlags);
+            if (!compressor) {
+                std::cerr << "[CLIENT] Unsupported snapshot compression " << static_cast<int>(header.compressionFlags) << std::endl;
+                return false;
+            }
+            CompressionHistory history = m_receivedPayloads.Find(header.baseSequence);
+            if (!compressor->Decompress(payload, payloadSize, header.uncompressedSize, history, m_decompressed)) {
+                std::cerr << "[CLIENT] " << compressor->GetName() << " decompression failed!" << std::endl;
+                return false;
+            }
+            payload = m_decompressed.data();
+            payloadSize = m_decompressed.size();
+        }
+        m_receivedPayloads.Store(header.stateSequence, payload, payloadSize);
+
+        size_t offset = 0;
+        ReadInputAcks(payload, payloadSize, offset, header.inputAckCount);
+        m_changedFields.clear();
+
+        for (uint16_t i = 0; i < header.destroyedCount && offset + sizeof(uint32_t) <= payloadSize; i++) {
+            uint32_t destroyedId = 0;
+            Read(payload, offset, destroyedId);
+            entities.erase(destroyedId);
+        }
+
+        for (uint16_t i = 0; i < header.newEntityCount && offset + sizeof(EntityState) <= payloadSize; i++) {
+            uint32_t entityId = 0;
+            std::memcpy(&entityId, payload + offset, sizeof(uint32_t));
+            Read(payload, offset, entities[entityId]);
+            m_changedFields[entityId] = Replication::EntitySchema::ALL_FIELDS;
+        }
+
+        // Delta headers are packed together, followed by their field data in the same order
+        size_t headerOffset = offset;
+        size_t fieldOffset = offset + sizeof(DeltaEntityHeader) * header.deltaEntityCount;
+        if (fieldOffset > payloadSize) {
+            return true;
+        }
+        for (uint16_t i = 0; i < header.deltaEntityCount; i++) {
+            DeltaEntityHeader deh;
+            Read(payload, headerOffset, deh);
+
+            const size_t fieldsSize = SnapshotPrioritizer::GetDeltaFieldsSize(deh.deltaFlags);
+            if (fieldOffset + fieldsSize > payloadSize) {
+                break;
+            }
+            auto it = entities.find(deh.entityId);
+            if (it == entities.end()) {
+                fieldOffset += fieldsSize;
+                continue;
+            }
+            Replication::EntitySchema::Read(payload, fieldOffset, deh.deltaFlags, it->second);
+            m_changedFields[deh.entityId] |= deh.deltaFlags;
+        }
+        return true;
+    }
+
+    const std::vector<EntityState>& SnapshotCodec::Flatten(const EntityStateTable& entities) {
+        m_flattened.clear();
+        for (const auto& [id, state] : entities) {
+            m_flattened.push_back(state);
+        }
+        return m_flattened;
+    }
+
+}
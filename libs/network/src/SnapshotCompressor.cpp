@@ -0,0 +1,221 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** SnapshotCompressor implementation
+*/
+
+#include "SnapshotCompressor.hpp"
+#include <lz4.h>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#ifdef RTYPE_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace network {
+
+    namespace {
+        constexpr size_t LZ4_MAX_DICTIONARY_SIZE = 64 * 1024;
+
+        bool DecompressLz4Block(const uint8_t* data, size_t size, size_t originalSize, const CompressionHistory& history,
+            std::vector<uint8_t>& out) {
+            if (size == 0 || originalSize == 0) {
+                return false;
+            }
+            out.resize(originalSize);
+
+            int decompressedSize = 0;
+            if (history.data && history.size > 0) {
+                const size_t dictSize = std::min(history.size, LZ4_MAX_DICTIONARY_SIZE);
+                decompressedSize = LZ4_decompress_safe_usingDict(
+                    reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out.data()),
+                    static_cast<int>(size), static_cast<int>(originalSize),
+                    reinterpret_cast<const char*>(history.data + history.size - dictSize), static_cast<int>(dictSize));
+            } else {
+                decompressedSize = LZ4_decompress_safe(
+                    reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out.data()),
+                    static_cast<int>(size), static_cast<int>(originalSize));
+            }
+            return decompressedSize >= 0 && static_cast<size_t>(decompressedSize) == originalSize;
+        }
+    }
+
+    bool Lz4BlockCompressor::Compress(const uint8_t* data, size_t size, const CompressionHistory&, std::vector<uint8_t>& out) {
+        if (size == 0) {
+            return false;
+        }
+        out.resize(LZ4_compressBound(static_cast<int>(size)));
+        int compressedSize = LZ4_compress_default(
+            reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out.data()),
+            static_cast<int>(size), static_cast<int>(out.size()));
+        if (compressedSize <= 0) {
+            return false;
+        }
+        out.resize(compressedSize);
+        return true;
+    }
+
+    bool Lz4BlockCompressor::Decompress(const uint8_t* data, size_t size, size_t originalSize, const CompressionHistory&,
+        std::vector<uint8_t>& out) {
+        return DecompressLz4Block(data, size, originalSize, CompressionHistory{}, out);
+    }
+
+    bool Lz4HistoryCompressor::Compress(const uint8_t* data, size_t size, const CompressionHistory& history, std::vector<uint8_t>& out) {
+        if (size == 0) {
+            return false;
+        }
+        out.resize(LZ4_compressBound(static_cast<int>(size)));
+
+        LZ4_stream_t stream;
+        LZ4_initStream(&stream, sizeof(stream));
+        if (history.data && history.size > 0) {
+            const size_t dictSize = std::min(history.size, LZ4_MAX_DICTIONARY_SIZE);
+            LZ4_loadDict(&stream, reinterpret_cast<const char*>(history.data + history.size - dictSize), static_cast<int>(dictSize));
+        }
+
+        int compressedSize = LZ4_compress_fast_continue(&stream,
+            reinterpret_cast<const char*>(data), reinterpret_cast<char*>(out.data()),
+            static_cast<int>(size), static_cast<int>(out.size()), 1);
+        if (compressedSize <= 0) {
+            return false;
+        }
+        out.resize(compressedSize);
+        return true;
+    }
+
+    bool Lz4HistoryCompressor::Decompress(const uint8_t* data, size_t size, size_t originalSize, const CompressionHistory& history,
+        std::vector<uint8_t>& out) {
+        return DecompressLz4Block(data, size, originalSize, history, out);
+    }
+
+#ifdef RTYPE_HAS_ZSTD
+    struct ZstdDictCompressor::Impl {
+        ZSTD_CCtx* cctx = nullptr;
+        ZSTD_DCtx* dctx = nullptr;
+        ZSTD_CDict* cdict = nullptr;
+        ZSTD_DDict* ddict = nullptr;
+    };
+
+    ZstdDictCompressor::ZstdDictCompressor(const std::vector<uint8_t>& dictionary, int level)
+        : m_impl(std::make_unique<Impl>()) {
+        m_impl->cctx = ZSTD_createCCtx();
+        m_impl->dctx = ZSTD_createDCtx();
+        m_impl->cdict = ZSTD_createCDict(dictionary.data(), dictionary.size(), level);
+        m_impl->ddict = ZSTD_createDDict(dictionary.data(), dictionary.size());
+    }
+
+    ZstdDictCompressor::~ZstdDictCompressor() {
+        ZSTD_freeCCtx(m_impl->cctx);
+        ZSTD_freeDCtx(m_impl->dctx);
+        ZSTD_freeCDict(m_impl->cdict);
+        ZSTD_freeDDict(m_impl->ddict);
+    }
+
+    bool ZstdDictCompressor::Compress(const uint8_t* data, size_t size, const CompressionHistory&, std::vector<uint8_t>& out) {
+        if (size == 0 || !m_impl->cctx || !m_impl->cdict) {
+            return false;
+        }
+        out.resize(ZSTD_compressBound(size));
+        size_t compressedSize = ZSTD_compress_usingCDict(m_impl->cctx, out.data(), out.size(), data, size, m_impl->cdict);
+        if (ZSTD_isError(compressedSize)) {
+            return false;
+        }
+        out.resize(compressedSize);
+        return true;
+    }
+
+    bool ZstdDictCompressor::Decompress(const uint8_t* data, size_t size, size_t originalSize, const CompressionHistory&,
+        std::vector<uint8_t>& out) {
+        if (size == 0 || originalSize == 0 || !m_impl->dctx || !m_impl->ddict) {
+            return false;
+        }
+        out.resize(originalSize);
+        size_t decompressedSize = ZSTD_decompress_usingDDict(m_impl->dctx, out.data(), out.size(), data, size, m_impl->ddict);
+        return !ZSTD_isError(decompressedSize) && decompressedSize == originalSize;
+    }
+#endif
+
+    std::unique_ptr<ISnapshotCompressor> CreateSnapshotCompressor(CompressionFlags flag, const std::vector<uint8_t>& dictionary) {
+        switch (flag) {
+        case COMPRESSION_LZ4:
+            return std::make_unique<Lz4BlockCompressor>();
+        case COMPRESSION_LZ4_HISTORY:
+            return std::make_unique<Lz4HistoryCompressor>();
+#ifdef RTYPE_HAS_ZSTD
+        case COMPRESSION_ZSTD_DICT:
+            if (dictionary.empty()) {
+                return nullptr;
+            }
+            return std::make_unique<ZstdDictCompressor>(dictionary);
+#endif
+        default:
+            (void)dictionary;
+            return nullptr;
+        }
+    }
+
+    void PayloadHistory::Store(uint32_t sequence, const uint8_t* data, size_t size) {
+        Entry& entry = m_entries[sequence % HISTORY_SIZE];
+        entry.sequence = sequence;
+        entry.valid = true;
+        entry.payload.assign(data, data + size);
+    }
+
+    CompressionHistory PayloadHistory::Find(uint32_t sequence) const {
+        const Entry& entry = m_entries[sequence % HISTORY_SIZE];
+        if (!entry.valid || entry.sequence != sequence || entry.payload.empty()) {
+            return CompressionHistory{};
+        }
+        return CompressionHistory{entry.payload.data(), entry.payload.size()};
+    }
+
+    void PayloadHistory::Clear() {
+        for (auto& entry : m_entries) {
+            entry.valid = false;
+            entry.payload.clear();
+        }
+    }
+
+    bool SnapshotTrafficRecorder::Open(const std::string& path) {
+        m_file.open(path, std::ios::binary | std::ios::app);
+        return m_file.is_open();
+    }
+
+    void SnapshotTrafficRecorder::Record(const uint8_t* data, size_t size) {
+        if (!m_file.is_open()) {
+            return;
+        }
+        uint32_t recordSize = static_cast<uint32_t>(size);
+        m_file.write(reinterpret_cast<const char*>(&recordSize), sizeof(recordSize));
+        m_file.write(reinterpret_cast<const char*>(data), size);
+    }
+
+    bool SnapshotTrafficRecorder::Load(const std::string& path, std::vector<std::vector<uint8_t>>& samples) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        uint32_t recordSize = 0;
+        while (file.read(reinterpret_cast<char*>(&recordSize), sizeof(recordSize))) {
+            std::vector<uint8_t> sample(recordSize);
+            if (!file.read(reinterpret_cast<char*>(sample.data()), recordSize)) {
+                break;
+            }
+            samples.push_back(std::move(sample));
+        }
+        return true;
+    }
+
+    bool LoadBinaryFile(const std::string& path, std::vector<uint8_t>& data) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+}
@@ -15,6 +15,7 @@
 #include <atomic>
 #include <optional>
 #include <memory>
+#include <cstdlib>
 
 int main(int argc, char* argv[]) {
     uint16_t port = 4242;
@@ -38,6 +39,7 @@ int main(int argc, char* argv[]) {
     std::atomic<bool> gameStarted{false};
     std::optional<uint32_t> startedRoomId;
     std::vector<network::PlayerInfo> gamePlayers;
+    uint32_t gameSeed = 0;
 
     roomManager.onGameStart([&](uint32_t roomId, const network::RoomManager::Room& room) {
         gamePlayers.clear();
@@ -47,6 +49,7 @@ int main(int argc, char* argv[]) {
             }
         }
         startedRoomId = roomId;
+        gameSeed = room.gameSeed;
         gameStarted = true;
     });
 
@@ -63,6 +66,28 @@ int main(int argc, char* argv[]) {
             std::cout << "Level: " << levelPath << std::endl;
 
             network::GameServer gameServer(networkModule.get(), port, gamePlayers, levelPath);
+            gameServer.SetSeed(gameSeed);
+
+            // RTYPE_SNAPSHOT_DICT: trained zstd dictionary (clients load assets/network/snapshot.dict)
+            // RTYPE_RECORD_SNAPSHOTS: file receiving raw delta payloads for r-type_dict_trainer
+            // RTYPE_RECORD_INPUTS: input log of the match, replayable with r-type_replay
+            if (const char* dictPath = std::getenv("RTYPE_SNAPSHOT_DICT")) {
+                std::vector<uint8_t> dictionary;
+                if (network::LoadBinaryFile(dictPath, dictionary)) {
+                    gameServer.SetSnapshotCompression(network::COMPRESSION_ZSTD_DICT, dictionary);
+                } else {
+                    std::cerr << "Could not read snapshot dictionary " << dictPath << std::endl;
+                }
+            }
+            if (const char* recordPath = std::getenv("RTYPE_RECORD_SNAPSHOTS")) {
+                if (gameServer.RecordSnapshotTraffic(recordPath)) {
+                    std::cout << "Recording snapshot traffic to " << recordPath << std::endl;
+                }
+            }
+            if (const char* inputLogPath = std::getenv("RTYPE_RECORD_INPUTS")) {
+                gameServer.RecordInputs(inputLogPath);
+            }
+
             gameServer.Run();
 
             std::cout << "\n=== Game ended in room " << *startedRoomId << ". Room available again. ===" << std::endl;
@@ -0,0 +1,199 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Animation Clips
+*/
+
+#include "Animation/AnimationModule.hpp"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Animation;
+
+// Per-frame lookup the module used before clips were compiled: sum the
+// frame durations until the normalized time falls inside one
+static std::size_t ReferenceFrameIndex(const AnimationClipConfig& config, float time, bool looping) {
+    float duration = 0.0f;
+    for (const auto& frame : config.frames) {
+        duration += frame.duration;
+    }
+    if (duration <= 0.0f) {
+        return 0;
+    }
+
+    float normalizedTime = time;
+    if (looping) {
+        normalizedTime = std::fmod(time, duration);
+        if (normalizedTime < 0.0f) {
+            normalizedTime += duration;
+        }
+    } else {
+        normalizedTime = std::clamp(time, 0.0f, duration);
+    }
+
+    float accumulated = 0.0f;
+    for (std::size_t i = 0; i < config.frames.size(); ++i) {
+        accumulated += config.frames[i].duration;
+        if (normalizedTime < accumulated) {
+            return i;
+        }
+    }
+    return config.frames.size() - 1;
+}
+
+// Per-sprite advance AnimationSystem did before AdvanceClips
+struct ReferenceSprite {
+    float time = 0.0f;
+    bool playing = true;
+};
+
+static std::size_t ReferenceAdvance(const AnimationClipConfig& config, ReferenceSprite& sprite,
+    float deltaTime, float speed, bool looping) {
+    float duration = 0.0f;
+    for (const auto& frame : config.frames) {
+        duration += frame.duration;
+    }
+    sprite.time += deltaTime * speed;
+    if (sprite.time >= duration) {
+        if (looping) {
+            sprite.time = std::fmod(sprite.time, duration);
+        } else {
+            sprite.time = duration;
+            sprite.playing = false;
+        }
+    }
+    return ReferenceFrameIndex(config, sprite.time, looping);
+}
+
+static AnimationClipConfig MakeClip(const std::string& name, const std::vector<float>& durations, bool looping) {
+    AnimationClipConfig config;
+    config.name = name;
+    config.texturePath = name + ".png";
+    config.looping = looping;
+    for (std::size_t i = 0; i < durations.size(); ++i) {
+        Math::Rectangle region;
+        region.position = {static_cast<float>(i) * 32.0f, 0.0f};
+        region.size = {32.0f, 32.0f};
+        config.frames.emplace_back(region, durations[i], i == 2 ? "hit" : "");
+    }
+    return config;
+}
+
+void test_frame_lookup() {
+    std::cout << "=== Test: Frame Lookup ===" << std::endl;
+
+    AnimationModule module;
+    GridLayout layout;
+    layout.columns = 4;
+    layout.rows = 2;
+    layout.frameCount = 8;
+    layout.frameWidth = 16.0f;
+    layout.frameHeight = 16.0f;
+    layout.defaultDuration = 0.08f;
+    AnimationClipId grid = module.CreateClipFromGrid("grid", "grid.png", layout, true);
+    AnimationClipConfig uneven = MakeClip("uneven", {0.05f, 0.2f, 0.1f, 0.3f, 0.05f}, true);
+    [[maybe_unused]] AnimationClipId unevenId = module.CreateClip(uneven);
+    const AnimationClipConfig gridConfig = *module.GetClipConfig(grid);
+
+    assert(std::abs(module.GetClipDuration(grid) - 0.64f) < 1e-5f);
+    assert(std::abs(module.GetClipDuration(unevenId) - 0.7f) < 1e-5f);
+    assert(module.GetClipFrameCount(unevenId) == 5);
+
+    for (float time = -1.0f; time < 2.0f; time += 0.013f) {
+        for ([[maybe_unused]] bool looping : {true, false}) {
+            assert(module.GetFrameIndexAtTime(grid, time, looping) == ReferenceFrameIndex(gridConfig, time, looping));
+            assert(module.GetFrameIndexAtTime(unevenId, time, looping) == ReferenceFrameIndex(uneven, time, looping));
+        }
+    }
+    std::cout << "Uniform and uneven clips match the summed lookup at every sampled time" << std::endl;
+
+    assert(module.GetFrameIndexAtTime(unevenId, 0.25f, false) == 2);
+    assert(module.GetFrameAtTime(unevenId, 0.25f, false).eventName == "hit");
+    assert(module.GetFrameIndexAtTime(unevenId, 5.0f, false) == 4);
+    assert(module.GetFrameIndexAtTime(unevenId, 0.72f, true) == 0);
+    assert(module.GetFrameIndexAtTime(INVALID_CLIP_ID, 0.5f, true) == 0);
+
+    std::cout << "Frame Lookup: PASSED\n" << std::endl;
+}
+
+void test_advance_clips() {
+    std::cout << "=== Test: Advance Clips ===" << std::endl;
+
+    AnimationModule module;
+    AnimationClipConfig loop = MakeClip("loop", {0.1f, 0.1f, 0.1f, 0.1f}, true);
+    AnimationClipConfig uneven = MakeClip("uneven", {0.05f, 0.2f, 0.1f, 0.3f, 0.05f}, true);
+    AnimationClipConfig once = MakeClip("once", {0.1f, 0.15f, 0.1f}, false);
+    const AnimationClipConfig* configs[] = {&loop, &uneven, &once};
+    AnimationClipId ids[] = {module.CreateClip(loop), module.CreateClip(uneven), module.CreateClip(once)};
+    const float speeds[] = {1.0f, 1.5f, 1.0f};
+
+    // Cursors sharing a clip sit next to each other, as AnimationSystem gathers them
+    std::vector<ClipCursor> cursors;
+    std::vector<ReferenceSprite> sprites;
+    std::vector<std::size_t> clipOf;
+    for (std::size_t clip = 0; clip < 3; ++clip) {
+        for (int copy = 0; copy < 2; ++copy) {
+            ClipCursor cursor;
+            cursor.clipId = ids[clip];
+            cursor.playbackSpeed = speeds[clip];
+            cursor.looping = configs[clip]->looping;
+            cursor.time = copy * 0.07f;
+            cursors.push_back(cursor);
+            ReferenceSprite sprite;
+            sprite.time = cursor.time;
+            sprites.push_back(sprite);
+            clipOf.push_back(clip);
+        }
+    }
+    ClipCursor unknown;
+    unknown.clipId = 999;
+    cursors.push_back(unknown);
+
+    int finishedSteps = 0;
+    for (int step = 0; step < 120; ++step) {
+        module.AdvanceClips(cursors.data(), cursors.size(), 1.0f / 60.0f);
+
+        for (std::size_t i = 0; i < sprites.size(); ++i) {
+            if (!sprites[i].playing) {
+                continue;
+            }
+            const auto& config = *configs[clipOf[i]];
+            [[maybe_unused]] std::size_t expected = ReferenceAdvance(config, sprites[i], 1.0f / 60.0f, speeds[clipOf[i]], config.looping);
+            assert(cursors[i].frame && cursors[i].frameIndex == expected);
+            assert(cursors[i].frame == &module.GetClipConfig(ids[clipOf[i]])->frames[expected]);
+            assert(std::abs(cursors[i].time - sprites[i].time) < 1e-5f);
+            assert(cursors[i].finished == !sprites[i].playing);
+            finishedSteps += cursors[i].finished ? 1 : 0;
+        }
+        assert(!cursors.back().frame && !cursors.back().finished);
+    }
+    std::cout << "Looping and sped-up cursors follow the per-sprite advance for 120 frames" << std::endl;
+
+    // Each non-looping sprite reports the end on one step, then holds its last frame
+    assert(finishedSteps == 2);
+    for (std::size_t i = 4; i < 6; ++i) {
+        assert(cursors[i].time == module.GetClipDuration(ids[2]) && cursors[i].frameIndex == 2);
+    }
+    std::cout << "Non-looping clip finishes once and clamps to its last frame" << std::endl;
+
+    std::cout << "Advance Clips: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing AnimationModule clips...\n" << std::endl;
+
+    try {
+        test_frame_lookup();
+        test_advance_clips();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
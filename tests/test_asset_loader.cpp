@@ -0,0 +1,249 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Asset Loader
+*/
+
+#include "Core/AssetLoader.hpp"
+#include "ECS/LevelLoader.hpp"
+#include "Animation/AnimationModule.hpp"
+#include "Renderer/RecordingRenderer.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+
+using RType::Core::AssetLoader;
+using RType::Core::AssetPriority;
+
+static const char* TEXTURE_PATH = "test_asset_loader.png";
+
+static void WritePngHeader(const char* path, std::uint32_t width, std::uint32_t height) {
+    const unsigned char header[24] = {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        static_cast<unsigned char>(width >> 24), static_cast<unsigned char>(width >> 16),
+        static_cast<unsigned char>(width >> 8), static_cast<unsigned char>(width),
+        static_cast<unsigned char>(height >> 24), static_cast<unsigned char>(height >> 16),
+        static_cast<unsigned char>(height >> 8), static_cast<unsigned char>(height)};
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+void test_completions_on_calling_thread() {
+    std::cout << "=== Test: Completions On Calling Thread ===" << std::endl;
+
+    AssetLoader loader(4);
+    assert(loader.GetThreadCount() == 4);
+
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::atomic<int> workerJobs{0};
+    int completions = 0;
+
+    for (int i = 0; i < 32; i++) {
+        loader.Enqueue([&, mainThread]() -> AssetLoader::Completion {
+            assert(std::this_thread::get_id() != mainThread);
+            workerJobs++;
+            return [&, mainThread]() {
+                assert(std::this_thread::get_id() == mainThread);
+                completions++;
+            };
+        });
+    }
+
+    loader.WaitIdle();
+    assert(workerJobs == 32);
+    assert(completions == 32);
+    assert(loader.IsIdle());
+    assert(loader.GetProgress().Done());
+    assert(loader.GetProgress().Fraction() == 1.0f);
+
+    std::cout << "32 jobs ran on workers, completions on the caller" << std::endl;
+    std::cout << "Completions: PASSED\n" << std::endl;
+}
+
+void test_priority_order() {
+    std::cout << "=== Test: Priority Order ===" << std::endl;
+
+    // One worker held by a blocker so the queue fills up before anything else starts
+    AssetLoader loader(1);
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    std::vector<int> order;
+
+    loader.Enqueue([&]() -> AssetLoader::Completion {
+        started = true;
+        while (!release) {
+            std::this_thread::yield();
+        }
+        return nullptr;
+    });
+    while (!started) {
+        std::this_thread::yield();
+    }
+
+    auto job = [&order](int tag) {
+        return [&order, tag]() -> AssetLoader::Completion {
+            order.push_back(tag);
+            return nullptr;
+        };
+    };
+    loader.Enqueue(job(30), AssetPriority::Low);
+    loader.Enqueue(job(20), AssetPriority::Normal);
+    loader.Enqueue(job(0), AssetPriority::Critical);
+    loader.Enqueue(job(21), AssetPriority::Normal);
+    loader.Enqueue(job(10), AssetPriority::High);
+
+    release = true;
+    loader.WaitIdle();
+
+    const std::vector<int> expected = {0, 10, 20, 21, 30};
+    assert(order == expected);
+
+    std::cout << "Critical > High > Normal > Low, FIFO within a priority" << std::endl;
+    std::cout << "Priority: PASSED\n" << std::endl;
+}
+
+void test_progress_and_chained_jobs() {
+    std::cout << "=== Test: Progress And Chained Jobs ===" << std::endl;
+
+    AssetLoader loader(2);
+    int stage = 0;
+
+    loader.Enqueue([&loader, &stage]() -> AssetLoader::Completion {
+        return [&loader, &stage]() {
+            stage = 1;
+            // A completion may queue follow-up work, like textures after a level parse
+            loader.Enqueue([&stage]() -> AssetLoader::Completion {
+                return [&stage]() { stage = 2; };
+            });
+        };
+    });
+
+    loader.WaitIdle();
+    assert(stage == 2);
+    assert(loader.GetProgress().submitted == 2);
+    assert(loader.GetProgress().completed == 2);
+
+    loader.ResetProgress();
+    assert(loader.GetProgress().submitted == 0);
+    assert(loader.GetProgress().Fraction() == 1.0f);
+
+    // A throwing job still counts as completed
+    loader.Enqueue([]() -> AssetLoader::Completion {
+        throw std::runtime_error("decode error");
+    });
+    loader.WaitIdle();
+    assert(loader.GetProgress().Done());
+
+    std::cout << "Progress counts chained and failed jobs" << std::endl;
+    std::cout << "Progress: PASSED\n" << std::endl;
+}
+
+void test_level_texture_pipeline() {
+    std::cout << "=== Test: Level Texture Pipeline ===" << std::endl;
+
+    Renderer::RecordingRenderer renderer;
+    [[maybe_unused]] bool windowCreated = renderer.CreateWindow(Renderer::WindowConfig{});
+    assert(windowCreated);
+    AssetLoader loader(2);
+
+    RType::ECS::LevelData level;
+    level.textures["ship"] = TEXTURE_PATH;
+    level.textures["missing"] = "does/not/exist.png";
+
+    RType::ECS::LoadedAssets assets;
+    size_t failed = 0;
+    const Renderer::IRenderer* decoder = &renderer;
+    for (const auto& [key, path] : level.textures) {
+        loader.Enqueue([&, decoder, key = key, path = path]() -> AssetLoader::Completion {
+            auto decoded = std::make_shared<RType::ECS::DecodedTexture>();
+            bool ok = RType::ECS::LevelLoader::DecodeTexture(decoder, path, *decoded);
+            return [&, key, decoded, ok]() {
+                if (!ok || !RType::ECS::LevelLoader::UploadTexture(key, *decoded, &renderer, assets)) {
+                    failed++;
+                }
+            };
+        });
+    }
+    loader.WaitIdle();
+
+    assert(failed == 1);
+    assert(assets.textures.count("ship") == 1);
+    assert(assets.sprites.count("ship") == 1);
+    assert(renderer.GetTextureSize(assets.textures["ship"]).x == 48.0f);
+
+    // The upload goes through the same cache as a synchronous load
+    [[maybe_unused]] Renderer::TextureId again = renderer.LoadTexture(TEXTURE_PATH);
+    assert(again == assets.textures["ship"]);
+    assert(renderer.GetTextureCacheHits() == 1);
+
+    std::cout << "Decoded textures uploaded on the main thread and cached" << std::endl;
+    std::cout << "Level Textures: PASSED\n" << std::endl;
+}
+
+void test_animation_manifest_pipeline() {
+    std::cout << "=== Test: Animation Manifest Pipeline ===" << std::endl;
+
+    const char* clipPaths[] = {"test_asset_loader_walk.json", "test_asset_loader_boom.json", "test_asset_loader_bad.json"};
+    std::ofstream(clipPaths[0]) << R"({"name": "walk", "texture": "walk.png", "looping": true,
+        "frames": [{"x": 0, "width": 16, "height": 16, "duration": 0.1}, {"x": 16, "width": 16, "height": 16, "duration": 0.2}]})";
+    std::ofstream(clipPaths[1]) << R"({"name": "boom", "texture": "boom.png",
+        "gridLayout": {"columns": 4, "rows": 2, "frameWidth": 32, "frameHeight": 32, "defaultDuration": 0.05}})";
+    std::ofstream(clipPaths[2]) << "{ not json";
+    const char* manifestPath = "test_asset_loader_manifest.json";
+    std::ofstream(manifestPath) << R"({"clips": ["test_asset_loader_walk.json", "test_asset_loader_bad.json",
+        "test_asset_loader_boom.json", "does/not/exist.json"]})";
+
+    Animation::AnimationModule direct;
+    direct.LoadAnimationsFromManifest(manifestPath);
+
+    Animation::AnimationModule streamed;
+    AssetLoader loader(2);
+    streamed.LoadAnimationsFromManifestAsync(manifestPath, loader);
+    loader.WaitIdle();
+
+    // Same clips under the same ids as the synchronous load, unreadable files skipped
+    for (const char* name : {"walk", "boom"}) {
+        [[maybe_unused]] Animation::AnimationClipId id = streamed.GetClipByName(name);
+        assert(id != Animation::INVALID_CLIP_ID && id == direct.GetClipByName(name));
+        assert(streamed.GetClipFrameCount(id) == direct.GetClipFrameCount(id));
+        assert(streamed.GetClipDuration(id) == direct.GetClipDuration(id));
+    }
+    assert(streamed.GetClipByName("walk") == 1 && streamed.GetClipFrameCount(streamed.GetClipByName("boom")) == 8);
+    assert(loader.GetProgress().submitted == 5);
+
+    for (const char* path : clipPaths) {
+        std::remove(path);
+    }
+    std::remove(manifestPath);
+
+    std::cout << "Manifest and clip files parsed by loader jobs, clips created in manifest order" << std::endl;
+    std::cout << "Animation Manifest: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing AssetLoader...\n" << std::endl;
+
+    WritePngHeader(TEXTURE_PATH, 48, 16);
+    try {
+        test_completions_on_calling_thread();
+        test_priority_order();
+        test_progress_and_chained_jobs();
+        test_level_texture_pipeline();
+        test_animation_manifest_pipeline();
+
+        std::remove(TEXTURE_PATH);
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::remove(TEXTURE_PATH);
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,158 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Compound Collider
+*/
+
+#include "ECS/CollisionDetectionSystem.hpp"
+#include "ECS/PlayerCollisionResponseSystem.hpp"
+#include "ECS/LevelLoader.hpp"
+#include "ECS/Registry.hpp"
+#include "ECS/Component.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace RType::ECS;
+
+// An L-shaped station piece: a floor and a wall, leaving the top-left corner open
+static ObstacleDef MakeStationPiece() {
+    ObstacleDef obs;
+    obs.x = 1000.0f;
+    obs.y = 400.0f;
+    obs.colliders.push_back({1000.0f, 600.0f, 400.0f, 100.0f});
+    obs.colliders.push_back({1300.0f, 400.0f, 100.0f, 200.0f});
+    return obs;
+}
+
+static Entity MakePlayer(Registry& registry, float x, float y) {
+    Entity player = registry.CreateEntity();
+    registry.AddComponent<Position>(player, Position{x, y});
+    registry.AddComponent<BoxCollider>(player, BoxCollider{25.0f, 25.0f});
+    registry.AddComponent<Player>(player, Player(1, 42));
+    registry.AddComponent<Health>(player, Health(100));
+    registry.AddComponent<CollisionLayer>(player, CollisionLayer(CollisionLayers::PLAYER, CollisionLayers::OBSTACLE));
+    return player;
+}
+
+void test_bound() {
+    std::cout << "=== Test: Bound ===" << std::endl;
+
+    CompoundCollider compound = LevelLoader::MakeObstacleCollider(MakeStationPiece());
+    assert(compound.boxes.size() == 2);
+    assert(compound.bound.x == 0.0f && compound.bound.y == 0.0f);
+    assert(compound.bound.width == 400.0f && compound.bound.height == 300.0f);
+    assert(compound.boxes[1].x == 300.0f && compound.boxes[1].y == 0.0f);
+
+    std::cout << "Bound: PASSED\n" << std::endl;
+}
+
+void test_one_entity_per_obstacle() {
+    std::cout << "=== Test: One Entity Per Obstacle ===" << std::endl;
+
+    LevelData level;
+    for (int i = 0; i < 10; i++) {
+        ObstacleDef obs = MakeStationPiece();
+        obs.x += i * 500.0f;
+        for (auto& col : obs.colliders) {
+            col.x += i * 500.0f;
+        }
+        level.obstacles.push_back(obs);
+    }
+    level.obstacles.push_back(ObstacleDef{});  // Decoration only, no collider
+
+    Registry registry;
+    CreatedEntities created = LevelLoader::CreateServerEntities(registry, level);
+    assert(created.obstacleVisuals.size() == 11);
+    assert(created.obstacleColliders.size() == 10);
+    assert(registry.GetEntitiesWithComponent<Obstacle>().size() == 10);
+
+    for (size_t i = 0; i < created.obstacleColliders.size(); i++) {
+        Entity collider = created.obstacleColliders[i];
+        assert(registry.GetComponent<ObstacleMetadata>(collider).uniqueId == i + 1);
+        assert(registry.GetComponent<CompoundCollider>(collider).boxes.size() == 2);
+        assert(!registry.HasComponent<BoxCollider>(collider));
+    }
+    std::cout << "20 boxes held by 10 collider entities" << std::endl;
+
+    std::cout << "One Entity Per Obstacle: PASSED\n" << std::endl;
+}
+
+void test_detection() {
+    std::cout << "=== Test: Detection ===" << std::endl;
+
+    Registry registry;
+    CreatedEntities created;
+    uint32_t obstacleId = 1;
+    LevelLoader::SpawnServerObstacle(registry, MakeStationPiece(), 0.0f, obstacleId, created);
+    Entity obstacle = created.obstacleColliders.front();
+
+    Entity outside = MakePlayer(registry, 500.0f, 500.0f);
+    Entity inCorner = MakePlayer(registry, 1100.0f, 450.0f);  // Inside the bound, between the boxes
+    Entity onFloor = MakePlayer(registry, 1100.0f, 590.0f);
+    Entity onWall = MakePlayer(registry, 1290.0f, 450.0f);
+
+    assert(!CollisionDetectionSystem::CheckCollision(registry, outside, obstacle));
+    assert(!CollisionDetectionSystem::CheckCollision(registry, inCorner, obstacle));
+    assert(CollisionDetectionSystem::CheckCollision(registry, onFloor, obstacle));
+    assert(CollisionDetectionSystem::CheckCollision(registry, obstacle, onWall));
+
+    CompoundCollider::Box box;
+    assert(CollisionDetectionSystem::GetContactBox(registry, obstacle, onWall, box));
+    assert(box.x == 1300.0f && box.y == 400.0f && box.width == 100.0f);
+    assert(!CollisionDetectionSystem::GetContactBox(registry, obstacle, inCorner, box));
+
+    // Level-space compound colliders follow the scroll offset
+    Registry scrolled;
+    CreatedEntities scrolledCreated;
+    obstacleId = 1;
+    LevelLoader::SpawnServerObstacle(scrolled, MakeStationPiece(), 0.0f, obstacleId, scrolledCreated, true);
+    Entity levelSpaceObstacle = scrolledCreated.obstacleColliders.front();
+    Entity player = MakePlayer(scrolled, 600.0f, 590.0f);
+    assert(!CollisionDetectionSystem::CheckCollision(scrolled, player, levelSpaceObstacle));
+    scrolled.SetScrollOffset(-500.0f);
+    assert(CollisionDetectionSystem::CheckCollision(scrolled, player, levelSpaceObstacle));
+
+    std::cout << "Detection: PASSED\n" << std::endl;
+}
+
+void test_push_out_of_touched_box() {
+    std::cout << "=== Test: Push Out Of Touched Box ===" << std::endl;
+
+    Registry registry;
+    CreatedEntities created;
+    uint32_t obstacleId = 1;
+    LevelLoader::SpawnServerObstacle(registry, MakeStationPiece(), 0.0f, obstacleId, created);
+
+    // Slightly into the wall from the left: pushed back left of the wall, not of the whole bound
+    Entity player = MakePlayer(registry, 1280.0f, 450.0f);
+
+    CollisionDetectionSystem detection;
+    PlayerCollisionResponseSystem response;
+    detection.Update(registry, 1.0f / 60.0f);
+    assert(registry.HasComponent<CollisionEvent>(player));
+    response.Update(registry, 1.0f / 60.0f);
+
+    const auto& pos = registry.GetComponent<Position>(player);
+    assert(pos.x < 1300.0f - 25.0f && pos.x > 1200.0f);
+    assert(pos.y == 450.0f);
+
+    std::cout << "Push Out Of Touched Box: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing CompoundCollider...\n" << std::endl;
+
+    try {
+        test_bound();
+        test_one_entity_per_obstacle();
+        test_detection();
+        test_push_out_of_touched_box();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,210 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Entity Replicator
+*/
+
+#include "EntityReplicator.hpp"
+#include "ECS/Component.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace network;
+using namespace RType::ECS;
+
+static int s_builds = 0;
+
+// Reads Position and Health, rebuilt only when one of them changes
+static ReplicatedType MakeShipType() {
+    return {EntityType::ENEMY, Registry::MakeSignature<Enemy, Position, Health>(), {},
+        Registry::MakeSignature<Position, Health>(), 0,
+        [](const Registry& registry, Entity entity, EntityState& state) {
+            const auto& pos = registry.GetComponent<Position>(entity);
+            state.x = pos.x;
+            state.y = pos.y;
+            state.health = static_cast<uint16_t>(registry.GetComponent<Health>(entity).current);
+            s_builds++;
+        }};
+}
+
+// Same split as GameServer: level-space obstacles with inputs, then screen-space
+// ones rebuilt every tick, both drawing on one budget
+static void AddObstacleTypes(EntityReplicator& replicator, size_t cap) {
+    auto build = [](const Registry& registry, Entity entity, EntityState& state) {
+        const auto& pos = registry.GetComponent<Position>(entity);
+        state.x = pos.x;
+        state.y = pos.y;
+        state.health = 255;
+    };
+    replicator.AddType({EntityType::OBSTACLE, Registry::MakeSignature<Obstacle, Position, LevelSpace>(), {},
+        Registry::MakeSignature<Position>(), cap, build});
+    replicator.AddType({EntityType::OBSTACLE, Registry::MakeSignature<Obstacle, Position>(),
+        Registry::MakeSignature<LevelSpace>(), {}, cap, build});
+}
+
+static Entity MakeShip(Registry& registry, float x, int health) {
+    Entity entity = registry.CreateEntity();
+    registry.AddComponent<Enemy>(entity, Enemy{});
+    registry.AddComponent<Position>(entity, Position{x, 0.0f});
+    registry.AddComponent<Health>(entity, Health{health, health});
+    return entity;
+}
+
+static Entity MakeObstacle(Registry& registry, float x, bool levelSpace) {
+    Entity entity = registry.CreateEntity();
+    registry.AddComponent<Obstacle>(entity, Obstacle{});
+    registry.AddComponent<Position>(entity, Position{x, 0.0f});
+    if (levelSpace) {
+        registry.AddComponent<LevelSpace>(entity, LevelSpace{});
+    }
+    return entity;
+}
+
+void test_unchanged_state_is_reused() {
+    std::cout << "=== Test: Unchanged State Is Reused ===" << std::endl;
+
+    Registry registry;
+    EntityReplicator replicator;
+    replicator.AddType(MakeShipType());
+    Entity ship = MakeShip(registry, 10.0f, 3);
+    s_builds = 0;
+
+    replicator.Update(registry);
+    [[maybe_unused]] const uint32_t id = replicator.GetNetworkId(ship);
+    assert(id != 0 && s_builds == 1);
+    assert(replicator.GetStates().at(id).x == 10.0f && replicator.GetChangedIds().count(id) == 1);
+
+    for (int tick = 0; tick < 5; tick++) {
+        replicator.Update(registry);
+    }
+    assert(s_builds == 1 && replicator.GetChangedIds().empty());
+    assert(replicator.GetStates().size() == 1 && replicator.GetStates().at(id).x == 10.0f);
+    std::cout << "Untouched entity kept its state for 5 updates without a rebuild" << std::endl;
+
+    registry.GetComponent<Position>(ship).x = 20.0f;
+    replicator.Update(registry);
+    assert(s_builds == 2 && replicator.GetChangedIds().count(id) == 1);
+    assert(replicator.GetNetworkId(ship) == id && replicator.GetStates().at(id).x == 20.0f);
+    std::cout << "Moved entity rebuilt under the same network id" << std::endl;
+
+    std::cout << "Unchanged State Is Reused: PASSED\n" << std::endl;
+}
+
+void test_recycled_entity_id() {
+    std::cout << "=== Test: Recycled Entity Id ===" << std::endl;
+
+    Registry registry;
+    EntityReplicator replicator;
+    replicator.AddType(MakeShipType());
+    Entity first = MakeShip(registry, 10.0f, 3);
+    replicator.Update(registry);
+    const uint32_t firstId = replicator.GetNetworkId(first);
+
+    // Destroyed and replaced within one tick: the registry hands the same entity out again
+    registry.DestroyEntity(first);
+    Entity second = MakeShip(registry, 50.0f, 3);
+    assert(second == first);
+    replicator.Update(registry);
+
+    const uint32_t secondId = replicator.GetNetworkId(second);
+    assert(secondId != 0 && secondId != firstId);
+    assert(replicator.GetStates().size() == 1 && replicator.GetStates().count(firstId) == 0);
+    assert(replicator.GetStates().at(secondId).x == 50.0f && replicator.GetChangedIds().count(secondId) == 1);
+    std::cout << "Reused entity " << second << " sent as network id " << secondId
+              << ", the old id " << firstId << " dropped" << std::endl;
+
+    std::cout << "Recycled Entity Id: PASSED\n" << std::endl;
+}
+
+void test_dead_entities_are_dropped() {
+    std::cout << "=== Test: Dead Entities Are Dropped ===" << std::endl;
+
+    Registry registry;
+    EntityReplicator replicator;
+    replicator.AddType(MakeShipType());
+    [[maybe_unused]] Entity alive = MakeShip(registry, 10.0f, 3);
+    Entity dying = MakeShip(registry, 20.0f, 3);
+    [[maybe_unused]] Entity stillborn = MakeShip(registry, 30.0f, 0);
+    replicator.Update(registry);
+    [[maybe_unused]] const uint32_t dyingId = replicator.GetNetworkId(dying);
+    assert(replicator.GetStates().size() == 2 && replicator.GetNetworkId(stillborn) == 0);
+
+    registry.GetComponent<Health>(dying).current = 0;
+    replicator.Update(registry);
+    assert(replicator.GetStates().size() == 1 && replicator.GetStates().count(dyingId) == 0);
+    assert(replicator.GetNetworkId(dying) == 0 && replicator.GetNetworkId(alive) != 0);
+    std::cout << "Entity at 0 health left the snapshots while still in the registry" << std::endl;
+
+    registry.GetComponent<Health>(dying).current = 2;
+    replicator.Update(registry);
+    assert(replicator.GetStates().at(dyingId).health == 2 && replicator.GetChangedIds().count(dyingId) == 1);
+    std::cout << "Revived entity rebuilt under its network id" << std::endl;
+
+    std::cout << "Dead Entities Are Dropped: PASSED\n" << std::endl;
+}
+
+void test_obstacle_cap() {
+    std::cout << "=== Test: Obstacle Cap ===" << std::endl;
+
+    // One budget across both obstacle kinds
+    {
+        Registry registry;
+        EntityReplicator replicator;
+        AddObstacleTypes(replicator, 3);
+        MakeObstacle(registry, 0.0f, true);
+        MakeObstacle(registry, 1.0f, true);
+        MakeObstacle(registry, 2.0f, false);
+        MakeObstacle(registry, 3.0f, false);
+        replicator.Update(registry);
+        assert(replicator.GetStates().size() == 3);
+    }
+    std::cout << "Two level-space and two screen-space obstacles, cap 3: 3 sent" << std::endl;
+
+    // An obstacle pushed out by the cap is rebuilt when it comes back, not reused
+    Registry registry;
+    EntityReplicator replicator;
+    AddObstacleTypes(replicator, 3);
+    Entity placeholder = registry.CreateEntity();
+    MakeObstacle(registry, 1.0f, true);
+    MakeObstacle(registry, 2.0f, true);
+    Entity last = MakeObstacle(registry, 3.0f, true);
+    replicator.Update(registry);
+    [[maybe_unused]] const uint32_t lastId = replicator.GetNetworkId(last);
+    assert(replicator.GetStates().size() == 3 && lastId != 0);
+
+    // A new obstacle on a recycled, lower entity takes the last slot, while the
+    // obstacle it pushes out moves
+    registry.DestroyEntity(placeholder);
+    Entity early = MakeObstacle(registry, 0.0f, true);
+    registry.GetComponent<Position>(last).x = 42.0f;
+    replicator.Update(registry);
+    assert(replicator.GetNetworkId(early) != 0 && replicator.GetNetworkId(last) == 0);
+    assert(replicator.GetStates().size() == 3 && replicator.GetStates().count(lastId) == 0);
+
+    // Back under the cap with no change of its own since that update
+    registry.DestroyEntity(early);
+    replicator.Update(registry);
+    assert(replicator.GetNetworkId(last) == lastId);
+    assert(replicator.GetStates().at(lastId).x == 42.0f && replicator.GetChangedIds().count(lastId) == 1);
+    std::cout << "Obstacle skipped by the cap came back with its new position" << std::endl;
+
+    std::cout << "Obstacle Cap: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing EntityReplicator...\n" << std::endl;
+
+    try {
+        test_unchanged_state_is_reused();
+        test_recycled_entity_id();
+        test_dead_entities_are_dropped();
+        test_obstacle_cap();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,166 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Level Binary
+*/
+
+#include "ECS/LevelBinary.hpp"
+#include "ECS/LevelLoader.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace RType::ECS;
+
+static const char* JSON_PATH = "test_level_binary.json";
+
+static const char* LEVEL_JSON = R"({
+    "name": "Binary Test",
+    "assets": {
+        "textures": {"wall": "assets/wall.png", "boss": "assets/boss.png"},
+        "fonts": {"main": {"path": "assets/font.ttf", "size": 24}}
+    },
+    "background": {"texture": "assets/bg.png", "scrollSpeed": -70.0, "copies": 2},
+    "obstacles": [
+        {"texture": "wall", "position": {"x": 900, "y": 10}, "scrollSpeed": -70.0,
+         "colliders": [{"x": 910, "y": 20, "width": 50, "height": 60}]},
+        {"texture": "wall", "position": {"x": 300, "y": 400}, "scrollSpeed": -70.0,
+         "colliders": [{"x": 300, "y": 400, "width": 10, "height": 10}, {"x": 350, "y": 450, "width": 5, "height": 5}]},
+        {"texture": "wall", "position": {"x": 600, "y": 0}, "scrollSpeed": -70.0}
+    ],
+    "enemies": [
+        {"type": "FAST", "position": {"x": 2000, "y": 100}},
+        {"type": "TANK", "position": {"x": 1500, "y": 300}}
+    ],
+    "boss": {"texture": "boss", "position": {"x": 8000, "y": 300}, "health": 5000, "bossId": 2}
+})";
+
+void test_round_trip() {
+    std::cout << "=== Test: Round Trip ===" << std::endl;
+
+    LevelData level = LevelLoader::LoadFromString(LEVEL_JSON);
+    // Loading sorts by x, in both formats
+    assert(level.obstacles[0].x == 300.0f && level.obstacles[2].x == 900.0f);
+    assert(level.enemies[0].type == "TANK");
+
+    std::vector<uint8_t> image = LevelBinary::Compile(level);
+    LevelData decoded;
+    [[maybe_unused]] const bool decodedOk = LevelBinary::Decode(image.data(), image.size(), decoded);
+    assert(decodedOk);
+
+    assert(decoded.name == "Binary Test");
+    assert(decoded.textures == level.textures);
+    assert(decoded.fonts.at("main").path == "assets/font.ttf" && decoded.fonts.at("main").size == 24);
+    assert(decoded.background.texture == "assets/bg.png" && decoded.background.copies == 2);
+    assert(decoded.obstacles.size() == 3);
+    for (size_t i = 0; i < level.obstacles.size(); i++) {
+        const auto& a = level.obstacles[i];
+        [[maybe_unused]] const auto& b = decoded.obstacles[i];
+        assert(a.texture == b.texture && a.x == b.x && a.y == b.y && a.scrollSpeed == b.scrollSpeed);
+        assert(a.colliders.size() == b.colliders.size());
+        for (size_t c = 0; c < a.colliders.size(); c++) {
+            assert(a.colliders[c].x == b.colliders[c].x && a.colliders[c].width == b.colliders[c].width);
+        }
+    }
+    assert(decoded.enemies.size() == 2 && decoded.enemies[1].type == "FAST" && decoded.enemies[1].x == 2000.0f);
+    assert(decoded.playerSpawns.size() == level.playerSpawns.size());
+    assert(decoded.boss.has_value() && decoded.boss->health == 5000 && decoded.boss->bossId == 2);
+
+    std::cout << "Compiled image: " << image.size() << " bytes" << std::endl;
+    std::cout << "Round Trip: PASSED\n" << std::endl;
+}
+
+void test_rejects_bad_images() {
+    std::cout << "=== Test: Rejects Bad Images ===" << std::endl;
+
+    LevelData level = LevelLoader::LoadFromString(LEVEL_JSON);
+    std::vector<uint8_t> image = LevelBinary::Compile(level);
+    LevelData out;
+
+    std::vector<uint8_t> truncated(image.begin(), image.end() - 8);
+    [[maybe_unused]] bool accepted = LevelBinary::Decode(truncated.data(), truncated.size(), out);
+    assert(!accepted);
+
+    std::vector<uint8_t> wrongVersion = image;
+    wrongVersion[4] = static_cast<uint8_t>(LevelBinary::VERSION + 1);
+    accepted = LevelBinary::Decode(wrongVersion.data(), wrongVersion.size(), out);
+    assert(!accepted);
+
+    // A section pointing past the end of the file
+    std::vector<uint8_t> corrupt = image;
+    LevelBinary::FileHeader header;
+    std::memcpy(&header, corrupt.data(), sizeof(header));
+    header.obstacles.count = 100000;
+    std::memcpy(corrupt.data(), &header, sizeof(header));
+    accepted = LevelBinary::Decode(corrupt.data(), corrupt.size(), out);
+    assert(!accepted);
+
+    accepted = LevelBinary::Decode(nullptr, 0, out);
+    assert(!accepted);
+    std::cout << "Rejects Bad Images: PASSED\n" << std::endl;
+}
+
+void test_load_from_file_prefers_compiled() {
+    std::cout << "=== Test: Load From File Prefers Compiled ===" << std::endl;
+
+    {
+        std::ofstream json(JSON_PATH);
+        json << LEVEL_JSON;
+    }
+    const std::string compiledPath = LevelBinary::CompiledPath(JSON_PATH);
+    assert(compiledPath == "test_level_binary.rlvl");
+
+    // No compiled file yet: JSON
+    LevelData fromJson = LevelLoader::LoadFromFile(JSON_PATH);
+    LevelData unused;
+    [[maybe_unused]] const bool loadedCompiled = LevelLoader::LoadCompiled(JSON_PATH, unused);
+    assert(!loadedCompiled);
+
+    // Compiled file with a different name so we can tell which one was read
+    fromJson.name = "From Binary";
+    [[maybe_unused]] const bool saved = LevelBinary::SaveFile(fromJson, compiledPath);
+    assert(saved);
+    auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(JSON_PATH, now - std::chrono::seconds(10));
+    std::filesystem::last_write_time(compiledPath, now);
+
+    auto start = std::chrono::steady_clock::now();
+    LevelData fromBinary = LevelLoader::LoadFromFile(JSON_PATH);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(fromBinary.name == "From Binary");
+    assert(fromBinary.obstacles.size() == 3);
+    std::cout << "Compiled load took "
+              << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << " us" << std::endl;
+
+    // An edited JSON wins over a stale binary
+    std::filesystem::last_write_time(JSON_PATH, now + std::chrono::seconds(10));
+    [[maybe_unused]] const LevelData reloaded = LevelLoader::LoadFromFile(JSON_PATH);
+    assert(reloaded.name == "Binary Test");
+
+    std::remove(JSON_PATH);
+    std::remove(compiledPath.c_str());
+    std::cout << "Load From File: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing LevelBinary...\n" << std::endl;
+
+    try {
+        test_round_trip();
+        test_rejects_bad_images();
+        test_load_from_file_prefers_compiled();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::remove(JSON_PATH);
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
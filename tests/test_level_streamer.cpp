@@ -0,0 +1,260 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Level Streamer
+*/
+
+#include "ECS/LevelStreamer.hpp"
+#include "ECS/ScrollingSystem.hpp"
+#include "ECS/CollisionDetectionSystem.hpp"
+#include "ECS/Registry.hpp"
+#include "ECS/Component.hpp"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <thread>
+#include <unordered_map>
+
+using namespace RType::ECS;
+
+static const float DT = 1.0f / 60.0f;
+
+// A long level: 40 obstacle chunks 400px apart, two colliders each, enemies spread along it
+static LevelData MakeLongLevel() {
+    LevelData level;
+    level.name = "stream";
+    for (int i = 0; i < 40; i++) {
+        ObstacleDef obs;
+        obs.x = 200.0f + i * 400.0f;
+        obs.y = 0.0f;
+        obs.colliders.push_back({obs.x + 10.0f, 500.0f, 100.0f, 200.0f});
+        obs.colliders.push_back({obs.x - 50.0f, 0.0f, 80.0f, 120.0f});
+        level.obstacles.push_back(obs);
+    }
+    for (int i = 0; i < 20; i++) {
+        EnemyDef enemy;
+        enemy.type = "BASIC";
+        enemy.x = 1500.0f + i * 400.0f;
+        enemy.y = 300.0f;
+        level.enemies.push_back(enemy);
+    }
+    BossDef boss;
+    boss.x = 15000.0f;
+    boss.y = 300.0f;
+    level.boss = boss;
+    return level;
+}
+
+static std::unordered_map<uint32_t, Position> ColliderPositions(Registry& registry) {
+    std::unordered_map<uint32_t, Position> positions;
+    for (Entity entity : registry.GetEntitiesWithComponent<ObstacleMetadata>()) {
+        positions[registry.GetComponent<ObstacleMetadata>(entity).uniqueId] =
+            CollisionDetectionSystem::GetWorldPosition(registry, entity);
+    }
+    return positions;
+}
+
+void test_activation_time() {
+    std::cout << "=== Test: Activation Time ===" << std::endl;
+
+    assert(LevelStreamer::ActivationTime(1000.0f, -150.0f, 1920.0f) == 0.0f);
+    assert(LevelStreamer::ActivationTime(3420.0f, -150.0f, 1920.0f) == 10.0f);
+    // Content that never moves towards the screen is spawned up front
+    assert(LevelStreamer::ActivationTime(5000.0f, 0.0f, 1920.0f) == 0.0f);
+
+    std::cout << "Activation Time: PASSED\n" << std::endl;
+}
+
+void test_streamed_matches_eager() {
+    std::cout << "=== Test: Streamed Matches Eager ===" << std::endl;
+
+    LevelData level = MakeLongLevel();
+    ScrollingSystem scrolling;
+
+    Registry eager;
+    LevelLoader::CreateServerEntities(eager, level);
+
+    Registry streamed;
+    LevelStreamer streamer;
+    streamer.Start(streamed, level);
+    assert(streamer.GetTimelineSize() == 40 + 20 + 1);
+    assert(streamed.GetEntityCount() < eager.GetEntityCount());
+    std::cout << "At start: " << streamed.GetEntityCount() << " entities streamed vs "
+              << eager.GetEntityCount() << " eager" << std::endl;
+
+    const float windowEdge = level.config.screenWidth + DEFAULT_STREAM_LOOKAHEAD;
+    size_t peakStreamed = 0;
+    for (int tick = 0; tick < 60 * 120; tick++) {
+        scrolling.Update(eager, DT);
+        scrolling.Update(streamed, DT);
+        streamer.Update(streamed, DT);
+        peakStreamed = std::max(peakStreamed, ColliderPositions(streamed).size());
+
+        if (tick % 120 != 0) {
+            continue;
+        }
+        // Everything inside the window exists on both sides, at the same place and with the same id
+        auto eagerColliders = ColliderPositions(eager);
+        auto streamedColliders = ColliderPositions(streamed);
+        for (const auto& [id, pos] : eagerColliders) {
+            if (pos.x > windowEdge - 200.0f) {
+                continue;
+            }
+            auto it = streamedColliders.find(id);
+            assert(it != streamedColliders.end());
+            assert(std::fabs(it->second.x - pos.x) < 0.5f);
+            assert(it->second.y == pos.y);
+        }
+        for (const auto& [id, pos] : streamedColliders) {
+            // Far behind the screen the two may drop a collider a tick apart
+            assert(eagerColliders.count(id) == 1 || pos.x < -1000.0f);
+            assert(pos.x <= windowEdge + 200.0f);
+        }
+    }
+
+    assert(streamer.IsExhausted());
+    assert(peakStreamed < 80);
+    std::cout << "Peak streamed colliders: " << peakStreamed << " of 80" << std::endl;
+    std::cout << "Streamed Matches Eager: PASSED\n" << std::endl;
+}
+
+void test_level_space_obstacles() {
+    std::cout << "=== Test: Level Space Obstacles ===" << std::endl;
+
+    LevelData level = MakeLongLevel();
+    level.obstacles[1].scrollSpeed = -300.0f;
+    ScrollingSystem scrolling;
+    Registry registry;
+    LevelStreamer streamer;
+    streamer.Start(registry, level);
+
+    Entity anchored = NULL_ENTITY;
+    Entity scrolled = NULL_ENTITY;
+    for (Entity entity : streamer.GetSpawned().obstacleColliders) {
+        if (registry.HasComponent<LevelSpace>(entity)) {
+            anchored = anchored == NULL_ENTITY ? entity : anchored;
+        } else {
+            scrolled = entity;
+        }
+    }
+    // Obstacles at the background speed follow the scroll offset, others still scroll themselves
+    assert(anchored != NULL_ENTITY && scrolled != NULL_ENTITY);
+    assert(!registry.HasComponent<Scrollable>(anchored));
+    assert(registry.HasComponent<Scrollable>(scrolled));
+
+    const Position levelPos = registry.GetComponent<Position>(anchored);
+    for (int tick = 0; tick < 60; tick++) {
+        scrolling.Update(registry, DT);
+        streamer.Update(registry, DT);
+    }
+
+    // No writes to the stored position, the world position moved by one second of scroll
+    const Position& stored = registry.GetComponent<Position>(anchored);
+    assert(stored.x == levelPos.x && stored.y == levelPos.y);
+    assert(std::fabs(registry.GetScrollOffset() - (-150.0f)) < 0.01f);
+    const Position world = CollisionDetectionSystem::GetWorldPosition(registry, anchored);
+    assert(std::fabs(world.x - (levelPos.x - 150.0f)) < 0.01f);
+
+    // Collision queries see the obstacle where it is on screen
+    Entity probe = registry.CreateEntity();
+    registry.AddComponent<BoxCollider>(probe, BoxCollider{10.0f, 10.0f});
+    registry.AddComponent<Position>(probe, Position{world.x + 5.0f, world.y + 5.0f});
+    assert(CollisionDetectionSystem::CheckCollision(registry, probe, anchored));
+    registry.GetComponent<Position>(probe).x = levelPos.x + 5.0f;
+    assert(!CollisionDetectionSystem::CheckCollision(registry, probe, anchored));
+
+    std::cout << "Level Space Obstacles: PASSED\n" << std::endl;
+}
+
+void test_enemies_and_boss() {
+    std::cout << "=== Test: Enemies And Boss ===" << std::endl;
+
+    LevelData level = MakeLongLevel();
+    Registry registry;
+    LevelStreamer streamer;
+    streamer.Start(registry, level);
+
+    const float windowEdge = level.config.screenWidth + DEFAULT_STREAM_LOOKAHEAD;
+    size_t seenEnemies = streamer.GetSpawned().enemies.size();
+    assert(seenEnemies == 2);
+
+    for (int tick = 0; tick < 60 * 120 && !streamer.IsExhausted(); tick++) {
+        streamer.Update(registry, DT);
+        const auto& enemies = streamer.GetSpawned().enemies;
+        for (; seenEnemies < enemies.size(); seenEnemies++) {
+            // Spawned just inside the window edge, never in view
+            float x = registry.GetComponent<Position>(enemies[seenEnemies]).x;
+            assert(x <= windowEdge && x > windowEdge - 10.0f);
+        }
+    }
+
+    assert(streamer.IsExhausted());
+    assert(seenEnemies == level.enemies.size());
+    Entity boss = streamer.GetSpawned().boss;
+    assert(boss != NULL_ENTITY);
+    assert(registry.GetComponent<Position>(boss).x <= windowEdge);
+
+    streamer.Clear();
+    assert(streamer.GetTimelineSize() == 0 && streamer.IsExhausted());
+
+    std::cout << "Enemies And Boss: PASSED\n" << std::endl;
+}
+
+void test_prepare_off_thread() {
+    std::cout << "=== Test: Prepare Off Thread ===" << std::endl;
+
+    LevelData level = MakeLongLevel();
+
+    Registry started;
+    LevelStreamer reference;
+    reference.Start(started, level);
+
+    // The timeline is built on another thread while the registry is busy elsewhere
+    LevelStreamer prepared;
+    std::thread loader([&prepared, &level]() { prepared.Prepare(level); });
+    loader.join();
+    assert(prepared.GetTimelineSize() == reference.GetTimelineSize());
+    assert(prepared.GetSpawned().obstacleColliders.empty() && prepared.HasBoss());
+
+    Registry swapped;
+    swapped.SetScrollOffset(1234.0f);
+    LevelStreamer current = std::move(prepared);
+    current.Begin(swapped);
+    assert(swapped.GetScrollOffset() == 0.0f);
+    assert(current.GetSpawned().obstacleColliders.size() == reference.GetSpawned().obstacleColliders.size());
+    assert(current.GetSpawned().enemies.size() == reference.GetSpawned().enemies.size());
+
+    for (int tick = 0; tick < 60 * 20; tick++) {
+        reference.Update(started, DT);
+        current.Update(swapped, DT);
+    }
+    auto expected = ColliderPositions(started);
+    auto actual = ColliderPositions(swapped);
+    assert(expected.size() == actual.size() && !expected.empty());
+    for (const auto& [id, pos] : expected) {
+        assert(actual.count(id) == 1);
+        assert(actual[id].x == pos.x && actual[id].y == pos.y);
+    }
+    std::cout << expected.size() << " colliders identical to Start()" << std::endl;
+
+    std::cout << "Prepare Off Thread: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing LevelStreamer...\n" << std::endl;
+
+    try {
+        test_activation_time();
+        test_streamed_matches_eager();
+        test_level_space_obstacles();
+        test_enemies_and_boss();
+        test_prepare_off_thread();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -7,15 +7,91 @@
 
 #include "LobbyServer.hpp"
 #include "LobbyClient.hpp"
+#include "RoomManager.hpp"
+#include "RoomClient.hpp"
 #include "AsioNetworkModule.hpp"
+#include "LoopbackNetworkModule.hpp"
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <memory>
+#include <cassert>
+#include <functional>
 
 using namespace std::chrono_literals;
 
+// START_REQ on a ready room starts the game at once: one GAME_START, one
+// onGameStart, and the ready countdown is cancelled so it cannot start it again
+void test_room_start_request() {
+    std::cout << "=== Test: Room Start Request ===" << std::endl;
+
+    Network::LoopbackNetworkModule network;
+    network::RoomManager manager(&network, 4250);
+    int gameStarts = 0;
+    uint32_t startedSeed = 0;
+    manager.onGameStart([&](uint32_t, const network::RoomManager::Room& room) {
+        gameStarts++;
+        startedSeed = room.gameSeed;
+    });
+
+    auto pump = [&](const std::function<bool()>& done) {
+        for (int frame = 0; frame < 200 && !done(); frame++) {
+            manager.update();
+            network.AdvanceTime(0.01);
+        }
+    };
+
+    uint32_t roomId = 0;
+    network::RoomClient host(&network, "127.0.0.1", 4250);
+    host.onRoomCreated([&roomId](uint32_t id) { roomId = id; });
+    host.createRoom("start");
+    pump([&] { host.update(); return roomId != 0; });
+    assert(roomId != 0);
+
+    std::vector<std::unique_ptr<network::LobbyClient>> lobbies;
+    for (const char* name : {"Alice", "Bob"}) {
+        network::RoomClient rooms(&network, "127.0.0.1", 4250);
+        rooms.joinRoom(roomId);
+        pump([&] { rooms.update(); return rooms.hasJoinedRoom(); });
+        assert(rooms.hasJoinedRoom());
+        lobbies.push_back(std::make_unique<network::LobbyClient>(rooms.releaseSocket()));
+        lobbies.back()->connect(name);
+    }
+    auto updateLobbies = [&] {
+        for (auto& lobby : lobbies) {
+            lobby->update();
+        }
+    };
+    pump([&] { updateLobbies(); return lobbies[0]->isConnected() && lobbies[1]->isConnected(); });
+
+    // Not everybody is ready yet: the request is ignored
+    lobbies[0]->ready();
+    lobbies[0]->requestStart();
+    pump([&] { updateLobbies(); return false; });
+    assert(gameStarts == 0 && !lobbies[0]->isGameStarted());
+
+    lobbies[1]->ready();
+    pump([&] { updateLobbies(); return manager.getRooms().at(roomId).countdownActive; });
+    assert(manager.getRooms().at(roomId).countdownActive);
+    lobbies[1]->requestStart();
+    pump([&] { updateLobbies(); return lobbies[0]->isGameStarted() && lobbies[1]->isGameStarted(); });
+    assert(lobbies[0]->isGameStarted() && lobbies[1]->isGameStarted());
+    assert(gameStarts == 1 && lobbies[0]->getGameSeed() == startedSeed);
+    assert(manager.getRooms().at(roomId).inGame && !manager.getRooms().at(roomId).countdownActive);
+    std::cout << "START_REQ started the room and cancelled its countdown" << std::endl;
+
+    // A second request on a room already in game changes nothing
+    lobbies[0]->requestStart();
+    pump([&] { updateLobbies(); return false; });
+    assert(gameStarts == 1);
+    std::cout << "Repeated START_REQ ignored" << std::endl;
+
+    std::cout << "Room Start Request: PASSED\n" << std::endl;
+}
+
 int main() {
+    test_room_start_request();
+
     std::cout << "=== Lobby Test ===" << std::endl;
 
     std::thread serverThread([]() {
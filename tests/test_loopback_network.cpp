@@ -0,0 +1,235 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Loopback Network Module
+*/
+
+#include "LoopbackNetworkModule.hpp"
+#include "RoomManager.hpp"
+#include "RoomClient.hpp"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+
+using namespace Network;
+
+static std::vector<std::uint8_t> MakePayload(std::uint8_t value, std::size_t size = 8) {
+    return std::vector<std::uint8_t>(size, value);
+}
+
+void test_latency_and_virtual_clock() {
+    std::cout << "=== Test: Latency And Virtual Clock ===" << std::endl;
+
+    LoopbackNetworkModule network;
+    LinkConditions conditions;
+    conditions.latency = 0.05;
+    network.SetConditions(conditions);
+
+    SocketId server = network.CreateUdpSocket();
+    [[maybe_unused]] bool bound = network.BindUdp(server, 4242);
+    assert(bound);
+    SocketId client = network.CreateUdpSocket();
+    [[maybe_unused]] bool sent = network.SendUdp(client, MakePayload(1), Endpoint("127.0.0.1", 4242));
+    assert(sent);
+
+    auto early = network.ReceiveUdp(server);
+    assert(!early);
+    network.AdvanceTime(0.049);
+    early = network.ReceiveUdp(server);
+    assert(!early);
+    network.AdvanceTime(0.002);
+    auto packet = network.ReceiveUdp(server);
+    assert(packet && packet->data == MakePayload(1));
+    assert(packet->from == network.GetSocketInfo(client).localEndpoint);
+    std::cout << "Datagram arrives only after the configured latency" << std::endl;
+
+    sent = network.SendUdp(server, MakePayload(2), packet->from);
+    assert(sent);
+    network.AdvanceTime(0.05);
+    auto reply = network.ReceiveUdp(client);
+    assert(reply && reply->data == MakePayload(2));
+    std::cout << "Replies reach the sender's ephemeral port" << std::endl;
+
+    std::cout << "Latency: PASSED\n" << std::endl;
+}
+
+void test_loss_and_reordering() {
+    std::cout << "=== Test: Loss And Reordering ===" << std::endl;
+
+    LoopbackNetworkModule network;
+    network.SetSeed(42);
+    LinkConditions conditions;
+    conditions.latency = 0.02;
+    conditions.lossRate = 0.2f;
+    conditions.reorderRate = 0.1f;
+    network.SetConditions(conditions);
+
+    SocketId server = network.CreateUdpSocket();
+    network.BindUdp(server, 4242);
+    SocketId client = network.CreateUdpSocket();
+
+    const int count = 2000;
+    for (int i = 0; i < count; i++) {
+        network.SendUdp(client, MakePayload(static_cast<std::uint8_t>(i % 256), 4), Endpoint("127.0.0.1", 4242));
+        network.AdvanceTime(0.001);
+    }
+    network.AdvanceTime(1.0);
+
+    int received = 0;
+    int outOfOrder = 0;
+    int last = -1;
+    while (auto packet = network.ReceiveUdp(server)) {
+        int value = packet->data[0];
+        if (last >= 0 && value < last && last - value < 128) {
+            outOfOrder++;
+        }
+        last = value;
+        received++;
+    }
+
+    auto stats = network.GetStats();
+    assert(stats.datagramsSent == count);
+    assert(stats.datagramsDelivered == static_cast<std::uint64_t>(received));
+    assert(stats.datagramsLost + stats.datagramsDelivered == count);
+    assert(std::abs(static_cast<double>(stats.datagramsLost) / count - 0.2) < 0.05);
+    assert(stats.datagramsReordered > 0 && outOfOrder > 0);
+    std::cout << "Lost " << stats.datagramsLost << "/" << count << ", "
+              << outOfOrder << " arrived out of order" << std::endl;
+
+    std::cout << "Loss and reordering: PASSED\n" << std::endl;
+}
+
+void test_bandwidth_cap() {
+    std::cout << "=== Test: Bandwidth Cap ===" << std::endl;
+
+    LoopbackNetworkModule network;
+    LinkConditions conditions;
+    conditions.bandwidth = 10000;
+    conditions.queueLimit = 5000;
+    network.SetConditions(conditions);
+
+    SocketId server = network.CreateUdpSocket();
+    network.BindUdp(server, 4242);
+    SocketId client = network.CreateUdpSocket();
+
+    for (int i = 0; i < 10; i++) {
+        network.SendUdp(client, MakePayload(0, 1000), Endpoint("127.0.0.1", 4242));
+    }
+    [[maybe_unused]] auto stats = network.GetStats();
+    assert(stats.datagramsOverflowed == 5);
+    std::cout << "Datagrams beyond the queue limit are tail-dropped" << std::endl;
+
+    network.AdvanceTime(0.2);
+    int received = 0;
+    while (network.ReceiveUdp(server)) {
+        received++;
+    }
+    assert(received == 2);
+    network.AdvanceTime(0.3);
+    while (network.ReceiveUdp(server)) {
+        received++;
+    }
+    assert(received == 5);
+    std::cout << "Queued datagrams drain at the configured rate" << std::endl;
+
+    std::cout << "Bandwidth: PASSED\n" << std::endl;
+}
+
+void test_tcp_stream() {
+    std::cout << "=== Test: TCP Stream ===" << std::endl;
+
+    LoopbackNetworkModule network;
+    LinkConditions conditions;
+    conditions.latency = 0.01;
+    conditions.jitter = 0.02;
+    network.SetConditions(conditions);
+
+    SocketId listener = network.CreateTcpSocket();
+    [[maybe_unused]] bool listening = network.BindTcp(listener, 4243) && network.ListenTcp(listener);
+    assert(listening);
+
+    SocketId refused = network.CreateTcpSocket();
+    [[maybe_unused]] bool connected = network.ConnectTcp(refused, Endpoint("127.0.0.1", 9999));
+    assert(!connected);
+    assert(network.GetLastError() == SocketError::ConnectionRefused);
+
+    SocketId client = network.CreateTcpSocket();
+    connected = network.ConnectTcp(client, Endpoint("127.0.0.1", 4243));
+    assert(connected);
+    Endpoint clientEndpoint;
+    auto accepted = network.AcceptTcp(listener, clientEndpoint);
+    assert(accepted);
+    assert(clientEndpoint == network.GetSocketInfo(client).localEndpoint);
+    std::cout << "Connect and accept pair the two sockets" << std::endl;
+
+    for (std::uint8_t i = 0; i < 50; i++) {
+        [[maybe_unused]] bool sent = network.SendTcp(client, MakePayload(i));
+        assert(sent);
+    }
+    network.AdvanceTime(0.1);
+    for (std::uint8_t i = 0; i < 50; i++) {
+        auto message = network.ReceiveTcp(*accepted);
+        assert(message && (*message)[0] == i);
+    }
+    std::cout << "Messages stay ordered despite jitter" << std::endl;
+
+    network.CloseSocket(client);
+    auto afterClose = network.ReceiveTcp(*accepted);
+    assert(!afterClose);
+    assert(network.GetLastError() == SocketError::Disconnected);
+    [[maybe_unused]] bool sentAfterClose = network.SendTcp(*accepted, MakePayload(0));
+    assert(!sentAfterClose);
+    std::cout << "Closing one side disconnects the other" << std::endl;
+
+    std::cout << "TCP: PASSED\n" << std::endl;
+}
+
+void test_room_manager_over_loopback() {
+    std::cout << "=== Test: RoomManager Over Loopback ===" << std::endl;
+
+    LoopbackNetworkModule network;
+    LinkConditions conditions;
+    conditions.latency = 0.04;
+    network.SetConditions(conditions);
+
+    network::RoomManager manager(&network, 4244);
+    network::RoomClient client(&network, "127.0.0.1", 4244);
+    assert(client.isConnected());
+
+    bool created = false;
+    client.onRoomCreated([&created](uint32_t) { created = true; });
+    client.createRoom("loopback");
+
+    double elapsed = 0.0;
+    while (!created && elapsed < 1.0) {
+        manager.update();
+        client.update();
+        network.AdvanceTime(0.01);
+        elapsed += 0.01;
+    }
+    assert(created);
+    assert(manager.roomCount() == 1);
+    assert(elapsed >= 0.08);
+    std::cout << "Room created after one simulated round trip (" << elapsed << "s)" << std::endl;
+
+    std::cout << "RoomManager: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing LoopbackNetworkModule...\n" << std::endl;
+
+    try {
+        test_latency_and_virtual_clock();
+        test_loss_and_reordering();
+        test_bandwidth_cap();
+        test_tcp_stream();
+        test_room_manager_over_loopback();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
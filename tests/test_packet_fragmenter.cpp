@@ -0,0 +1,113 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Packet Fragmenter
+*/
+
+#include "PacketFragmenter.hpp"
+#include <iostream>
+#include <cassert>
+
+using namespace network;
+
+static std::vector<uint8_t> MakePacket(size_t size, uint8_t seed) {
+    std::vector<uint8_t> packet(size);
+    for (size_t i = 0; i < size; i++) {
+        packet[i] = static_cast<uint8_t>(seed + i * 7);
+    }
+    packet[0] = static_cast<uint8_t>(GamePacket::STATE);
+    return packet;
+}
+
+void test_small_packet_untouched() {
+    std::cout << "=== Test: Small Packet Untouched ===" << std::endl;
+
+    auto packet = MakePacket(200, 1);
+    auto datagrams = PacketFragmenter::Split(packet, 0);
+    assert(datagrams.size() == 1);
+    assert(datagrams[0] == packet);
+    std::cout << "Packets under the MTU are sent as-is" << std::endl;
+
+    std::cout << "Small packet: PASSED\n" << std::endl;
+}
+
+void test_out_of_order_reassembly() {
+    std::cout << "=== Test: Out Of Order Reassembly ===" << std::endl;
+
+    auto packet = MakePacket(MAX_ENTITIES * sizeof(EntityState) + sizeof(StatePacketHeader), 3);
+    auto datagrams = PacketFragmenter::Split(packet, 42);
+    assert(datagrams.size() > 1);
+    for (const auto& datagram : datagrams) {
+        assert(datagram.size() <= MAX_UDP_DATAGRAM_SIZE);
+    }
+    std::cout << "Split " << packet.size() << " bytes into " << datagrams.size() << " fragments" << std::endl;
+
+    FragmentReassembler reassembler;
+    std::optional<std::vector<uint8_t>> result;
+    for (size_t i = datagrams.size(); i-- > 0;) {
+        assert(!result);
+        result = reassembler.AddFragment(datagrams[i], 0.0);
+        if (i == 1) {
+            auto duplicate = reassembler.AddFragment(datagrams[i], 0.0);
+            assert(!duplicate);
+        }
+    }
+    assert(result && *result == packet);
+    assert(reassembler.GetPendingCount() == 0);
+    assert(reassembler.GetStats().packetsReassembled == 1);
+    std::cout << "Reverse order and duplicate fragments reassemble correctly" << std::endl;
+
+    std::cout << "Reassembly: PASSED\n" << std::endl;
+}
+
+void test_timeout_and_stale() {
+    std::cout << "=== Test: Timeout And Stale Partials ===" << std::endl;
+
+    auto first = PacketFragmenter::Split(MakePacket(3000, 5), 1);
+    auto second = PacketFragmenter::Split(MakePacket(3000, 9), 2);
+    auto third = PacketFragmenter::Split(MakePacket(3000, 11), 3);
+
+    FragmentReassembler reassembler;
+    reassembler.AddFragment(first[0], 0.0);
+    for (const auto& datagram : second) {
+        reassembler.AddFragment(datagram, 0.01);
+    }
+    assert(reassembler.GetPendingCount() == 0);
+    assert(reassembler.GetStats().stalePackets == 1);
+    auto late = reassembler.AddFragment(first[1], 0.02);
+    assert(!late);
+    std::cout << "Older partial dropped when a newer packet completes" << std::endl;
+
+    reassembler.AddFragment(third[0], 1.0);
+    reassembler.Expire(1.1);
+    assert(reassembler.GetPendingCount() == 1);
+    reassembler.Expire(2.0);
+    assert(reassembler.GetPendingCount() == 0);
+    assert(reassembler.GetStats().timedOutPackets == 1);
+    std::cout << "Incomplete packet expires after the timeout" << std::endl;
+
+    std::vector<uint8_t> truncated(third[1].begin(), third[1].begin() + 10);
+    auto rejected = reassembler.AddFragment(truncated, 2.0);
+    assert(!rejected);
+    assert(reassembler.GetStats().invalidFragments == 1);
+    std::cout << "Truncated fragment rejected" << std::endl;
+
+    std::cout << "Timeout and stale: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing PacketFragmenter...\n" << std::endl;
+
+    try {
+        test_small_packet_untouched();
+        test_out_of_order_reassembly();
+        test_timeout_and_stale();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,186 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Recording Renderer
+*/
+
+#include "Renderer/RecordingRenderer.hpp"
+#include "ECS/Component.hpp"
+#include "ECS/Registry.hpp"
+#include "ECS/RenderingSystem.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+
+using namespace Renderer;
+
+static const char* TEXTURE_PATH = "test_recording_renderer.png";
+static const char* SECOND_TEXTURE_PATH = "test_recording_renderer_2.png";
+
+// PNG signature followed by an IHDR chunk header: enough for the size probe
+static void WritePngHeader(const char* path, std::uint32_t width, std::uint32_t height) {
+    const unsigned char header[24] = {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        static_cast<unsigned char>(width >> 24), static_cast<unsigned char>(width >> 16),
+        static_cast<unsigned char>(width >> 8), static_cast<unsigned char>(width),
+        static_cast<unsigned char>(height >> 24), static_cast<unsigned char>(height >> 16),
+        static_cast<unsigned char>(height >> 8), static_cast<unsigned char>(height)};
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+void test_rendering_system_commands() {
+    std::cout << "=== Test: RenderingSystem Commands ===" << std::endl;
+
+    RecordingRenderer renderer;
+    [[maybe_unused]] bool windowCreated = renderer.CreateWindow(WindowConfig{});
+    assert(windowCreated);
+
+    TextureId ships = renderer.LoadTexture(TEXTURE_PATH);
+    TextureId bullets = renderer.LoadTexture(SECOND_TEXTURE_PATH);
+    assert(ships != INVALID_TEXTURE_ID && renderer.GetTextureSize(ships).x == 64.0f);
+    SpriteId shipSprite = renderer.CreateSprite(ships, Rectangle{});
+    SpriteId bulletSprite = renderer.CreateSprite(bullets, Rectangle{{0, 0}, {8, 8}});
+
+    RType::ECS::Registry registry;
+    for (int i = 0; i < 300; i++) {
+        auto entity = registry.CreateEntity();
+        registry.AddComponent<RType::ECS::Position>(entity, RType::ECS::Position(i * 2.0f, 100.0f));
+        bool bullet = (i % 3 == 0);
+        registry.AddComponent<RType::ECS::Drawable>(entity,
+            RType::ECS::Drawable(bullet ? bulletSprite : shipSprite, bullet ? 5 : 1));
+    }
+
+    RType::ECS::RenderingSystem system(&renderer);
+    renderer.BeginFrame();
+    renderer.Clear(Color(0, 0, 0, 1));
+    system.Update(registry, 1.0f / 60.0f);
+    renderer.EndFrame();
+
+    auto stats = renderer.GetRenderStats();
+    assert(stats.sprites == 300);
+    assert(stats.batches == 2 && stats.drawCalls == 2);
+    assert(stats.vertices == 300 * SpriteBatch::VERTICES_PER_SPRITE);
+    assert(stats.textureSwitches == 1);
+    assert(renderer.GetCommands().size() == 301);
+    assert(renderer.CountSpritesByLayer().at(5) == 100);
+    assert(renderer.CountSpritesByTexture().at(ships) == 200);
+    std::cout << "300 entities on 2 layers recorded as 2 batches" << std::endl;
+
+    renderer.BeginFrame();
+    system.Update(registry, 1.0f / 60.0f);
+    FontId font = renderer.LoadFont(TEXTURE_PATH, 20);
+    renderer.DrawText(font, "SCORE", TextParams{});
+    renderer.EndFrame();
+    stats = renderer.GetRenderStats();
+    assert(stats.batches == 2 && stats.drawCalls == 3);
+    assert(renderer.GetCommandText(renderer.GetCommands().back()) == "SCORE");
+    std::cout << "Text flushes pending sprites and is recorded" << std::endl;
+
+    std::cout << "Commands: PASSED\n" << std::endl;
+}
+
+void test_software_rasterizer() {
+    std::cout << "=== Test: Software Rasterizer ===" << std::endl;
+
+    RecordingRenderer renderer;
+    renderer.SetRasterizationEnabled(true);
+    WindowConfig config;
+    config.width = 320;
+    config.height = 180;
+    renderer.CreateWindow(config);
+
+    TextureId texture = renderer.LoadTexture(TEXTURE_PATH);
+    // Left half opaque green, right half opaque blue
+    std::vector<std::uint32_t> pixels(4 * 4);
+    for (std::uint32_t y = 0; y < 4; y++) {
+        for (std::uint32_t x = 0; x < 4; x++) {
+            pixels[y * 4 + x] = (x < 2) ? 0x00FF00FF : 0x0000FFFF;
+        }
+    }
+    renderer.SetTexturePixels(texture, 4, 4, pixels);
+    SpriteId sprite = renderer.CreateSprite(texture, Rectangle{});
+
+    renderer.BeginFrame();
+    renderer.Clear(Color(0, 0, 0, 1));
+    renderer.DrawRectangle(Rectangle{{0, 0}, {400, 400}}, Color(1, 0, 0, 1));
+    Transform2D transform;
+    transform.position = {800, 400};
+    transform.scale = {40, 40};
+    renderer.DrawSprite(sprite, transform);
+    renderer.EndFrame();
+
+    // The default camera maps the 1280x720 world onto the 320x180 image (factor 4)
+    assert(renderer.GetPixel(10, 10) == 0xFF0000FF);
+    assert(renderer.GetPixel(150, 10) == 0x000000FF);
+    assert(renderer.GetPixel(205, 105) == 0x00FF00FF);
+    assert(renderer.GetPixel(235, 135) == 0x0000FFFF);
+    assert(renderer.GetPixel(245, 105) == 0x000000FF);
+    std::cout << "Rectangles and textured sprites land on the expected pixels" << std::endl;
+
+    std::cout << "Rasterizer: PASSED\n" << std::endl;
+}
+
+void test_texture_cache() {
+    std::cout << "=== Test: Texture Cache ===" << std::endl;
+
+    RecordingRenderer renderer;
+    renderer.CreateWindow(WindowConfig{});
+
+    TextureId first = renderer.LoadTexture(TEXTURE_PATH);
+    TextureId again = renderer.LoadTexture(std::string("./") + TEXTURE_PATH);
+    [[maybe_unused]] TextureId other = renderer.LoadTexture(SECOND_TEXTURE_PATH);
+    assert(first == again && first != other);
+    assert(renderer.GetLoadedTextureCount() == 2);
+    assert(renderer.GetTextureCacheHits() == 1 && renderer.GetTextureCacheMisses() == 2);
+    std::cout << "Equivalent paths share one texture" << std::endl;
+
+    TextureConfig sharp;
+    sharp.smooth = false;
+    [[maybe_unused]] TextureId sharpTexture = renderer.LoadTexture(TEXTURE_PATH, sharp);
+    assert(sharpTexture != first);
+    std::cout << "Different sampling settings get their own texture" << std::endl;
+
+    SpriteId sprite = renderer.CreateSprite(first, Rectangle{});
+    renderer.UnloadTexture(first);
+    assert(renderer.GetTextureSize(first).x == 64.0f);
+    renderer.BeginFrame();
+    renderer.DrawSprite(sprite, Transform2D{});
+    renderer.EndFrame();
+    assert(renderer.GetRenderStats().sprites == 1);
+    std::cout << "Unloading one reference keeps the texture and its sprites" << std::endl;
+
+    renderer.UnloadTexture(again);
+    assert(renderer.GetTextureSize(first).x == 0.0f);
+    assert(renderer.GetLoadedTextureCount() == 2);
+    [[maybe_unused]] TextureId reloaded = renderer.LoadTexture(TEXTURE_PATH);
+    assert(reloaded != first);
+    assert(renderer.GetTextureCacheMisses() == 4);
+    std::cout << "The last unload evicts the texture" << std::endl;
+
+    std::cout << "Cache: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing RecordingRenderer...\n" << std::endl;
+
+    WritePngHeader(TEXTURE_PATH, 64, 32);
+    WritePngHeader(SECOND_TEXTURE_PATH, 8, 8);
+    try {
+        test_rendering_system_commands();
+        test_software_rasterizer();
+        test_texture_cache();
+
+        std::remove(TEXTURE_PATH);
+        std::remove(SECOND_TEXTURE_PATH);
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::remove(TEXTURE_PATH);
+        std::remove(SECOND_TEXTURE_PATH);
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,245 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Registry
+*/
+
+#include "ECS/Registry.hpp"
+#include "ECS/Component.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <algorithm>
+#include <vector>
+
+using namespace RType::ECS;
+
+struct LateComponent : public IComponent {
+    int value = 0;
+
+    LateComponent() = default;
+    LateComponent(int v) : value(v) {}
+};
+
+void test_component_ids() {
+    std::cout << "=== Test: Component IDs ===" << std::endl;
+
+    const ComponentID position = GetComponentID<Position>();
+    const ComponentID velocity = GetComponentID<Velocity>();
+    assert(position != velocity);
+    assert(GetComponentID<Position>() == position);
+    std::cout << "Distinct types get distinct, stable ids" << std::endl;
+
+    std::cout << "Component IDs: PASSED\n" << std::endl;
+}
+
+void test_pool_access() {
+    std::cout << "=== Test: Pool Access ===" << std::endl;
+
+    Registry registry;
+    Entity entity = registry.CreateEntity();
+    registry.AddComponent<Position>(entity, Position{1.0f, 2.0f});
+
+    // A cached pool survives new component types growing the pool array
+    auto& positions = registry.GetComponentPool<Position>();
+    assert(!registry.HasComponent<LateComponent>(entity));
+    registry.AddComponent<LateComponent>(entity, LateComponent(7));
+    assert(&registry.GetComponentPool<Position>() == &positions);
+    assert(positions.Has(entity) && positions.Get(entity).y == 2.0f);
+
+    positions.Get(entity).x = 5.0f;
+    assert(registry.GetComponent<Position>(entity).x == 5.0f);
+    assert(registry.GetComponent<LateComponent>(entity).value == 7);
+
+    // Destroying an entity clears it from every pool
+    registry.DestroyEntity(entity);
+    assert(!positions.Has(entity));
+    assert(!registry.HasComponent<LateComponent>(entity));
+
+    // Another registry has its own pools under the same ids
+    Registry other;
+    assert(!other.HasComponent<Position>(entity));
+    assert(other.GetEntitiesWithComponent<LateComponent>().empty());
+
+    std::cout << "Pool Access: PASSED\n" << std::endl;
+}
+
+void test_signatures() {
+    std::cout << "=== Test: Signatures ===" << std::endl;
+
+    Registry registry;
+    Entity entity = registry.CreateEntity();
+    assert(registry.GetSignature(entity).none());
+
+    registry.AddComponent<Position>(entity, Position{0.0f, 0.0f});
+    registry.AddComponent<Velocity>(entity, Velocity{1.0f, 0.0f});
+    assert(registry.GetSignature(entity) == (Registry::MakeSignature<Position, Velocity>()));
+    assert((registry.HasComponents<Position, Velocity>(entity)));
+    assert(!(registry.HasComponents<Position, Health>(entity)));
+
+    registry.RemoveComponent<Velocity>(entity);
+    assert(registry.GetSignature(entity) == Registry::MakeSignature<Position>());
+    assert(!(registry.HasComponents<Position, Velocity>(entity)));
+
+    // A recycled id starts with an empty signature
+    registry.DestroyEntity(entity);
+    Entity reused = registry.CreateEntity();
+    assert(reused == entity);
+    assert(registry.GetSignature(reused).none());
+    assert(!registry.HasComponents<Position>(reused));
+
+    std::cout << "Signatures: PASSED\n" << std::endl;
+}
+
+void test_cached_queries() {
+    std::cout << "=== Test: Cached Queries ===" << std::endl;
+
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 10; i++) {
+        Entity entity = registry.CreateEntity();
+        registry.AddComponent<Position>(entity, Position{0.0f, 0.0f});
+        if (i % 2 == 0) {
+            registry.AddComponent<Velocity>(entity, Velocity{0.0f, 0.0f});
+        }
+        entities.push_back(entity);
+    }
+
+    auto moving = registry.GetEntitiesWithComponents<Position, Velocity>();
+    assert(moving.size() == 5);
+    assert(registry.GetEntitiesWithComponent<Position>().size() == 10);
+
+    // The cached lists follow adds, removes and destruction
+    registry.AddComponent<Velocity>(entities[1], Velocity{0.0f, 0.0f});
+    registry.RemoveComponent<Velocity>(entities[4]);
+    registry.DestroyEntity(entities[8]);
+    moving = registry.GetEntitiesWithComponents<Position, Velocity>();
+    assert((moving == std::vector<Entity>{entities[0], entities[1], entities[2], entities[6]}));
+    assert(registry.GetEntitiesWithComponent<Position>().size() == 9);
+
+    // Replacing a component does not duplicate the entity
+    registry.AddComponent<Velocity>(entities[0], Velocity{2.0f, 0.0f});
+    assert((registry.GetEntitiesWithComponents<Position, Velocity>().size() == 4));
+
+    // A recycled id rejoins in ascending order, like the pools iterate
+    Entity reused = registry.CreateEntity();
+    assert(reused == entities[8]);
+    registry.AddComponent<Velocity>(reused, Velocity{0.0f, 0.0f});
+    registry.AddComponent<Position>(reused, Position{0.0f, 0.0f});
+    moving = registry.GetEntitiesWithComponents<Position, Velocity>();
+    assert(moving.size() == 5 && moving[4] == reused);
+    assert(std::is_sorted(moving.begin(), moving.end()));
+
+    // Type order does not matter
+    assert((registry.GetEntitiesWithComponents<Velocity, Position>() == moving));
+
+    std::cout << "Cached Queries: PASSED\n" << std::endl;
+}
+
+void test_change_ticks() {
+    std::cout << "=== Test: Change Ticks ===" << std::endl;
+
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 4; i++) {
+        Entity entity = registry.CreateEntity();
+        registry.AddComponent<Position>(entity, Position{0.0f, 0.0f});
+        registry.AddComponent<Health>(entity, Health(100));
+        entities.push_back(entity);
+    }
+    assert(registry.ChangedSince<Position>(entities[0], 0));
+
+    const uint32_t built = registry.GetChangeTick();
+    registry.AdvanceChangeTick();
+    assert((registry.GetEntitiesChangedSince<Position, Health>(built).empty()));
+
+    // Const reads leave the ticks alone, mutable access stamps the component
+    const Registry& view = registry;
+    assert(view.GetComponent<Position>(entities[0]).x == 0.0f);
+    registry.GetComponent<Position>(entities[1]).x = 10.0f;
+    registry.GetComponentPool<Health>().Get(entities[2]).current = 50;
+    assert(!registry.ChangedSince<Position>(entities[0], built));
+    assert(registry.ChangedSince<Position>(entities[1], built));
+    assert(!registry.ChangedSince<Health>(entities[1], built));
+    assert(registry.ChangedSince<Health>(entities[2], built));
+
+    auto changed = registry.GetEntitiesChangedSince<Position, Health>(built);
+    assert((changed == std::vector<Entity>{entities[1], entities[2]}));
+    assert(registry.GetEntitiesChangedSince<Position>(built).size() == 1);
+
+    // Adding or removing any component marks the entity itself
+    registry.AddComponent<Velocity>(entities[3], Velocity{1.0f, 0.0f});
+    assert((registry.AnyChangedSince<Position, Health>(entities[3], built)));
+
+    // A recycled id never passes for the entity it replaced
+    registry.DestroyEntity(entities[0]);
+    Entity reused = registry.CreateEntity();
+    assert(reused == entities[0]);
+    assert((registry.AnyChangedSince<Position>(reused, built)));
+
+    // Stamps made before the next advance belong to the next build
+    const uint32_t rebuilt = registry.GetChangeTick();
+    registry.AdvanceChangeTick();
+    assert((registry.GetEntitiesChangedSince<Position, Health>(rebuilt).empty()));
+
+    std::cout << "Change Ticks: PASSED\n" << std::endl;
+}
+
+void test_lookup_speed() {
+    std::cout << "=== Test: Lookup Speed ===" << std::endl;
+
+    Registry registry;
+    for (int i = 0; i < 2000; i++) {
+        Entity entity = registry.CreateEntity();
+        registry.AddComponent<Position>(entity, Position{static_cast<float>(i), 0.0f});
+        if (i % 2 == 0) {
+            registry.AddComponent<Velocity>(entity, Velocity{1.0f, 0.0f});
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    size_t hits = 0;
+    for (int pass = 0; pass < 200; pass++) {
+        for (Entity entity = 1; entity <= 2000; entity++) {
+            if (registry.HasComponent<Velocity>(entity) && registry.HasComponent<Position>(entity)) {
+                hits++;
+            }
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    assert(hits == 200 * 1000);
+    std::cout << "800000 HasComponent calls in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() << " us" << std::endl;
+
+    const auto queryStart = std::chrono::steady_clock::now();
+    hits = 0;
+    for (int pass = 0; pass < 200; pass++) {
+        hits += registry.GetEntitiesWithComponents<Position, Velocity>().size();
+    }
+    const auto queryElapsed = std::chrono::steady_clock::now() - queryStart;
+    assert(hits == 200 * 1000);
+    std::cout << "200 cached Position+Velocity queries in "
+              << std::chrono::duration_cast<std::chrono::microseconds>(queryElapsed).count() << " us" << std::endl;
+
+    std::cout << "Lookup Speed: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing Registry...\n" << std::endl;
+
+    try {
+        test_component_ids();
+        test_pool_access();
+        test_signatures();
+        test_cached_queries();
+        test_change_ticks();
+        test_lookup_speed();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,192 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Replay
+*/
+
+#include "GameServer.hpp"
+#include "InputLog.hpp"
+#include "LoopbackNetworkModule.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <sstream>
+
+using namespace network;
+
+static const uint16_t SERVER_PORT = 4242;
+static const uint64_t SEED = 0xC0FFEE;
+static const char* LEVEL_PATH = "assets/levels/level1.json";
+static const char* LOG_PATH = "test_replay_inputs.log";
+
+template <typename T>
+static std::vector<uint8_t> ToBytes(const T& packet) {
+    std::vector<uint8_t> data(sizeof(T));
+    std::memcpy(data.data(), &packet, sizeof(T));
+    return data;
+}
+
+static std::vector<PlayerInfo> MakePlayers() {
+    // Hashes chosen so lobby order, hash order and bucket order all differ
+    const uint64_t hashes[] = {0x9E3779B97F4A7C15ULL, 0x0000000000000042ULL, 0x7FFFFFFF00000001ULL};
+    std::vector<PlayerInfo> players;
+    for (uint8_t i = 0; i < 3; i++) {
+        PlayerInfo info;
+        info.number = i + 1;
+        info.hash = hashes[i];
+        std::snprintf(info.name, PLAYER_NAME_SIZE, "Replay%u", i + 1);
+        players.push_back(info);
+    }
+    return players;
+}
+
+// A headless room: one loopback socket per player, drained after every tick
+class Room {
+public:
+    explicit Room(const std::vector<PlayerInfo>& players)
+        : m_server(&m_network, SERVER_PORT, players, LEVEL_PATH), m_serverEndpoint("127.0.0.1", SERVER_PORT) {
+        m_server.SetSeed(SEED);
+        for (const auto& player : players) {
+            Network::SocketId socket = m_network.CreateUdpSocket();
+            [[maybe_unused]] bool bound = m_network.BindUdp(socket, 0);
+            assert(bound);
+            m_sockets[player.hash] = socket;
+
+            HelloPacket hello;
+            hello.playerHash = player.hash;
+            std::strncpy(hello.playerName, player.name, PLAYER_NAME_SIZE - 1);
+            Send(player.hash, ToBytes(hello));
+        }
+    }
+
+    GameServer& Server() { return m_server; }
+
+    void Send(uint64_t hash, const std::vector<uint8_t>& data) {
+        m_network.SendUdp(m_sockets.at(hash), data, m_serverEndpoint);
+    }
+
+    void SendInput(uint64_t hash, uint8_t inputs, uint32_t sequence) {
+        InputPacket input;
+        input.playerHash = hash;
+        input.inputs = inputs;
+        input.sequence = sequence;
+        Send(hash, ToBytes(input));
+    }
+
+    bool Tick() {
+        const bool running = m_server.Tick();
+        for (const auto& [hash, socket] : m_sockets) {
+            while (m_network.ReceiveUdp(socket, 65536)) {
+            }
+        }
+        return running;
+    }
+
+private:
+    Network::LoopbackNetworkModule m_network;
+    GameServer m_server;
+    Network::Endpoint m_serverEndpoint;
+    std::map<uint64_t, Network::SocketId> m_sockets;
+};
+
+// Plays a scripted match while recording its inputs, returns the final checksum
+static uint64_t RecordMatch(uint32_t ticks) {
+    const auto players = MakePlayers();
+    Room room(players);
+    [[maybe_unused]] bool recording = room.Server().RecordInputs(LOG_PATH);
+    assert(recording);
+    room.Server().Start();
+
+    const uint8_t patterns[] = {RIGHT | SHOOT, UP | SHOOT, DOWN | LEFT, SHOOT, NONE};
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        for (size_t i = 0; i < players.size(); i++) {
+            if (i == 2 && tick == ticks / 2) {
+                room.Send(players[i].hash, {static_cast<uint8_t>(GamePacket::DISCONNECT)});
+            } else if ((tick + i * 7) % 3 == 0 && !(i == 2 && tick > ticks / 2)) {
+                room.SendInput(players[i].hash, patterns[(tick / 20 + i) % 5], tick + 1);
+            }
+        }
+        room.Tick();
+    }
+    const uint64_t checksum = room.Server().ComputeStateChecksum();
+    room.Server().Stop();
+    return checksum;
+}
+
+// Feeds a recorded log back tick by tick, as r-type_replay does
+static uint64_t ReplayLog(uint32_t& ticks) {
+    InputLogReader reader;
+    [[maybe_unused]] bool opened = reader.Open(LOG_PATH);
+    assert(opened);
+    assert(reader.GetSeed() == SEED && reader.GetPlayers().size() == 3);
+
+    Room room(reader.GetPlayers());
+    room.Server().Start();
+
+    std::vector<InputLogEvent> events;
+    uint32_t nextEventTick = 0;
+    uint32_t lastTick = 0;
+    bool hasEvents = reader.ReadTick(nextEventTick, events);
+    ticks = 0;
+    while (true) {
+        while (hasEvents && nextEventTick <= room.Server().GetCurrentTick()) {
+            for (const auto& event : events) {
+                if (event.type == static_cast<uint8_t>(InputLogEventType::DISCONNECT)) {
+                    room.Send(event.playerHash, {static_cast<uint8_t>(GamePacket::DISCONNECT)});
+                } else {
+                    room.SendInput(event.playerHash, event.inputs, event.sequence);
+                }
+            }
+            lastTick = nextEventTick;
+            hasEvents = reader.ReadTick(nextEventTick, events);
+        }
+        if ((!hasEvents && room.Server().GetCurrentTick() > lastTick) || !room.Tick()) {
+            break;
+        }
+        ticks++;
+    }
+    const uint64_t checksum = room.Server().ComputeStateChecksum();
+    room.Server().Stop();
+    return checksum;
+}
+
+void test_replay_is_deterministic() {
+    std::cout << "=== Test: Replay Is Deterministic ===" << std::endl;
+
+    // The server narrates every connection and input; keep the test output readable
+    std::ostringstream discarded;
+    std::streambuf* coutBuffer = std::cout.rdbuf(discarded.rdbuf());
+    const uint32_t matchTicks = 600;
+    const uint64_t recorded = RecordMatch(matchTicks);
+    uint32_t firstTicks = 0;
+    uint32_t secondTicks = 0;
+    const uint64_t first = ReplayLog(firstTicks);
+    const uint64_t second = ReplayLog(secondTicks);
+    std::cout.rdbuf(coutBuffer);
+    std::remove(LOG_PATH);
+
+    std::cout << "Recorded 0x" << std::hex << recorded << ", replayed 0x" << first << " and 0x" << second
+              << std::dec << " over " << firstTicks << " ticks" << std::endl;
+    assert(firstTicks == matchTicks && secondTicks == matchTicks);
+    assert(first == second);
+    assert(first == recorded);
+
+    std::cout << "Replay Is Deterministic: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing Replay...\n" << std::endl;
+
+    try {
+        test_replay_is_deterministic();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,203 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Replication Schema
+*/
+
+#include "ReplicationSchema.hpp"
+#include "ComponentReplication.hpp"
+#include "SnapshotBudget.hpp"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+
+using namespace network;
+using RType::ECS::Registry;
+using RType::ECS::Entity;
+
+static EntityState MakeState(float x, float y, float vx, float vy) {
+    EntityState state;
+    state.entityId = 1;
+    state.entityType = static_cast<uint8_t>(EntityType::BULLET);
+    state.x = x;
+    state.y = y;
+    state.vx = vx;
+    state.vy = vy;
+    state.health = 1;
+    return state;
+}
+
+void test_field_encoding() {
+    std::cout << "=== Test: Field Encoding ===" << std::endl;
+
+    assert(SnapshotPrioritizer::GetDeltaFieldsSize(DELTA_POSITION) == sizeof(float) * 2);
+    assert(SnapshotPrioritizer::GetDeltaFieldsSize(DELTA_VELOCITY) == sizeof(float) * 2);
+    assert(SnapshotPrioritizer::GetDeltaFieldsSize(DELTA_HEALTH | DELTA_FLAGS) == sizeof(uint16_t) + sizeof(uint8_t));
+    assert(Replication::EntitySchema::ALL_FIELDS == 0x7F);
+
+    // Every group written is read back at the size it announced
+    EntityState sent = MakeState(1234.5f, -20.25f, -612.3f, 87.6f);
+    sent.health = 300;
+    sent.score = 123456;
+    sent.weaponType = 2;
+    std::vector<uint8_t> data;
+    const uint8_t all = Replication::EntitySchema::ALL_FIELDS;
+    SnapshotPrioritizer::AppendDeltaFields(data, sent, all);
+    assert(data.size() == SnapshotPrioritizer::GetDeltaFieldsSize(all));
+
+    EntityState received;
+    size_t offset = 0;
+    Replication::EntitySchema::Read(data.data(), offset, all, received);
+    assert(offset == data.size());
+    assert(received.x == 1234.5f && received.y == -20.25f);
+    assert(received.vx == -612.3f && received.vy == 87.6f);
+    assert(received.health == 300 && received.score == 123456 && received.weaponType == 2);
+    std::cout << "Every group round-trips exactly" << std::endl;
+
+    // A float sent as an integer is quantized, and saturates instead of wrapping
+    using QuarterVx = Replication::Field<&EntityState::vx, int16_t, 4>;
+    static_assert(QuarterVx::WIRE_SIZE == sizeof(int16_t));
+    assert(QuarterVx::Quantize(-612.3f) == -612.25f && QuarterVx::Quantize(87.6f) == 87.5f);
+    std::vector<uint8_t> quantized;
+    QuarterVx::Write(quantized, MakeState(0.0f, 0.0f, 100000.0f, 0.0f));
+    offset = 0;
+    QuarterVx::Read(quantized.data(), offset, received);
+    assert(offset == sizeof(int16_t) && received.vx > 8191.0f && received.vx < 8192.0f);
+    std::cout << "Quantized fields round to 1/Scale and clamp to the wire type" << std::endl;
+
+    std::cout << "Field Encoding: PASSED\n" << std::endl;
+}
+
+void test_change_detection() {
+    std::cout << "=== Test: Change Detection ===" << std::endl;
+
+    SnapshotBudgetConfig config;
+    const EntityState known = MakeState(100.0f, 100.0f, 50.0f, 0.0f);
+
+    EntityState current = known;
+    current.x += config.positionThreshold * 0.5f;
+    current.vy = config.velocityThreshold * 0.5f;
+    assert(SnapshotPrioritizer::ComputeDeltaFlags(known, current, config) == 0);
+
+    current.y += config.positionThreshold * 2.0f;
+    current.speedMultiplier = 15;
+    assert(SnapshotPrioritizer::ComputeDeltaFlags(known, current, config) == (DELTA_POSITION | DELTA_POWERUP));
+    std::cout << "Drifting fields wait for their threshold, discrete ones do not" << std::endl;
+
+    // The client's view takes the sent groups and keeps the others
+    current.vx = 80.0f;
+    EntityState view = SnapshotPrioritizer::ApplyDelta(known, current, DELTA_POSITION | DELTA_VELOCITY);
+    assert(view.y == current.y && view.vx == 80.0f);
+    view = SnapshotPrioritizer::ApplyDelta(known, current, DELTA_POSITION);
+    assert(view.vx == known.vx && view.vy == known.vy);
+
+    // Flag changes outrank movement when the budget is tight
+    assert(SnapshotPrioritizer::GetChangePriority(DELTA_POSITION | DELTA_HEALTH) == 1.0f);
+    assert(SnapshotPrioritizer::GetChangePriority(DELTA_POSITION | DELTA_FLAGS) > 1.0f);
+    assert(SnapshotPrioritizer::GetChangePriority(0) == 1.0f);
+
+    std::cout << "Change Detection: PASSED\n" << std::endl;
+}
+
+void test_component_bindings() {
+    std::cout << "=== Test: Component Bindings ===" << std::endl;
+
+    using namespace RType::ECS;
+    Registry server;
+    Entity ship = server.CreateEntity();
+    server.AddComponent<Position>(ship, Position{10.0f, 20.0f});
+    server.AddComponent<Velocity>(ship, Velocity{3.0f, -4.0f});
+    server.AddComponent<Health>(ship, Health(-5, 100));
+
+    EntityState state;
+    Replication::CaptureComponents<Position, Velocity, Health>(server, ship, state);
+    assert(state.x == 10.0f && state.y == 20.0f && state.vx == 3.0f && state.vy == -4.0f);
+    assert(state.health == 0);
+
+    Registry client;
+    Entity mirror = client.CreateEntity();
+    client.AddComponent<Position>(mirror, Position{0.0f, 0.0f});
+    client.AddComponent<Velocity>(mirror, Velocity{0.0f, 0.0f});
+
+    // Only the groups the packet carried are written
+    Replication::ApplyComponents<Position, Velocity, Health>(client, mirror, state, DELTA_VELOCITY);
+    assert(client.GetComponent<Position>(mirror).x == 0.0f);
+    assert(client.GetComponent<Velocity>(mirror).dy == -4.0f);
+    assert(!client.HasComponent<Health>(mirror));
+
+    Replication::ApplyComponents<Position, Velocity, Health>(client, mirror, state, Replication::EntitySchema::ALL_FIELDS);
+    assert(client.GetComponent<Position>(mirror).y == 20.0f);
+    std::cout << "Server capture round-trips into the client registry" << std::endl;
+
+    std::cout << "Component Bindings: PASSED\n" << std::endl;
+}
+
+void test_gameplay_bindings() {
+    std::cout << "=== Test: Gameplay Bindings ===" << std::endl;
+
+    using namespace RType::ECS;
+    Registry server;
+    Entity ship = server.CreateEntity();
+    server.AddComponent<Health>(ship, Health(70000, 70000));
+    server.AddComponent<ScoreValue>(ship, ScoreValue(1234));
+    auto& powerUps = server.AddComponent<ActivePowerUps>(ship, ActivePowerUps{});
+    powerUps.hasSpreadShot = true;
+    powerUps.hasShield = true;
+    powerUps.speedMultiplier = 1.5f;
+    server.AddComponent<WeaponSlot>(ship, WeaponSlot(WeaponType::LASER, 0.35f, 40));
+
+    EntityState state;
+    state.powerUpFlags = POWERUP_LASER_BEAM;  // Stale bit from an earlier capture
+    Replication::CaptureComponents<Health, ScoreValue, ActivePowerUps, WeaponSlot>(server, ship, state);
+    assert(state.health == 0xFFFF && state.score == 1234);
+    assert(state.powerUpFlags == (POWERUP_SPREAD_SHOT | POWERUP_SHIELD) && state.speedMultiplier == 15);
+    assert(state.weaponType == static_cast<uint8_t>(WeaponType::LASER) && state.fireRate == 3);
+
+    // Fire rate and speed multiplier saturate at a byte of tenths
+    Entity gun = server.CreateEntity();
+    server.AddComponent<Shooter>(gun, Shooter(40.0f));
+    EntityState gunState;
+    Replication::CaptureComponents<Shooter>(server, gun, gunState);
+    assert(gunState.fireRate == 255);
+    std::cout << "Health, score, power-ups and weapon captured with their clamps" << std::endl;
+
+    Registry client;
+    Entity mirror = client.CreateEntity();
+    client.AddComponent<ScoreValue>(mirror, ScoreValue(0));
+    client.AddComponent<ActivePowerUps>(mirror, ActivePowerUps{});
+    client.AddComponent<WeaponSlot>(mirror, WeaponSlot{});
+    client.AddComponent<Shooter>(mirror, Shooter{});
+    Replication::ApplyComponents<ScoreValue, ActivePowerUps, WeaponSlot, Shooter>(client, mirror, state, DELTA_SCORE);
+    assert(client.GetComponent<ScoreValue>(mirror).points == 1234);
+    assert(!client.GetComponent<ActivePowerUps>(mirror).hasShield);
+
+    Replication::ApplyComponents<ScoreValue, ActivePowerUps, WeaponSlot, Shooter>(client, mirror, state,
+        Replication::EntitySchema::ALL_FIELDS);
+    [[maybe_unused]] const auto& applied = client.GetComponent<ActivePowerUps>(mirror);
+    assert(applied.hasSpreadShot && applied.hasShield && !applied.hasLaserBeam && !applied.hasFireRateBoost);
+    assert(applied.speedMultiplier == 1.5f);
+    assert(client.GetComponent<WeaponSlot>(mirror).type == WeaponType::LASER);
+    assert(std::abs(client.GetComponent<WeaponSlot>(mirror).fireRate - 0.3f) < 1e-6f);
+    assert(std::abs(client.GetComponent<Shooter>(mirror).fireRate - 0.3f) < 1e-6f);
+    std::cout << "Client components rebuilt from the sent groups only" << std::endl;
+
+    std::cout << "Gameplay Bindings: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing ReplicationSchema...\n" << std::endl;
+
+    try {
+        test_field_encoding();
+        test_change_detection();
+        test_component_bindings();
+        test_gameplay_bindings();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,149 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Snapshot Budget
+*/
+
+#include "SnapshotBudget.hpp"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <set>
+
+using namespace network;
+
+static const size_t POSITION_DELTA_COST = sizeof(DeltaEntityHeader) + sizeof(float) * 2;
+
+static EntityState MakeState(uint32_t id, EntityType type, float x, float y) {
+    EntityState state;
+    state.entityId = id;
+    state.entityType = static_cast<uint8_t>(type);
+    state.x = x;
+    state.y = y;
+    state.health = 1;
+    return state;
+}
+
+// Moves every entity by dx and marks it changed
+static void MoveAll(std::unordered_map<uint32_t, EntityState>& current, std::unordered_set<uint32_t>& changed, float dx) {
+    for (auto& [id, state] : current) {
+        state.x += dx;
+        changed.insert(id);
+    }
+}
+
+static std::vector<uint32_t> DeltaIds(const SnapshotSelection& selection) {
+    std::vector<uint32_t> ids;
+    for (const auto& [id, flags] : selection.deltaUpdates) {
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+void test_send_order() {
+    std::cout << "=== Test: Send Order ===" << std::endl;
+
+    std::unordered_map<uint32_t, EntityState> current;
+    current[1] = MakeState(1, EntityType::OBSTACLE, 100.0f, 100.0f);
+    current[2] = MakeState(2, EntityType::ENEMY, 100.0f, 100.0f);
+    current[3] = MakeState(3, EntityType::PLAYER, 100.0f, 100.0f);
+    current[4] = MakeState(4, EntityType::POWERUP, 100.0f, 100.0f);
+
+    ClientSnapshotState snapshot;
+    snapshot.lastSent = current;
+    std::unordered_set<uint32_t> changed;
+    MoveAll(current, changed, 5.0f);
+
+    SnapshotBudgetConfig config;
+    SnapshotSelection selection = SnapshotPrioritizer::SelectEntities(snapshot, current, changed, nullptr, config, 0);
+    assert(selection.newEntities.empty() && selection.deferred == 0);
+    assert((DeltaIds(selection) == std::vector<uint32_t>{3, 2, 4, 1}));
+    assert(selection.deltaData.size() == 4 * sizeof(float) * 2);
+    assert(snapshot.pending.empty() && snapshot.lastSent.at(1).x == 105.0f);
+    std::cout << "Deltas ordered player, enemy, power-up, obstacle" << std::endl;
+
+    // Unknown entities go out whole, and an unchanged one is not sent at all
+    current[5] = MakeState(5, EntityType::BULLET, 0.0f, 0.0f);
+    changed = {1, 5};
+    selection = SnapshotPrioritizer::SelectEntities(snapshot, current, changed, nullptr, config, 0);
+    assert(selection.newEntities.size() == 1 && selection.newEntities[0].entityId == 5);
+    assert(selection.deltaUpdates.empty());
+
+    // Relevance: the nearer of two identical enemies goes first
+    std::unordered_map<uint32_t, EntityState> enemies;
+    enemies[10] = MakeState(10, EntityType::ENEMY, 1400.0f, 100.0f);
+    enemies[11] = MakeState(11, EntityType::ENEMY, 200.0f, 100.0f);
+    ClientSnapshotState view;
+    view.lastSent = enemies;
+    changed.clear();
+    MoveAll(enemies, changed, -5.0f);
+    const EntityState viewer = MakeState(99, EntityType::PLAYER, 100.0f, 100.0f);
+    selection = SnapshotPrioritizer::SelectEntities(view, enemies, changed, &viewer, config, 0);
+    assert((DeltaIds(selection) == std::vector<uint32_t>{11, 10}));
+    std::cout << "Nearer entities rank above distant ones of the same kind" << std::endl;
+
+    std::cout << "Send Order: PASSED\n" << std::endl;
+}
+
+void test_deferred_entities_are_sent() {
+    std::cout << "=== Test: Deferred Entities Are Sent ===" << std::endl;
+
+    // One player and twenty obstacles all move every tick, but a packet only fits three deltas
+    std::unordered_map<uint32_t, EntityState> current;
+    current[1] = MakeState(1, EntityType::PLAYER, 0.0f, 0.0f);
+    for (uint32_t id = 2; id <= 21; id++) {
+        current[id] = MakeState(id, EntityType::OBSTACLE, id * 50.0f, 0.0f);
+    }
+    ClientSnapshotState snapshot;
+    snapshot.lastSent = current;
+
+    SnapshotBudgetConfig config;
+    config.maxPacketBytes = 100 + 3 * POSITION_DELTA_COST;
+
+    std::set<uint32_t> sent;
+    uint32_t playerSends = 0;
+    uint32_t peakStarvation = 0;
+    for (int tick = 0; tick < 40; tick++) {
+        std::unordered_set<uint32_t> changed;
+        MoveAll(current, changed, 2.0f);
+        SnapshotSelection selection = SnapshotPrioritizer::SelectEntities(snapshot, current, changed, nullptr, config, 100);
+        assert(selection.deltaUpdates.size() == 3);
+        assert(selection.deferred == current.size() - 3);
+        for (uint32_t id : DeltaIds(selection)) {
+            sent.insert(id);
+            playerSends += id == 1 ? 1 : 0;
+        }
+        peakStarvation = std::max(peakStarvation, selection.maxStarvation);
+    }
+
+    assert(sent.size() == current.size());
+    assert(playerSends >= 20);
+    assert(peakStarvation < 40);
+    std::cout << "Every obstacle reached the client; player sent in " << playerSends
+              << "/40 packets, longest wait " << peakStarvation << " ticks" << std::endl;
+
+    // Entities left out keep their accumulated priority
+    for (uint32_t id = 2; id <= 21; id++) {
+        if (snapshot.pending.count(id) > 0) {
+            assert(snapshot.pending.at(id).waitingTicks > 0);
+        }
+    }
+
+    std::cout << "Deferred Entities Are Sent: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing SnapshotBudget...\n" << std::endl;
+
+    try {
+        test_send_order();
+        test_deferred_entities_are_sent();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
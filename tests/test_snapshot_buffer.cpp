@@ -0,0 +1,145 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Snapshot Buffer
+*/
+
+#include "SnapshotBuffer.hpp"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+
+using namespace network;
+
+static EntityState MakeState(uint32_t id, float x, float y, float vx, float vy) {
+    EntityState state;
+    state.entityId = id;
+    state.x = x;
+    state.y = y;
+    state.vx = vx;
+    state.vy = vy;
+    return state;
+}
+
+static bool Near(float a, float b, float epsilon = 0.01f) {
+    return std::abs(a - b) <= epsilon;
+}
+
+void test_interpolation_between_ticks() {
+    std::cout << "=== Test: Interpolation Between Ticks ===" << std::endl;
+
+    SnapshotBuffer buffer;
+    const float speed = 120.0f;
+    for (uint32_t tick = 0; tick < 4; tick++) {
+        double serverTime = tick / 60.0;
+        buffer.OnSnapshotReceived(tick, 10.0 + serverTime);
+        buffer.PushEntityState(tick, MakeState(1, static_cast<float>(serverTime) * speed, 50.0f, speed, 0.0f));
+    }
+
+    float x = 0.0f;
+    float y = 0.0f;
+    assert(buffer.Sample(1, 1.5 / 60.0, x, y));
+    assert(Near(x, 1.5f / 60.0f * speed));
+    assert(Near(y, 50.0f));
+    std::cout << "Hermite sample matches constant-velocity motion" << std::endl;
+
+    assert(buffer.Sample(1, 0.0, x, y));
+    assert(Near(x, 0.0f));
+    std::cout << "Samples land exactly on stored ticks" << std::endl;
+
+    std::cout << "Interpolation: PASSED\n" << std::endl;
+}
+
+void test_extrapolation_cap() {
+    std::cout << "=== Test: Extrapolation Cap ===" << std::endl;
+
+    SnapshotBuffer::Config config;
+    config.maxExtrapolation = 0.1f;
+    SnapshotBuffer buffer(config);
+    buffer.OnSnapshotReceived(60, 5.0);
+    buffer.PushEntityState(60, MakeState(7, 100.0f, 0.0f, 200.0f, 0.0f));
+
+    float x = 0.0f;
+    float y = 0.0f;
+    assert(buffer.Sample(7, 1.0 + 0.05, x, y));
+    assert(Near(x, 110.0f));
+    assert(buffer.Sample(7, 1.0 + 2.0, x, y));
+    assert(Near(x, 120.0f));
+    assert(buffer.GetExtrapolatedSamples() == 2);
+    std::cout << "Extrapolation stops at maxExtrapolation" << std::endl;
+
+    assert(!buffer.Sample(8, 1.0, x, y));
+    std::cout << "Unknown entity is rejected" << std::endl;
+
+    std::cout << "Extrapolation: PASSED\n" << std::endl;
+}
+
+void test_teleport_snaps() {
+    std::cout << "=== Test: Teleport Snaps ===" << std::endl;
+
+    SnapshotBuffer buffer;
+    buffer.OnSnapshotReceived(0, 0.0);
+    buffer.PushEntityState(0, MakeState(3, 0.0f, 0.0f, 0.0f, 0.0f));
+    buffer.OnSnapshotReceived(1, 1.0 / 60.0);
+    buffer.PushEntityState(1, MakeState(3, 900.0f, 0.0f, 0.0f, 0.0f));
+
+    float x = 0.0f;
+    float y = 0.0f;
+    assert(buffer.Sample(3, 0.5 / 60.0, x, y));
+    assert(Near(x, 900.0f));
+    std::cout << "Large jumps are not blended" << std::endl;
+
+    std::cout << "Teleport: PASSED\n" << std::endl;
+}
+
+void test_adaptive_delay() {
+    std::cout << "=== Test: Adaptive Playout Delay ===" << std::endl;
+
+    SnapshotBuffer steady;
+    SnapshotBuffer jittery;
+    for (uint32_t tick = 0; tick < 300; tick++) {
+        double serverTime = tick / 60.0;
+        double jitter = (tick % 3 == 0) ? 0.03 : 0.0;
+        steady.OnSnapshotReceived(tick, serverTime + 0.05);
+        jittery.OnSnapshotReceived(tick, serverTime + 0.05 + jitter);
+        steady.Update(1.0f / 60.0f);
+        jittery.Update(1.0f / 60.0f);
+    }
+
+    assert(steady.GetJitter() < 0.001f);
+    assert(jittery.GetJitter() > steady.GetJitter());
+    assert(jittery.GetPlayoutDelay() > steady.GetPlayoutDelay());
+    assert(steady.GetPlayoutDelay() <= SnapshotBuffer::Config{}.maxPlayoutDelay);
+    std::cout << "Delay grows with measured jitter (steady=" << steady.GetPlayoutDelay()
+              << "s, jittery=" << jittery.GetPlayoutDelay() << "s)" << std::endl;
+
+    double renderTime = steady.GetRenderTime(299.0 / 60.0 + 0.05);
+    assert(renderTime < 299.0 / 60.0);
+    std::cout << "Render time trails the newest snapshot" << std::endl;
+
+    // A cleared buffer starts over from the initial delay, not the adapted one
+    jittery.Clear();
+    assert(jittery.GetPlayoutDelay() == SnapshotBuffer::INITIAL_PLAYOUT_DELAY);
+    assert(jittery.GetJitter() == 0.0f);
+    std::cout << "Clear resets the playout delay" << std::endl;
+
+    std::cout << "Adaptive delay: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing SnapshotBuffer...\n" << std::endl;
+
+    try {
+        test_interpolation_between_ticks();
+        test_extrapolation_cap();
+        test_teleport_snaps();
+        test_adaptive_delay();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
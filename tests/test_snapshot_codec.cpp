@@ -0,0 +1,158 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Snapshot Codec
+*/
+
+#include "SnapshotCodec.hpp"
+#include "SnapshotBudget.hpp"
+#include "ReplicationSchema.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstring>
+
+using namespace network;
+
+static EntityState MakeState(uint32_t id, float x, float y) {
+    EntityState state;
+    state.entityId = id;
+    state.entityType = static_cast<uint8_t>(EntityType::ENEMY);
+    state.x = x;
+    state.y = y;
+    state.health = 100;
+    return state;
+}
+
+// Builds a STATE_DELTA the same way GameServer::SendDeltaSnapshot lays it out
+static std::vector<uint8_t> BuildDelta(uint32_t sequence, uint32_t baseSequence, const std::vector<uint32_t>& destroyed,
+    const std::vector<EntityState>& created, const std::vector<std::pair<EntityState, uint8_t>>& updated,
+    ISnapshotCompressor* compressor, PayloadHistory& sentPayloads) {
+    std::vector<uint8_t> payload;
+    InputAck ack;
+    ack.playerHash = 42;
+    ack.lastProcessedSeq = sequence;
+    payload.insert(payload.end(), reinterpret_cast<uint8_t*>(&ack), reinterpret_cast<uint8_t*>(&ack) + sizeof(ack));
+    for (uint32_t id : destroyed) {
+        payload.insert(payload.end(), reinterpret_cast<uint8_t*>(&id), reinterpret_cast<uint8_t*>(&id) + sizeof(id));
+    }
+    for (const auto& state : created) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&state);
+        payload.insert(payload.end(), bytes, bytes + sizeof(EntityState));
+    }
+    for (const auto& [state, flags] : updated) {
+        DeltaEntityHeader deh;
+        deh.entityId = state.entityId;
+        deh.deltaFlags = flags;
+        payload.insert(payload.end(), reinterpret_cast<uint8_t*>(&deh), reinterpret_cast<uint8_t*>(&deh) + sizeof(deh));
+    }
+    for (const auto& [state, flags] : updated) {
+        SnapshotPrioritizer::AppendDeltaFields(payload, state, flags);
+    }
+
+    StateDeltaHeader header;
+    header.stateSequence = sequence;
+    header.baseSequence = baseSequence;
+    header.destroyedCount = static_cast<uint16_t>(destroyed.size());
+    header.newEntityCount = static_cast<uint16_t>(created.size());
+    header.deltaEntityCount = static_cast<uint16_t>(updated.size());
+    header.inputAckCount = 1;
+
+    std::vector<uint8_t> body = payload;
+    if (compressor) {
+        [[maybe_unused]] const bool compressed = compressor->Compress(payload.data(), payload.size(), sentPayloads.Find(baseSequence), body);
+        assert(compressed);
+        header.compressionFlags = compressor->GetCompressionFlag();
+        header.uncompressedSize = static_cast<uint32_t>(payload.size());
+    }
+    sentPayloads.Store(sequence, payload.data(), payload.size());
+
+    std::vector<uint8_t> packet(sizeof(StateDeltaHeader) + body.size());
+    std::memcpy(packet.data(), &header, sizeof(StateDeltaHeader));
+    std::memcpy(packet.data() + sizeof(StateDeltaHeader), body.data(), body.size());
+    return packet;
+}
+
+void test_delta_applied_in_place() {
+    std::cout << "=== Test: Delta Applied In Place ===" << std::endl;
+
+    SnapshotCodec codec;
+    PayloadHistory sent;
+    EntityStateTable table;
+
+    auto packet = BuildDelta(1, 0, {}, {MakeState(1, 10.0f, 20.0f), MakeState(2, 30.0f, 40.0f)}, {}, nullptr, sent);
+    [[maybe_unused]] bool decoded = codec.DecodeDelta(packet.data(), packet.size(), table);
+    assert(decoded);
+    assert(table.size() == 2);
+    assert(codec.GetChangedFields().at(2) == Replication::EntitySchema::ALL_FIELDS);
+    assert(codec.GetInputAcks().size() == 1 && codec.GetInputAcks()[0].lastProcessedSeq == 1);
+    std::cout << "New entities decoded into the table" << std::endl;
+
+    EntityState moved = MakeState(1, 15.0f, 25.0f);
+    moved.health = 50;
+    packet = BuildDelta(2, 1, {2}, {}, {{moved, DELTA_POSITION | DELTA_HEALTH}}, nullptr, sent);
+    decoded = codec.DecodeDelta(packet.data(), packet.size(), table);
+    assert(decoded);
+    assert(table.size() == 1);
+    assert(table[1].x == 15.0f && table[1].y == 25.0f && table[1].health == 50);
+    std::cout << "Destroyed entity removed, changed fields patched" << std::endl;
+
+    // The codec remembers which groups each entity received in the last packet
+    assert(codec.GetChangedFields().size() == 1);
+    assert(codec.GetChangedFields().at(1) == (DELTA_POSITION | DELTA_HEALTH));
+
+    [[maybe_unused]] const auto& flattened = codec.Flatten(table);
+    assert(flattened.size() == 1 && flattened[0].entityId == 1);
+    std::cout << "Delta in place: PASSED\n" << std::endl;
+}
+
+void test_history_compression_round_trip() {
+    std::cout << "=== Test: History Compression Round Trip ===" << std::endl;
+
+    SnapshotCodec codec;
+    Lz4HistoryCompressor compressor;
+    PayloadHistory sent;
+    EntityStateTable table;
+
+    std::vector<EntityState> created;
+    for (uint32_t id = 1; id <= 20; id++) {
+        created.push_back(MakeState(id, id * 10.0f, 100.0f));
+    }
+    auto packet = BuildDelta(1, 0, {}, created, {}, &compressor, sent);
+    [[maybe_unused]] bool decoded = codec.DecodeDelta(packet.data(), packet.size(), table);
+    assert(decoded);
+    assert(table.size() == 20);
+
+    std::vector<std::pair<EntityState, uint8_t>> updated;
+    for (uint32_t id = 1; id <= 20; id++) {
+        updated.push_back({MakeState(id, id * 10.0f - 2.0f, 100.0f), DELTA_POSITION});
+    }
+    packet = BuildDelta(2, 1, {}, {}, updated, &compressor, sent);
+    decoded = codec.DecodeDelta(packet.data(), packet.size(), table);
+    assert(decoded);
+    assert(table[7].x == 68.0f);
+    std::cout << "Delta compressed against the acknowledged payload decodes" << std::endl;
+
+    updated[6].first.x = 66.0f;
+    packet = BuildDelta(3, 99, {}, {}, updated, &compressor, sent);
+    decoded = codec.DecodeDelta(packet.data(), packet.size(), table);
+    assert(decoded && table[7].x == 66.0f);
+    std::cout << "Unknown base sequence falls back to dictionary-less LZ4" << std::endl;
+
+    std::cout << "History compression: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing SnapshotCodec...\n" << std::endl;
+
+    try {
+        test_delta_applied_in_place();
+        test_history_compression_round_trip();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
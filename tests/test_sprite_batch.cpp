@@ -0,0 +1,108 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Sprite Batch
+*/
+
+#include "Renderer/SpriteBatch.hpp"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+
+using namespace Renderer;
+
+static Rectangle MakeRegion(float x, float y, float w, float h) {
+    Rectangle region;
+    region.position = {x, y};
+    region.size = {w, h};
+    return region;
+}
+
+static Transform2D MakeTransform(float x, float y, int layer) {
+    Transform2D transform;
+    transform.position = {x, y};
+    transform.layer = layer;
+    return transform;
+}
+
+static bool Near(float a, float b) {
+    return std::fabs(a - b) < 1e-3f;
+}
+
+void test_batches_by_layer_then_texture() {
+    std::cout << "=== Test: Batches By Layer Then Texture ===" << std::endl;
+
+    SpriteBatch batch;
+    const Rectangle region = MakeRegion(0, 0, 32, 32);
+
+    // Interleaved textures on one layer, plus a background layer submitted last
+    for (int i = 0; i < 100; i++) {
+        batch.Add(static_cast<TextureId>(1 + i % 2), region, MakeTransform(i * 4.0f, 0, 10), Color{});
+    }
+    batch.Add(3, region, MakeTransform(0, 0, 0), Color{});
+    batch.Build();
+
+    const auto& batches = batch.GetBatches();
+    assert(batches.size() == 3);
+    assert(batches[0].textureId == 3 && batches[0].vertexCount == SpriteBatch::VERTICES_PER_SPRITE);
+    assert(batches[1].textureId == 1 && batches[1].vertexCount == 50 * SpriteBatch::VERTICES_PER_SPRITE);
+    assert(batches[2].textureId == 2 && batches[2].firstVertex == 51 * SpriteBatch::VERTICES_PER_SPRITE);
+    assert(batch.GetVertices().size() == 101 * SpriteBatch::VERTICES_PER_SPRITE);
+    std::cout << "101 sprites on 3 textures collapse into 3 batches" << std::endl;
+
+    // Submission order is kept inside a batch
+    const auto& vertices = batch.GetVertices();
+    assert(Near(vertices[batches[1].firstVertex].position.x, 0.0f));
+    assert(Near(vertices[batches[1].firstVertex + SpriteBatch::VERTICES_PER_SPRITE].position.x, 8.0f));
+    std::cout << "Sprites keep submission order within a batch" << std::endl;
+
+    batch.Clear();
+    assert(batch.IsEmpty() && batch.GetBatches().empty());
+
+    std::cout << "Batching: PASSED\n" << std::endl;
+}
+
+void test_quad_geometry() {
+    std::cout << "=== Test: Quad Geometry ===" << std::endl;
+
+    SpriteBatch batch;
+    Transform2D transform = MakeTransform(100, 50, 0);
+    transform.scale = {2.0f, 3.0f};
+    transform.origin = {8.0f, 8.0f};
+    batch.Add(1, MakeRegion(16, 32, 16, 16), transform, Color(1.0f, 0.0f, 0.0f));
+    batch.Build();
+
+    const auto& v = batch.GetVertices();
+    assert(Near(v[0].position.x, 84.0f) && Near(v[0].position.y, 26.0f));
+    assert(Near(v[2].position.x, 116.0f) && Near(v[2].position.y, 74.0f));
+    assert(Near(v[0].texCoords.x, 16.0f) && Near(v[2].texCoords.y, 48.0f));
+    assert(Near(v[0].color.g, 0.0f));
+    std::cout << "Origin and scale match sf::Sprite placement" << std::endl;
+
+    batch.Clear();
+    transform = MakeTransform(0, 0, 0);
+    transform.rotation = 90.0f;
+    batch.Add(1, MakeRegion(0, 0, 10, 20), transform, Color{});
+    batch.Build();
+    // Top-right corner (10, 0) rotates to (0, 10)
+    assert(Near(batch.GetVertices()[1].position.x, 0.0f) && Near(batch.GetVertices()[1].position.y, 10.0f));
+    std::cout << "Rotation is clockwise in degrees like SFML" << std::endl;
+
+    std::cout << "Geometry: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing SpriteBatch...\n" << std::endl;
+
+    try {
+        test_batches_by_layer_then_texture();
+        test_quad_geometry();
+
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,177 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Test Texture Atlas
+*/
+
+#include "Renderer/TextureAtlas.hpp"
+#include "Renderer/RecordingRenderer.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace Renderer;
+
+static const char* SHIP_PATH = "test_texture_atlas_ship.png";
+static const char* BULLET_PATH = "test_texture_atlas_bullet.png";
+static const char* BACKGROUND_PATH = "test_texture_atlas_background.png";
+
+static void WritePngHeader(const char* path, std::uint32_t width, std::uint32_t height) {
+    const unsigned char header[24] = {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0, 0, 13, 'I', 'H', 'D', 'R',
+        static_cast<unsigned char>(width >> 24), static_cast<unsigned char>(width >> 16),
+        static_cast<unsigned char>(width >> 8), static_cast<unsigned char>(width),
+        static_cast<unsigned char>(height >> 24), static_cast<unsigned char>(height >> 16),
+        static_cast<unsigned char>(height >> 8), static_cast<unsigned char>(height)};
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+static ImageData SolidImage(std::uint32_t width, std::uint32_t height, std::uint8_t value) {
+    ImageData image;
+    image.width = width;
+    image.height = height;
+    image.pixels.assign(static_cast<std::size_t>(width) * height * 4, value);
+    return image;
+}
+
+static bool Overlaps(const Rectangle& a, const Rectangle& b) {
+    return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+           a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+}
+
+void test_packing_layout() {
+    std::cout << "=== Test: Packing Layout ===" << std::endl;
+
+    AtlasConfig config;
+    config.pageSize = 256;
+    config.maxImageSize = 128;
+    config.padding = 2;
+    TextureAtlasBuilder builder(config);
+
+    for (int i = 0; i < 12; i++) {
+        [[maybe_unused]] bool added = builder.Add("image" + std::to_string(i), SolidImage(80 + i, 60 + i * 4, static_cast<std::uint8_t>(i)));
+        assert(added);
+    }
+    [[maybe_unused]] bool tooBigAdded = builder.Add("too_big", SolidImage(200, 20, 0));
+    [[maybe_unused]] bool emptyAdded = builder.Add("empty", ImageData{});
+    assert(!tooBigAdded && !emptyAdded);
+    builder.Build();
+
+    const auto& entries = builder.GetEntries();
+    const auto& pages = builder.GetPages();
+    assert(entries.size() == 12);
+    assert(pages.size() >= 2);
+
+    for (std::size_t i = 0; i < entries.size(); i++) {
+        const AtlasEntry& entry = entries[i];
+        const ImageData& page = pages[entry.page];
+        assert(entry.region.position.x >= config.padding && entry.region.position.y >= config.padding);
+        assert(entry.region.position.x + entry.region.size.x + config.padding <= page.width);
+        assert(entry.region.position.y + entry.region.size.y + config.padding <= page.height);
+        assert(page.width <= config.pageSize && page.height <= config.pageSize);
+
+        for (std::size_t j = i + 1; j < entries.size(); j++) {
+            if (entries[j].page != entry.page) {
+                continue;
+            }
+            Rectangle padded = entry.region;
+            padded.position = {padded.position.x - config.padding, padded.position.y - config.padding};
+            padded.size = {padded.size.x + 2.0f * config.padding, padded.size.y + 2.0f * config.padding};
+            assert(!Overlaps(padded, entries[j].region));
+        }
+    }
+    std::cout << "12 images packed into " << pages.size() << " pages without overlap" << std::endl;
+
+    // Pixels are copied, and edges extruded into the padding
+    for (const AtlasEntry& entry : entries) {
+        const ImageData& page = pages[entry.page];
+        std::uint8_t expected = static_cast<std::uint8_t>(std::stoi(entry.path.substr(5)));
+        auto pixel = [&page](float x, float y) {
+            return page.pixels[(static_cast<std::size_t>(y) * page.width + static_cast<std::size_t>(x)) * 4];
+        };
+        assert(pixel(entry.region.position.x, entry.region.position.y) == expected);
+        assert(pixel(entry.region.position.x - 1, entry.region.position.y - 1) == expected);
+        assert(pixel(entry.region.position.x + entry.region.size.x + 1,
+                     entry.region.position.y + entry.region.size.y - 1) == expected);
+    }
+    std::cout << "Pixels copied with extruded borders" << std::endl;
+    std::cout << "Packing: PASSED\n" << std::endl;
+}
+
+void test_renderer_atlas_views() {
+    std::cout << "=== Test: Renderer Atlas Views ===" << std::endl;
+
+    RecordingRenderer renderer;
+    [[maybe_unused]] bool windowCreated = renderer.CreateWindow(WindowConfig{});
+    assert(windowCreated);
+
+    AtlasConfig config;
+    config.maxImageSize = 512;
+    std::size_t packed = renderer.BuildTextureAtlas({SHIP_PATH, BULLET_PATH, BACKGROUND_PATH, "missing.png"}, config);
+    assert(packed == 2);
+
+    TextureId ship = renderer.LoadTexture(SHIP_PATH);
+    TextureId bullet = renderer.LoadTexture(BULLET_PATH);
+    TextureId background = renderer.LoadTexture(BACKGROUND_PATH);
+    assert(ship != bullet);
+    assert(renderer.GetTextureCacheHits() == 2);
+
+    // Sizes and regions stay relative to the original image
+    assert(renderer.GetTextureSize(ship).x == 64.0f && renderer.GetTextureSize(ship).y == 32.0f);
+    assert(renderer.GetTextureSize(bullet).x == 8.0f);
+    SpriteId shipSprite = renderer.CreateSprite(ship, Rectangle{});
+    SpriteId bulletSprite = renderer.CreateSprite(bullet, Rectangle{{0, 0}, {4, 4}});
+    SpriteId backgroundSprite = renderer.CreateSprite(background, Rectangle{});
+    assert(renderer.GetSpriteTexture(shipSprite) == renderer.GetSpriteTexture(bulletSprite));
+    assert(renderer.GetSpriteTexture(backgroundSprite) == background);
+
+    renderer.BeginFrame();
+    for (int i = 0; i < 50; i++) {
+        Transform2D transform;
+        transform.position = {static_cast<float>(i * 10), 100.0f};
+        renderer.DrawSprite(i % 2 ? shipSprite : bulletSprite, transform);
+    }
+    renderer.EndFrame();
+    assert(renderer.GetRenderStats().sprites == 50);
+    assert(renderer.GetRenderStats().batches == 1);
+    std::cout << "Sprites of two packed textures drawn in 1 batch" << std::endl;
+
+    // Unloading a view keeps the atlas and its sprites alive
+    renderer.UnloadTexture(ship);
+    assert(renderer.GetSpriteTexture(shipSprite) != INVALID_TEXTURE_ID);
+
+    // A second build skips what is already packed
+    [[maybe_unused]] std::size_t repacked = renderer.BuildTextureAtlas({SHIP_PATH, BULLET_PATH}, config);
+    assert(repacked == 0);
+
+    std::cout << "Renderer Atlas: PASSED\n" << std::endl;
+}
+
+int main() {
+    std::cout << "Testing TextureAtlas...\n" << std::endl;
+
+    WritePngHeader(SHIP_PATH, 64, 32);
+    WritePngHeader(BULLET_PATH, 8, 8);
+    WritePngHeader(BACKGROUND_PATH, 1280, 720);
+    try {
+        test_packing_layout();
+        test_renderer_atlas_views();
+
+        std::remove(SHIP_PATH);
+        std::remove(BULLET_PATH);
+        std::remove(BACKGROUND_PATH);
+        std::cout << "All tests PASSED!" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::remove(SHIP_PATH);
+        std::remove(BULLET_PATH);
+        std::remove(BACKGROUND_PATH);
+        std::cerr << "Test FAILED: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,577 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Bot swarm load test: M rooms x N headless clients against in-process servers
+*/
+
+#include "GameClient.hpp"
+#include "GameServer.hpp"
+#include "LobbyClient.hpp"
+#include "LoopbackNetworkModule.hpp"
+#include "RoomClient.hpp"
+#include "RoomManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace network;
+
+namespace {
+
+    constexpr uint16_t LOBBY_PORT = 4242;
+    constexpr uint16_t FIRST_GAME_PORT = 5000;
+    constexpr double FRAME_TIME = 1.0 / 60.0;
+    constexpr double PING_INTERVAL = 0.5;
+    constexpr float PLAYER_SPEED = 300.0f; // GameServer::HandleInput
+    constexpr double SETUP_TIMEOUT = 30.0;
+
+    struct SwarmOptions {
+        size_t rooms = 4;
+        size_t botsPerRoom = MAX_PLAYERS;
+        double duration = 30.0;
+        std::string behavior = "random";
+        std::string levelPath = "assets/levels/level1.json";
+        uint32_t seed = 1;
+        bool verbose = false;
+        Network::LinkConditions conditions;
+    };
+
+    // One step of a scripted behavior: hold these inputs for a number of seconds
+    struct ScriptStep {
+        double duration = 0.0;
+        uint8_t inputs = 0;
+    };
+
+    using Behavior = std::function<uint8_t(double time)>;
+
+    uint8_t ParseInputs(const std::string& text) {
+        uint8_t inputs = 0;
+        std::stringstream stream(text);
+        std::string flag;
+        while (std::getline(stream, flag, '|')) {
+            if (flag == "UP") inputs |= InputFlags::UP;
+            else if (flag == "DOWN") inputs |= InputFlags::DOWN;
+            else if (flag == "LEFT") inputs |= InputFlags::LEFT;
+            else if (flag == "RIGHT") inputs |= InputFlags::RIGHT;
+            else if (flag == "SHOOT") inputs |= InputFlags::SHOOT;
+        }
+        return inputs;
+    }
+
+    // Script format: one "<seconds> <FLAG|FLAG...>" step per line, '#' comments, played in a loop
+    bool LoadScript(const std::string& path, std::vector<ScriptStep>& steps) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            return false;
+        }
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::stringstream stream(line);
+            ScriptStep step;
+            std::string flags;
+            if (stream >> step.duration) {
+                stream >> flags;
+                step.inputs = ParseInputs(flags);
+                steps.push_back(step);
+            }
+        }
+        return !steps.empty();
+    }
+
+    Behavior MakeBehavior(const std::string& name, const std::vector<ScriptStep>& script, uint32_t seed) {
+        auto rng = std::make_shared<std::mt19937>(seed);
+        if (name == "idle") {
+            return [](double) { return static_cast<uint8_t>(0); };
+        }
+        if (name == "strafe") {
+            return [](double time) {
+                uint8_t direction = static_cast<int>(time) % 2 == 0 ? InputFlags::UP : InputFlags::DOWN;
+                return static_cast<uint8_t>(direction | InputFlags::SHOOT);
+            };
+        }
+        if (name == "shooter") {
+            auto current = std::make_shared<uint8_t>(0);
+            auto nextChange = std::make_shared<double>(0.0);
+            return [rng, current, nextChange](double time) {
+                if (time >= *nextChange) {
+                    *current = static_cast<uint8_t>((*rng)() & 0x0F);
+                    *nextChange = time + 0.5;
+                }
+                return static_cast<uint8_t>(*current | InputFlags::SHOOT);
+            };
+        }
+        if (!script.empty()) {
+            double total = 0.0;
+            for (const auto& step : script) {
+                total += step.duration;
+            }
+            return [script, total](double time) {
+                double t = total > 0.0 ? std::fmod(time, total) : 0.0;
+                for (const auto& step : script) {
+                    if (t < step.duration) {
+                        return step.inputs;
+                    }
+                    t -= step.duration;
+                }
+                return script.back().inputs;
+            };
+        }
+        return [rng](double) { return static_cast<uint8_t>((*rng)() % 32); };
+    }
+
+    struct Percentiles {
+        double p50 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+        size_t count = 0;
+    };
+
+    Percentiles ComputePercentiles(std::vector<double> samples) {
+        Percentiles result;
+        result.count = samples.size();
+        if (samples.empty()) {
+            return result;
+        }
+        std::sort(samples.begin(), samples.end());
+        auto at = [&samples](double q) {
+            size_t index = static_cast<size_t>(q * static_cast<double>(samples.size() - 1) + 0.5);
+            return samples[std::min(index, samples.size() - 1)];
+        };
+        result.p50 = at(0.50);
+        result.p95 = at(0.95);
+        result.p99 = at(0.99);
+        result.max = samples.back();
+        return result;
+    }
+
+    void PrintPercentiles(const std::string& label, const Percentiles& p) {
+        std::cout << std::left << std::setw(28) << label << std::right
+                  << " p50 " << std::setw(8) << p.p50
+                  << "  p95 " << std::setw(8) << p.p95
+                  << "  p99 " << std::setw(8) << p.p99
+                  << "  max " << std::setw(8) << p.max
+                  << "  (n=" << p.count << ")" << std::endl;
+    }
+
+    struct RoomServer {
+        uint32_t roomId = 0;
+        std::unique_ptr<network::GameServer> server;
+        std::vector<PlayerInfo> players;
+        bool started = false;
+    };
+
+    // Client-side prediction of the bot's own ship, compared with the server position in each InputAck
+    struct PendingInput {
+        uint32_t sequence = 0;
+        uint8_t inputs = 0;
+        float predictedX = 0.0f;
+        float predictedY = 0.0f;
+    };
+
+    class Bot {
+    public:
+        enum class Phase { ROOM, LOBBY, GAME_CONNECT, PLAYING };
+
+        Bot(Network::LoopbackNetworkModule& network, size_t roomIndex, bool leader, Behavior behavior, std::string name)
+            : m_network(network), m_roomIndex(roomIndex), m_leader(leader),
+              m_behavior(std::move(behavior)), m_name(std::move(name)) {
+            m_roomClient = std::make_unique<network::RoomClient>(&m_network, "127.0.0.1", LOBBY_PORT);
+            m_roomClient->onRoomCreated([this](uint32_t roomId) { m_createdRoomId = roomId; });
+            m_roomClient->onRoomJoined([this](JoinRoomStatus status) {
+                m_joinPending = false;
+                m_joined = status == JoinRoomStatus::SUCCESS;
+            });
+        }
+
+        // Drives the lobby TCP flow until GAME_START, then the UDP game flow
+        void Update(std::vector<uint32_t>& roomIds, const std::unordered_map<uint32_t, uint16_t>& gamePorts) {
+            const double now = m_network.GetTime();
+            switch (m_phase) {
+            case Phase::ROOM:
+                UpdateRoom(roomIds);
+                break;
+            case Phase::LOBBY:
+                UpdateLobby(now, roomIds, gamePorts);
+                break;
+            case Phase::GAME_CONNECT:
+                m_game->ReceivePackets();
+                if (m_game->IsConnected()) {
+                    m_phase = Phase::PLAYING;
+                    m_gameStartTime = now;
+                }
+                break;
+            case Phase::PLAYING:
+                m_game->UpdateHeadless();
+                if (now - m_lastPing >= PING_INTERVAL) {
+                    m_game->SendPing();
+                    m_lastPing = now;
+                }
+                break;
+            }
+        }
+
+        bool IsPlaying() const { return m_phase == Phase::PLAYING; }
+        network::GameClient* GetGame() const { return m_game.get(); }
+        uint64_t GetHash() const { return m_info.hash; }
+        const std::vector<double>& GetRtts() const { return m_rtts; }
+        const std::vector<double>& GetReconciliationErrors() const { return m_reconciliationErrors; }
+
+    private:
+        void UpdateRoom(std::vector<uint32_t>& roomIds) {
+            m_roomClient->update();
+            if (m_leader && !m_createRequested) {
+                m_roomClient->createRoom("bots-" + std::to_string(m_roomIndex));
+                m_createRequested = true;
+            }
+            if (m_leader && m_createdRoomId && !roomIds[m_roomIndex]) {
+                roomIds[m_roomIndex] = m_createdRoomId;
+            }
+            if (!m_joinPending && !m_joined && roomIds[m_roomIndex]) {
+                m_roomClient->joinRoom(roomIds[m_roomIndex]);
+                m_joinPending = true;
+            }
+            if (m_joined) {
+                m_lobby = std::make_unique<network::LobbyClient>(m_roomClient->releaseSocket());
+                m_lobby->connect(m_name);
+                m_phase = Phase::LOBBY;
+            }
+        }
+
+        void UpdateLobby(double now, const std::vector<uint32_t>& roomIds, const std::unordered_map<uint32_t, uint16_t>& gamePorts) {
+            m_lobby->update();
+            if (m_lobby->isConnected() && !m_readySent) {
+                m_lobby->ready();
+                m_readySent = true;
+            }
+            // The leader keeps asking until everybody has joined and readied up
+            if (m_leader && m_readySent && !m_lobby->isGameStarted() && now - m_lastStartRequest >= 0.25) {
+                m_lobby->requestStart();
+                m_lastStartRequest = now;
+            }
+            if (!m_lobby->isGameStarted()) {
+                return;
+            }
+
+            auto port = gamePorts.find(roomIds[m_roomIndex]);
+            if (port == gamePorts.end()) {
+                return;
+            }
+            m_info = m_lobby->getMyInfo();
+            m_game = std::make_unique<network::GameClient>(&m_network, "127.0.0.1", port->second, m_info);
+            m_game->SetClock([this]() { return m_network.GetTime(); });
+            m_game->SetInputGenerator([this]() {
+                uint8_t inputs = m_behavior(m_network.GetTime() - m_gameStartTime);
+                TrackPrediction(inputs);
+                return inputs;
+            });
+            m_game->SetPongCallback([this](float rtt) { m_rtts.push_back(rtt); });
+            m_game->SetStateCallback([this](uint32_t, const std::vector<EntityState>&, const std::vector<InputAck>& acks) {
+                for (const auto& ack : acks) {
+                    if (ack.playerHash == m_info.hash) {
+                        Reconcile(ack);
+                    }
+                }
+            });
+            m_game->SendHello();
+            m_phase = Phase::GAME_CONNECT;
+        }
+
+        // Called right before the input is sent, so its sequence is the client's current one
+        void TrackPrediction(uint8_t inputs) {
+            float vx = 0.0f;
+            float vy = 0.0f;
+            if (inputs & InputFlags::UP) vy = -PLAYER_SPEED;
+            if (inputs & InputFlags::DOWN) vy = PLAYER_SPEED;
+            if (inputs & InputFlags::LEFT) vx = -PLAYER_SPEED;
+            if (inputs & InputFlags::RIGHT) vx = PLAYER_SPEED;
+            m_predictedX += vx * static_cast<float>(FRAME_TIME);
+            m_predictedY += vy * static_cast<float>(FRAME_TIME);
+
+            PendingInput pending;
+            pending.sequence = m_game->GetInputSequence();
+            pending.inputs = inputs;
+            pending.predictedX = m_predictedX;
+            pending.predictedY = m_predictedY;
+            m_pending.push_back(pending);
+        }
+
+        void Reconcile(const InputAck& ack) {
+            if (m_hasAck && ack.lastProcessedSeq <= m_lastAckedSequence) {
+                return;
+            }
+            while (!m_pending.empty() && m_pending.front().sequence < ack.lastProcessedSeq) {
+                m_pending.erase(m_pending.begin());
+            }
+            if (m_hasAck && !m_pending.empty() && m_pending.front().sequence == ack.lastProcessedSeq) {
+                const float dx = ack.serverPosX - m_pending.front().predictedX;
+                const float dy = ack.serverPosY - m_pending.front().predictedY;
+                m_reconciliationErrors.push_back(std::sqrt(dx * dx + dy * dy));
+            }
+            if (!m_pending.empty() && m_pending.front().sequence == ack.lastProcessedSeq) {
+                m_pending.erase(m_pending.begin());
+            }
+
+            // Rebase the prediction on the authoritative position and replay unacknowledged inputs
+            m_predictedX = ack.serverPosX;
+            m_predictedY = ack.serverPosY;
+            for (auto& pending : m_pending) {
+                if (pending.inputs & InputFlags::UP) m_predictedY -= PLAYER_SPEED * static_cast<float>(FRAME_TIME);
+                if (pending.inputs & InputFlags::DOWN) m_predictedY += PLAYER_SPEED * static_cast<float>(FRAME_TIME);
+                if (pending.inputs & InputFlags::LEFT) m_predictedX -= PLAYER_SPEED * static_cast<float>(FRAME_TIME);
+                if (pending.inputs & InputFlags::RIGHT) m_predictedX += PLAYER_SPEED * static_cast<float>(FRAME_TIME);
+                pending.predictedX = m_predictedX;
+                pending.predictedY = m_predictedY;
+            }
+            m_lastAckedSequence = ack.lastProcessedSeq;
+            m_hasAck = true;
+        }
+
+        Network::LoopbackNetworkModule& m_network;
+        size_t m_roomIndex;
+        bool m_leader;
+        Behavior m_behavior;
+        std::string m_name;
+        Phase m_phase = Phase::ROOM;
+
+        std::unique_ptr<network::RoomClient> m_roomClient;
+        std::unique_ptr<network::LobbyClient> m_lobby;
+        std::unique_ptr<network::GameClient> m_game;
+        PlayerInfo m_info;
+
+        bool m_createRequested = false;
+        uint32_t m_createdRoomId = 0;
+        bool m_joinPending = false;
+        bool m_joined = false;
+        bool m_readySent = false;
+        double m_lastStartRequest = -1.0;
+        double m_gameStartTime = 0.0;
+        double m_lastPing = -PING_INTERVAL;
+
+        std::vector<PendingInput> m_pending;
+        float m_predictedX = 0.0f;
+        float m_predictedY = 0.0f;
+        uint32_t m_lastAckedSequence = 0;
+        bool m_hasAck = false;
+
+        std::vector<double> m_rtts;
+        std::vector<double> m_reconciliationErrors;
+    };
+
+    void PrintUsage(const char* program) {
+        std::cout << "Usage: " << program << " [options]" << std::endl;
+        std::cout << "  --rooms M          Rooms to fill (default 4, max " << MAX_ROOMS << ")" << std::endl;
+        std::cout << "  --bots N           Bots per room (default " << MAX_PLAYERS << ", max " << MAX_PLAYERS << ")" << std::endl;
+        std::cout << "  --duration S       Simulated seconds of gameplay (default 30)" << std::endl;
+        std::cout << "  --behavior B       random | idle | strafe | shooter | <script file>" << std::endl;
+        std::cout << "  --latency MS       One-way latency" << std::endl;
+        std::cout << "  --jitter MS        Extra random one-way delay" << std::endl;
+        std::cout << "  --loss PCT         Datagram loss percentage" << std::endl;
+        std::cout << "  --reorder PCT      Datagram reordering percentage" << std::endl;
+        std::cout << "  --bandwidth BPS    Per-link bandwidth cap in bytes/sec" << std::endl;
+        std::cout << "  --level PATH       Level file (default assets/levels/level1.json)" << std::endl;
+        std::cout << "  --seed N           Seed for bots and network conditions" << std::endl;
+        std::cout << "  --verbose          Keep client and server logs" << std::endl;
+    }
+
+    bool ParseOptions(int argc, char** argv, SwarmOptions& options) {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+            if (arg == "--rooms") options.rooms = std::stoul(next());
+            else if (arg == "--bots") options.botsPerRoom = std::stoul(next());
+            else if (arg == "--duration") options.duration = std::stod(next());
+            else if (arg == "--behavior") options.behavior = next();
+            else if (arg == "--latency") options.conditions.latency = std::stod(next()) / 1000.0;
+            else if (arg == "--jitter") options.conditions.jitter = std::stod(next()) / 1000.0;
+            else if (arg == "--loss") options.conditions.lossRate = std::stof(next()) / 100.0f;
+            else if (arg == "--reorder") options.conditions.reorderRate = std::stof(next()) / 100.0f;
+            else if (arg == "--bandwidth") options.conditions.bandwidth = static_cast<uint32_t>(std::stoul(next()));
+            else if (arg == "--level") options.levelPath = next();
+            else if (arg == "--seed") options.seed = static_cast<uint32_t>(std::stoul(next()));
+            else if (arg == "--verbose") options.verbose = true;
+            else {
+                PrintUsage(argv[0]);
+                return false;
+            }
+        }
+        options.rooms = std::clamp<size_t>(options.rooms, 1, MAX_ROOMS);
+        options.botsPerRoom = std::clamp<size_t>(options.botsPerRoom, 1, MAX_PLAYERS);
+        return true;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    SwarmOptions options;
+    if (!ParseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    std::vector<ScriptStep> script;
+    const bool builtin = options.behavior == "random" || options.behavior == "idle" ||
+        options.behavior == "strafe" || options.behavior == "shooter";
+    if (!builtin && !LoadScript(options.behavior, script)) {
+        std::cerr << "Unknown behavior or unreadable script: " << options.behavior << std::endl;
+        return 1;
+    }
+
+    std::cout << "Bot swarm: " << options.rooms << " rooms x " << options.botsPerRoom << " bots, "
+              << options.duration << "s of gameplay, behavior '" << options.behavior << "'" << std::endl;
+    std::cout << "Network: latency " << options.conditions.latency * 1000.0 << "ms, jitter "
+              << options.conditions.jitter * 1000.0 << "ms, loss " << options.conditions.lossRate * 100.0f
+              << "%, reorder " << options.conditions.reorderRate * 100.0f << "%, bandwidth "
+              << (options.conditions.bandwidth ? std::to_string(options.conditions.bandwidth) + " B/s" : "unlimited") << std::endl;
+
+    std::ostringstream discarded;
+    std::streambuf* coutBuffer = std::cout.rdbuf();
+    std::streambuf* cerrBuffer = std::cerr.rdbuf();
+    if (!options.verbose) {
+        std::cout.rdbuf(discarded.rdbuf());
+        std::cerr.rdbuf(discarded.rdbuf());
+    }
+
+    Network::LoopbackNetworkModule network;
+    network.SetSeed(options.seed);
+    network.SetConditions(options.conditions);
+
+    // The lobby uses the smallest room size, so START_REQ is honoured as soon as every bot is ready
+    network::RoomManager roomManager(&network, LOBBY_PORT, options.rooms, options.botsPerRoom);
+    std::vector<std::unique_ptr<RoomServer>> servers;
+    std::unordered_map<uint32_t, uint16_t> gamePorts;
+
+    roomManager.onGameStart([&](uint32_t roomId, const network::RoomManager::Room& room) {
+        auto roomServer = std::make_unique<RoomServer>();
+        roomServer->roomId = roomId;
+        for (const auto& player : room.players) {
+            if (player) {
+                roomServer->players.push_back(*player);
+            }
+        }
+        uint16_t port = static_cast<uint16_t>(FIRST_GAME_PORT + roomId);
+        roomServer->server = std::make_unique<network::GameServer>(&network, port, roomServer->players, options.levelPath);
+        roomServer->server->SetSeed(room.gameSeed);
+        gamePorts[roomId] = port;
+        servers.push_back(std::move(roomServer));
+    });
+
+    std::vector<std::unique_ptr<Bot>> bots;
+    std::vector<uint32_t> roomIds(options.rooms, 0);
+    for (size_t room = 0; room < options.rooms; room++) {
+        for (size_t i = 0; i < options.botsPerRoom; i++) {
+            uint32_t botSeed = options.seed * 7919u + static_cast<uint32_t>(room * MAX_PLAYERS + i);
+            std::string name = "bot" + std::to_string(room) + "-" + std::to_string(i);
+            bots.push_back(std::make_unique<Bot>(network, room, i == 0, MakeBehavior(options.behavior, script, botSeed), name));
+        }
+    }
+
+    std::vector<double> tickTimes;
+    tickTimes.reserve(static_cast<size_t>(options.duration / FRAME_TIME) * options.rooms + 64);
+
+    auto frame = [&]() {
+        roomManager.update();
+        for (auto& roomServer : servers) {
+            if (!roomServer->started) {
+                roomServer->started = roomServer->server->TryStart();
+                continue;
+            }
+            auto start = std::chrono::steady_clock::now();
+            roomServer->server->Tick();
+            tickTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        for (auto& bot : bots) {
+            bot->Update(roomIds, gamePorts);
+        }
+        network.AdvanceTime(FRAME_TIME);
+    };
+
+    // Lobby and handshakes first, then the measured gameplay window
+    auto allPlaying = [&bots]() {
+        return std::all_of(bots.begin(), bots.end(), [](const auto& bot) { return bot->IsPlaying(); });
+    };
+    while (!allPlaying() && network.GetTime() < SETUP_TIMEOUT) {
+        frame();
+    }
+    const double setupTime = network.GetTime();
+    const bool setupComplete = allPlaying();
+
+    tickTimes.clear();
+    std::vector<uint64_t> bytesReceivedBefore;
+    std::vector<uint64_t> bytesSentBefore;
+    for (const auto& bot : bots) {
+        auto* game = bot->GetGame();
+        bytesReceivedBefore.push_back(game ? game->GetBytesReceived() : 0);
+        bytesSentBefore.push_back(game ? game->GetBytesSent() : 0);
+    }
+
+    const auto wallStart = std::chrono::steady_clock::now();
+    const double gameplayStart = network.GetTime();
+    while (network.GetTime() - gameplayStart < options.duration) {
+        frame();
+    }
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    const double simulated = network.GetTime() - gameplayStart;
+
+    std::cout.rdbuf(coutBuffer);
+    std::cerr.rdbuf(cerrBuffer);
+
+    std::vector<double> downstream;
+    std::vector<double> upstream;
+    std::vector<double> rtts;
+    std::vector<double> errors;
+    std::vector<double> snapshotSizes;
+    for (size_t i = 0; i < bots.size(); i++) {
+        auto* game = bots[i]->GetGame();
+        if (!game) {
+            continue;
+        }
+        downstream.push_back(static_cast<double>(game->GetBytesReceived() - bytesReceivedBefore[i]) / simulated);
+        upstream.push_back(static_cast<double>(game->GetBytesSent() - bytesSentBefore[i]) / simulated);
+        rtts.insert(rtts.end(), bots[i]->GetRtts().begin(), bots[i]->GetRtts().end());
+        errors.insert(errors.end(), bots[i]->GetReconciliationErrors().begin(), bots[i]->GetReconciliationErrors().end());
+    }
+
+    double maxSnapshot = 0.0;
+    for (const auto& roomServer : servers) {
+        for (const auto& player : roomServer->players) {
+            auto stats = roomServer->server->GetSnapshotStats(player.hash);
+            if (stats.packetsSent > 0) {
+                snapshotSizes.push_back(static_cast<double>(stats.bytesSent) / static_cast<double>(stats.packetsSent));
+                maxSnapshot = std::max(maxSnapshot, static_cast<double>(stats.maxPacketBytes));
+            }
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\nSetup: " << (setupComplete ? "all bots playing" : "TIMED OUT") << " after " << setupTime
+              << "s simulated (" << servers.size() << "/" << options.rooms << " rooms started)" << std::endl;
+    std::cout << "Gameplay: " << simulated << "s simulated in " << wallSeconds << "s wall ("
+              << (wallSeconds > 0.0 ? simulated / wallSeconds : 0.0) << "x real time)\n" << std::endl;
+
+    PrintPercentiles("Server tick time (ms)", ComputePercentiles(tickTimes));
+    PrintPercentiles("Downstream per client (B/s)", ComputePercentiles(downstream));
+    PrintPercentiles("Upstream per client (B/s)", ComputePercentiles(upstream));
+    PrintPercentiles("Avg snapshot per client (B)", ComputePercentiles(snapshotSizes));
+    std::cout << "Largest snapshot (B)         " << maxSnapshot << std::endl;
+    PrintPercentiles("RTT (ms)", ComputePercentiles(rtts));
+    PrintPercentiles("Reconciliation error (px)", ComputePercentiles(errors));
+
+    const auto stats = network.GetStats();
+    std::cout << "\nDatagrams: " << stats.datagramsSent << " sent, " << stats.datagramsLost << " lost, "
+              << stats.datagramsOverflowed << " over bandwidth, " << stats.datagramsReordered << " reordered" << std::endl;
+    return setupComplete ? 0 : 1;
+}
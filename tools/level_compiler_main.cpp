@@ -0,0 +1,73 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Offline compiler from level JSON to the flat .rlvl format
+*/
+
+#include "ECS/LevelBinary.hpp"
+#include "ECS/LevelLoader.hpp"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+// Usage: r-type_level_compiler <level.json> [level.json...]
+// Each level is written next to its source with the .rlvl extension and read
+// back to check it decodes; LevelLoader::LoadFromFile then picks it up.
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <level.json> [level.json...]" << std::endl;
+        return 1;
+    }
+
+    int failures = 0;
+    for (int i = 1; i < argc; i++) {
+        const std::string sourcePath = argv[i];
+        const std::string outputPath = RType::ECS::LevelBinary::CompiledPath(sourcePath);
+
+        std::ifstream source(sourcePath);
+        if (!source.is_open()) {
+            std::cerr << "Could not read " << sourcePath << std::endl;
+            failures++;
+            continue;
+        }
+        std::stringstream content;
+        content << source.rdbuf();
+
+        try {
+            auto parseStart = std::chrono::steady_clock::now();
+            RType::ECS::LevelData level = RType::ECS::LevelLoader::LoadFromString(content.str());
+            auto parseTime = std::chrono::steady_clock::now() - parseStart;
+
+            if (!RType::ECS::LevelBinary::SaveFile(level, outputPath)) {
+                std::cerr << "Could not write " << outputPath << std::endl;
+                failures++;
+                continue;
+            }
+
+            RType::ECS::LevelData check;
+            auto loadStart = std::chrono::steady_clock::now();
+            bool loaded = RType::ECS::LevelBinary::LoadFile(outputPath, check);
+            auto loadTime = std::chrono::steady_clock::now() - loadStart;
+            if (!loaded || check.obstacles.size() != level.obstacles.size() ||
+                check.enemies.size() != level.enemies.size()) {
+                std::cerr << "Compiled " << outputPath << " does not read back" << std::endl;
+                failures++;
+                continue;
+            }
+
+            std::cout << sourcePath << " -> " << outputPath << ": " << level.obstacles.size() << " obstacles, "
+                      << level.enemies.size() << " enemies (JSON "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(parseTime).count() << " us, compiled "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(loadTime).count() << " us)"
+                      << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << sourcePath << ": " << e.what() << std::endl;
+            failures++;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
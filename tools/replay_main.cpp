@@ -0,0 +1,190 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Replays a recorded input log through a headless GameServer as fast as possible
+*/
+
+#include "GameServer.hpp"
+#include "InputLog.hpp"
+#include "LoopbackNetworkModule.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    std::atomic<uint64_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+    constexpr uint16_t REPLAY_SERVER_PORT = 4242;
+
+    void PrintUsage(const char* program) {
+        std::cout << "Usage: " << program << " <input.log> [--level path] [--verbose]" << std::endl;
+        std::cout << "  Replays inputs recorded with RTYPE_RECORD_INPUTS and reports" << std::endl;
+        std::cout << "  ticks/sec, allocations/tick and the final state checksum." << std::endl;
+    }
+
+    template <typename T>
+    std::vector<uint8_t> ToBytes(const T& packet) {
+        std::vector<uint8_t> data(sizeof(T));
+        std::memcpy(data.data(), &packet, sizeof(T));
+        return data;
+    }
+
+    void DrainSockets(Network::INetworkModule& network, const std::unordered_map<uint64_t, Network::SocketId>& sockets) {
+        for (const auto& [hash, socket] : sockets) {
+            while (network.ReceiveUdp(socket, 65536)) {
+            }
+        }
+    }
+
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    std::string logPath;
+    std::string levelOverride;
+    bool verbose = false;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--level" && i + 1 < argc) {
+            levelOverride = argv[++i];
+        } else if (arg == "--verbose") {
+            verbose = true;
+        } else if (arg == "--help") {
+            PrintUsage(argv[0]);
+            return 0;
+        } else {
+            logPath = arg;
+        }
+    }
+
+    network::InputLogReader reader;
+    if (!reader.Open(logPath)) {
+        std::cerr << "Could not read input log " << logPath << std::endl;
+        return 1;
+    }
+
+    const std::string levelPath = levelOverride.empty() ? reader.GetLevelPath() : levelOverride;
+    std::cout << "Replaying " << logPath << std::endl;
+    std::cout << "  Seed:    " << reader.GetSeed() << std::endl;
+    std::cout << "  Level:   " << levelPath << std::endl;
+    std::cout << "  Players: " << reader.GetPlayers().size() << std::endl;
+
+    // The server logs every connection, level load and input; keep it out of the timings
+    std::ostringstream discarded;
+    std::streambuf* coutBuffer = std::cout.rdbuf();
+    if (!verbose) {
+        std::cout.rdbuf(discarded.rdbuf());
+    }
+
+    Network::LoopbackNetworkModule loopback;
+    network::GameServer server(&loopback, REPLAY_SERVER_PORT, reader.GetPlayers(), levelPath);
+    server.SetSeed(reader.GetSeed());
+
+    const Network::Endpoint serverEndpoint("127.0.0.1", REPLAY_SERVER_PORT);
+    std::unordered_map<uint64_t, Network::SocketId> playerSockets;
+    for (const auto& player : reader.GetPlayers()) {
+        Network::SocketId socket = loopback.CreateUdpSocket();
+        loopback.BindUdp(socket, 0);
+        playerSockets[player.hash] = socket;
+
+        network::HelloPacket hello;
+        hello.playerHash = player.hash;
+        std::strncpy(hello.playerName, player.name, PLAYER_NAME_SIZE - 1);
+        loopback.SendUdp(socket, ToBytes(hello), serverEndpoint);
+    }
+
+    server.Start();
+    DrainSockets(loopback, playerSockets);
+
+    std::vector<network::InputLogEvent> events;
+    events.reserve(MAX_PLAYERS * 8);
+    uint32_t nextEventTick = 0;
+    uint32_t lastTick = 0;
+    bool hasEvents = reader.ReadTick(nextEventTick, events);
+
+    const uint64_t allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+    const auto start = std::chrono::steady_clock::now();
+    uint32_t ticks = 0;
+
+    while (true) {
+        // The closing record repeats the last simulated tick, which may already have had events
+        while (hasEvents && nextEventTick <= server.GetCurrentTick()) {
+            for (const auto& event : events) {
+                auto socket = playerSockets.find(event.playerHash);
+                if (socket == playerSockets.end()) {
+                    continue;
+                }
+                if (event.type == static_cast<uint8_t>(network::InputLogEventType::DISCONNECT)) {
+                    std::vector<uint8_t> disconnect(1, static_cast<uint8_t>(network::GamePacket::DISCONNECT));
+                    loopback.SendUdp(socket->second, disconnect, serverEndpoint);
+                    continue;
+                }
+                network::InputPacket input;
+                input.playerHash = event.playerHash;
+                input.inputs = event.inputs;
+                input.sequence = event.sequence;
+                loopback.SendUdp(socket->second, ToBytes(input), serverEndpoint);
+            }
+            lastTick = nextEventTick;
+            hasEvents = reader.ReadTick(nextEventTick, events);
+        }
+        if (!hasEvents && server.GetCurrentTick() > lastTick) {
+            break;
+        }
+
+        if (!server.Tick()) {
+            break;
+        }
+        ticks++;
+        DrainSockets(loopback, playerSockets);
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const uint64_t allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+    const uint64_t checksum = server.ComputeStateChecksum();
+    server.Stop();
+
+    std::cout.rdbuf(coutBuffer);
+
+    const auto stats = loopback.GetStats();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Ticks:            " << ticks << std::endl;
+    std::cout << "Elapsed:          " << seconds * 1000.0 << " ms" << std::endl;
+    std::cout << "Ticks/sec:        " << (seconds > 0.0 ? ticks / seconds : 0.0) << std::endl;
+    std::cout << "Allocations/tick: " << (ticks > 0 ? static_cast<double>(allocations) / ticks : 0.0) << std::endl;
+    std::cout << "Datagrams:        " << stats.datagramsSent << " (" << stats.bytesSent << " bytes)" << std::endl;
+    std::cout << "State checksum:   0x" << std::hex << std::setw(16) << std::setfill('0') << checksum << std::dec << std::endl;
+    return 0;
+}
@@ -0,0 +1,179 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Compares snapshot compressors on recorded snapshot traffic
+*/
+
+#include "Compression.hpp"
+#include "SnapshotCompressor.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct BenchResult {
+        std::string name;
+        uint64_t rawBytes = 0;
+        uint64_t sentBytes = 0;
+        uint64_t compressedPackets = 0;
+        uint64_t packets = 0;
+        double compressNs = 0.0;
+        double decompressNs = 0.0;
+        bool roundTripOk = true;
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    double ElapsedNs(Clock::time_point start) {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+    }
+
+    // The pre-existing path: independent LZ4 blocks, skipped under MIN_COMPRESSION_SIZE
+    BenchResult BenchCurrentPath(const std::vector<std::vector<uint8_t>>& samples) {
+        BenchResult result;
+        result.name = "lz4 (current)";
+        for (const auto& sample : samples) {
+            result.packets++;
+            result.rawBytes += sample.size();
+
+            if (sample.size() < network::Compression::MIN_COMPRESSION_SIZE) {
+                result.sentBytes += sample.size();
+                continue;
+            }
+            auto start = Clock::now();
+            auto compressed = network::Compression::CompressLZ4(sample.data(), sample.size());
+            result.compressNs += ElapsedNs(start);
+
+            if (compressed.empty() || !network::Compression::ShouldCompress(sample.size(), compressed.size())) {
+                result.sentBytes += sample.size();
+                continue;
+            }
+            start = Clock::now();
+            auto decompressed = network::Compression::DecompressLZ4(compressed.data(), compressed.size(), sample.size());
+            result.decompressNs += ElapsedNs(start);
+
+            result.roundTripOk = result.roundTripOk && decompressed == sample;
+            result.sentBytes += compressed.size();
+            result.compressedPackets++;
+        }
+        return result;
+    }
+
+    // historyLag approximates how far behind the client's last STATE_ACK is
+    BenchResult BenchCompressor(network::ISnapshotCompressor& compressor, const std::vector<std::vector<uint8_t>>& samples,
+        size_t historyLag) {
+        BenchResult result;
+        result.name = compressor.GetName();
+        std::vector<uint8_t> compressed;
+        std::vector<uint8_t> decompressed;
+
+        for (size_t i = 0; i < samples.size(); i++) {
+            const auto& sample = samples[i];
+            result.packets++;
+            result.rawBytes += sample.size();
+
+            network::CompressionHistory history;
+            if (i >= historyLag && !samples[i - historyLag].empty()) {
+                history.data = samples[i - historyLag].data();
+                history.size = samples[i - historyLag].size();
+            }
+
+            if (sample.size() < compressor.GetMinInputSize()) {
+                result.sentBytes += sample.size();
+                continue;
+            }
+            auto start = Clock::now();
+            bool ok = compressor.Compress(sample.data(), sample.size(), history, compressed);
+            result.compressNs += ElapsedNs(start);
+
+            if (!ok || !network::Compression::ShouldCompress(sample.size(), compressed.size())) {
+                result.sentBytes += sample.size();
+                continue;
+            }
+            start = Clock::now();
+            ok = compressor.Decompress(compressed.data(), compressed.size(), sample.size(), history, decompressed);
+            result.decompressNs += ElapsedNs(start);
+
+            result.roundTripOk = result.roundTripOk && ok && decompressed == sample;
+            result.sentBytes += compressed.size();
+            result.compressedPackets++;
+        }
+        return result;
+    }
+
+    void PrintResult(const BenchResult& result) {
+        const double raw = static_cast<double>(result.rawBytes);
+        std::cout << std::left << std::setw(16) << result.name << std::right << std::fixed
+                  << std::setw(12) << result.sentBytes
+                  << std::setw(9) << std::setprecision(3) << (raw > 0.0 ? static_cast<double>(result.sentBytes) / raw : 0.0)
+                  << std::setw(10) << std::setprecision(1) << (result.packets ? 100.0 * result.compressedPackets / result.packets : 0.0)
+                  << std::setw(12) << std::setprecision(2) << (raw > 0.0 ? result.compressNs / raw : 0.0)
+                  << std::setw(12) << std::setprecision(2) << (raw > 0.0 ? result.decompressNs / raw : 0.0)
+                  << (result.roundTripOk ? "" : "  ROUND-TRIP MISMATCH") << std::endl;
+    }
+
+}
+
+// Usage: r-type_compression_bench <recording> [recording...] [--dict file] [--lag N]
+// Recordings should come from a single-client session so consecutive payloads belong to one stream.
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <recording> [recording...] [--dict file] [--lag N]" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::vector<uint8_t>> samples;
+    std::vector<uint8_t> dictionary;
+    size_t historyLag = 5;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--dict" && i + 1 < argc) {
+            if (!network::LoadBinaryFile(argv[++i], dictionary)) {
+                std::cerr << "Could not read dictionary " << argv[i] << std::endl;
+                return 1;
+            }
+            continue;
+        }
+        if (arg == "--lag" && i + 1 < argc) {
+            historyLag = std::stoul(argv[++i]);
+            continue;
+        }
+        if (!network::SnapshotTrafficRecorder::Load(arg, samples)) {
+            std::cerr << "Could not read recording " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    if (samples.empty()) {
+        std::cerr << "No payloads recorded" << std::endl;
+        return 1;
+    }
+
+    std::cout << samples.size() << " payloads, history lag " << historyLag << "\n" << std::endl;
+    std::cout << std::left << std::setw(16) << "compressor" << std::right
+              << std::setw(12) << "bytes" << std::setw(9) << "ratio" << std::setw(10) << "packed%"
+              << std::setw(12) << "comp ns/B" << std::setw(12) << "decomp ns/B" << std::endl;
+
+    PrintResult(BenchCurrentPath(samples));
+
+    network::Lz4BlockCompressor lz4Block;
+    PrintResult(BenchCompressor(lz4Block, samples, historyLag));
+
+    network::Lz4HistoryCompressor lz4History;
+    PrintResult(BenchCompressor(lz4History, samples, historyLag));
+
+    if (!dictionary.empty()) {
+        auto zstd = network::CreateSnapshotCompressor(network::COMPRESSION_ZSTD_DICT, dictionary);
+        if (zstd) {
+            PrintResult(BenchCompressor(*zstd, samples, historyLag));
+        } else {
+            std::cout << "zstd-dict        unavailable (built without zstd)" << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** Offline zstd dictionary trainer for recorded snapshot traffic
+*/
+
+#include "SnapshotCompressor.hpp"
+#include <zdict.h>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Usage: r-type_dict_trainer <output.dict> <recording> [recording...] [--size bytes]
+// Recordings come from a server started with RTYPE_RECORD_SNAPSHOTS=<file>.
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <output.dict> <recording> [recording...] [--size bytes]" << std::endl;
+        return 1;
+    }
+
+    std::string outputPath = argv[1];
+    size_t dictionarySize = 16 * 1024;
+    std::vector<std::vector<uint8_t>> samples;
+
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            dictionarySize = std::stoul(argv[++i]);
+            continue;
+        }
+        if (!network::SnapshotTrafficRecorder::Load(arg, samples)) {
+            std::cerr << "Could not read recording " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<uint8_t> samplesBuffer;
+    std::vector<size_t> sampleSizes;
+    for (const auto& sample : samples) {
+        if (sample.empty()) {
+            continue;
+        }
+        samplesBuffer.insert(samplesBuffer.end(), sample.begin(), sample.end());
+        sampleSizes.push_back(sample.size());
+    }
+
+    std::cout << "Training " << dictionarySize << " byte dictionary from " << sampleSizes.size()
+              << " payloads (" << samplesBuffer.size() << " bytes)" << std::endl;
+
+    std::vector<uint8_t> dictionary(dictionarySize);
+    size_t trainedSize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+        samplesBuffer.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+    if (ZDICT_isError(trainedSize)) {
+        std::cerr << "Training failed: " << ZDICT_getErrorName(trainedSize) << std::endl;
+        return 1;
+    }
+    dictionary.resize(trainedSize);
+
+    std::ofstream output(outputPath, std::ios::binary);
+    if (!output.is_open()) {
+        std::cerr << "Could not write " << outputPath << std::endl;
+        return 1;
+    }
+    output.write(reinterpret_cast<const char*>(dictionary.data()), dictionary.size());
+
+    std::cout << "Wrote " << trainedSize << " byte dictionary to " << outputPath << std::endl;
+    return 0;
+}